@@ -39,6 +39,11 @@ Deleter::Deleter(sr_val_t *vals, size_t cnt) {
     c._cnt = cnt;
     _t = Free_Type::VALS;
 }
+Deleter::Deleter(sr_val_t *vals, size_t cnt, Free_Type t) {
+    v._val = vals;
+    c._cnt = cnt;
+    _t = t;
+}
 Deleter::Deleter(sr_val_t **vals, size_t *cnt) {
     v.p_vals = vals;
     c.p_cnt = cnt;
@@ -58,6 +63,10 @@ Deleter::~Deleter() {
         if (v._val) sr_free_values(v._val, c._cnt);
     v._val = nullptr;
     break;
+    case Free_Type::VALS_ARENA:
+        if (v._val) sr_free_values_arena(v._val, c._cnt);
+    v._val = nullptr;
+    break;
     case Free_Type::VALS_POINTER:
         if (*v.p_vals) sr_free_values(*v.p_vals, *c.p_cnt);
     *v.p_vals = nullptr;
@@ -33,6 +33,7 @@ namespace sysrepo {
 enum class Free_Type {
     VAL,
     VALS,
+    VALS_ARENA,
     VALS_POINTER,
     SESSION,
 };
@@ -53,11 +54,13 @@ class Deleter
 public:
     Deleter(sr_val_t *val);
     Deleter(sr_val_t *vals, size_t cnt);
+    Deleter(sr_val_t *vals, size_t cnt, Free_Type t);
     Deleter(sr_val_t **vals, size_t *cnt);
     Deleter(sr_session_ctx_t *sess);
     ~Deleter();
 
     void update_vals_with_count(sr_val_t *val, size_t cnt);
+    Free_Type type() {return _t;};
 
 private:
     count_t c;
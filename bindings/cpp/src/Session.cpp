@@ -177,6 +177,21 @@ S_Vals Session::get_items(const char *xpath, uint32_t timeout_ms)
     throw_exception(ret);
 }
 
+S_Vals Session::get_items_arena(const char *xpath, uint32_t timeout_ms)
+{
+    S_Vals values(new Vals());
+
+    int ret = sr_get_items_arena(_sess, xpath, timeout_ms, &values->_vals, &values->_cnt);
+    if (SR_ERR_OK == ret) {
+        values->_deleter = std::make_shared<Deleter>(values->_vals, values->_cnt, Free_Type::VALS_ARENA);
+        return values;
+    }
+    if (SR_ERR_NOT_FOUND == ret) {
+        return nullptr;
+    }
+    throw_exception(ret);
+}
+
 libyang::S_Data_Node Session::get_subtree(const char *path, uint32_t timeout_ms)
 {
     struct lyd_node *subtree;
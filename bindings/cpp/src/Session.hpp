@@ -86,6 +86,8 @@ public:
     S_Val get_item(const char *path, uint32_t timeout_ms = 0);
     /** Wrapper for [sr_get_items](@ref sr_get_items) */
     S_Vals get_items(const char *xpath, uint32_t timeout_ms = 0);
+    /** Wrapper for [sr_get_items_arena](@ref sr_get_items_arena) */
+    S_Vals get_items_arena(const char *xpath, uint32_t timeout_ms = 0);
     /** Wrapper for [sr_get_subtree](@ref sr_get_subtree) */
     libyang::S_Data_Node get_subtree(const char *path, uint32_t timeout_ms = 0);
     /** Wrapper for [sr_get_data](@ref sr_get_data) */
@@ -459,6 +459,8 @@ S_Vals Vals::dup() {
     return vals;
 }
 sr_val_t* Vals::reallocate(size_t n) {
+    if (_deleter && _deleter->type() == Free_Type::VALS_ARENA)
+        throw_exception(SR_ERR_UNSUPPORTED);
     int ret = sr_realloc_values(_cnt,n,&_vals);
     if (ret != SR_ERR_OK)
         throw_exception(ret);
@@ -35,6 +35,7 @@
 %newobject Session::get_schema;
 %newobject Session::get_item;
 %newobject Session::get_items;
+%newobject Session::get_items_arena;
 %newobject Session::get_items_iter;
 %newobject Session::get_item_next;
 %newobject Session::get_subtree;
@@ -557,7 +557,7 @@ sr_sub_rpc_add(sr_session_ctx_t *sess, const char *op_path, const char *xpath, s
 {
     sr_error_info_t *err_info = NULL;
     struct opsub_rpc_s *rpc_sub = NULL;
-    uint32_t i;
+    uint32_t i, slot;
     char *mod_name;
     void *mem[4] = {NULL};
 
@@ -582,7 +582,9 @@ sr_sub_rpc_add(sr_session_ctx_t *sess, const char *op_path, const char *xpath, s
 
         rpc_sub = &subs->rpc_subs[i];
         memset(rpc_sub, 0, sizeof *rpc_sub);
-        rpc_sub->sub_shm.fd = -1;
+        for (slot = 0; slot < SR_RPC_SLOT_COUNT; ++slot) {
+            rpc_sub->sub_shm[slot].fd = -1;
+        }
 
         /* set attributes */
         mem[1] = strdup(op_path);
@@ -592,8 +594,14 @@ sr_sub_rpc_add(sr_session_ctx_t *sess, const char *op_path, const char *xpath, s
         /* get module name */
         mod_name = sr_get_first_ns(xpath);
 
-        /* create specific SHM and map it */
-        err_info = sr_shmsub_open_map(mod_name, "rpc", sr_str_hash(op_path), &rpc_sub->sub_shm, sizeof(sr_multi_sub_shm_t));
+        /* create specific SHM of every request slot and map it */
+        for (slot = 0; slot < SR_RPC_SLOT_COUNT; ++slot) {
+            err_info = sr_shmsub_open_map(mod_name, sr_rpc_slot_suffix(slot), sr_str_hash(op_path), &rpc_sub->sub_shm[slot],
+                    sizeof(sr_multi_sub_shm_t));
+            if (err_info) {
+                break;
+            }
+        }
         free(mod_name);
         if (err_info) {
             goto error_unlock;
@@ -636,7 +644,9 @@ error_unlock:
     }
     if (mem[1]) {
         --subs->rpc_sub_count;
-        sr_shm_clear(&rpc_sub->sub_shm);
+        for (slot = 0; slot < SR_RPC_SLOT_COUNT; ++slot) {
+            sr_shm_clear(&rpc_sub->sub_shm[slot]);
+        }
     }
     return err_info;
 }
@@ -646,7 +656,7 @@ sr_sub_rpc_del(const char *op_path, const char *xpath, sr_rpc_cb rpc_cb, sr_rpc_
         uint32_t priority, sr_subscription_ctx_t *subs)
 {
     sr_error_info_t *err_info = NULL;
-    uint32_t i, j;
+    uint32_t i, j, slot;
     struct opsub_rpc_s *rpc_sub;
 
     /* SUBS LOCK */
@@ -681,7 +691,9 @@ sr_sub_rpc_del(const char *op_path, const char *xpath, sr_rpc_cb rpc_cb, sr_rpc_
             if (!rpc_sub->sub_count) {
                 /* no other subscriptions for this RPC/action, replace it with the last */
                 free(rpc_sub->op_path);
-                sr_shm_clear(&rpc_sub->sub_shm);
+                for (slot = 0; slot < SR_RPC_SLOT_COUNT; ++slot) {
+                    sr_shm_clear(&rpc_sub->sub_shm[slot]);
+                }
                 free(rpc_sub->subs);
                 if (i < subs->rpc_sub_count - 1) {
                     memcpy(rpc_sub, &subs->rpc_subs[subs->rpc_sub_count - 1], sizeof *rpc_sub);
@@ -1116,9 +1128,87 @@ sr_clear_sess(sr_session_ctx_t *tmp_sess)
     for (i = 0; i < SR_DS_COUNT; ++i) {
         lyd_free_withsiblings(tmp_sess->dt[i].edit);
         tmp_sess->dt[i].edit = NULL;
-        lyd_free_withsiblings(tmp_sess->dt[i].diff);
+        if (!tmp_sess->dt[i].diff_shared) {
+            lyd_free_withsiblings(tmp_sess->dt[i].diff);
+        }
         tmp_sess->dt[i].diff = NULL;
+        tmp_sess->dt[i].diff_shared = 0;
+        sr_diff_view_free(tmp_sess->dt[i].diff_view);
+        tmp_sess->dt[i].diff_view = NULL;
+        sr_diff_index_free(tmp_sess->dt[i].diff_idx);
+        tmp_sess->dt[i].diff_idx = NULL;
+    }
+}
+
+/**
+ * @brief Reset a reused callback session, keep the allocated index sets.
+ *
+ * @param[in] cb_sess Callback session to reset.
+ */
+static void
+sr_cb_sess_reset(sr_session_ctx_t *cb_sess)
+{
+    uint16_t i;
+
+    sr_errinfo_free(&cb_sess->err_info);
+    for (i = 0; i < SR_DS_COUNT; ++i) {
+        lyd_free_withsiblings(cb_sess->dt[i].edit);
+        cb_sess->dt[i].edit = NULL;
+        if (!cb_sess->dt[i].diff_shared) {
+            lyd_free_withsiblings(cb_sess->dt[i].diff);
+        }
+        cb_sess->dt[i].diff = NULL;
+        cb_sess->dt[i].diff_shared = 0;
+        sr_diff_view_free(cb_sess->dt[i].diff_view);
+        cb_sess->dt[i].diff_view = NULL;
+        if (cb_sess->dt[i].diff_idx) {
+            /* only invalidate the index, it will be refilled */
+            cb_sess->dt[i].diff_idx->indexed = 0;
+        }
+    }
+}
+
+sr_error_info_t *
+sr_subs_cb_sess_get(sr_subscription_ctx_t *subscription, uint32_t count, sr_session_ctx_t ***cb_sess)
+{
+    sr_error_info_t *err_info = NULL;
+    uint32_t i;
+    void *mem;
+
+    if (subscription->cb_sess_count < count) {
+        /* sessions are allocated separately so that the pointers remain valid on array reallocation */
+        mem = realloc(subscription->cb_sess, count * sizeof *subscription->cb_sess);
+        SR_CHECK_MEM_RET(!mem, err_info);
+        subscription->cb_sess = mem;
+
+        for (i = subscription->cb_sess_count; i < count; ++i) {
+            subscription->cb_sess[i] = calloc(1, sizeof **subscription->cb_sess);
+            SR_CHECK_MEM_RET(!subscription->cb_sess[i], err_info);
+            subscription->cb_sess[i]->conn = subscription->conn;
+            ++subscription->cb_sess_count;
+        }
     }
+
+    for (i = 0; i < count; ++i) {
+        sr_cb_sess_reset(subscription->cb_sess[i]);
+    }
+
+    *cb_sess = subscription->cb_sess;
+    return NULL;
+}
+
+void
+sr_subs_cb_sess_free(sr_subscription_ctx_t *subscription)
+{
+    uint32_t i;
+
+    for (i = 0; i < subscription->cb_sess_count; ++i) {
+        sr_clear_sess(subscription->cb_sess[i]);
+        free(subscription->cb_sess[i]);
+    }
+    free(subscription->cb_sess);
+    subscription->cb_sess = NULL;
+    subscription->cb_sess_count = 0;
 }
 
 sr_error_info_t *
@@ -1305,6 +1395,9 @@ sr_create_startup_file(const struct lys_module *ly_mod)
         sr_errinfo_new(&err_info, SR_ERR_INTERNAL, NULL, "Failed to create startup file of \"%s\".", ly_mod->name);
         goto cleanup;
     }
+    if ((err_info = sr_startup_dir_sync())) {
+        goto cleanup;
+    }
 
 cleanup:
     free(path);
@@ -1356,6 +1449,17 @@ sr_path_sub_shm(const char *mod_name, const char *suffix1, int64_t suffix2, int
     return err_info;
 }
 
+const char *
+sr_rpc_slot_suffix(uint32_t slot)
+{
+    /* first slot keeps the original suffix */
+    static const char *suffixes[SR_RPC_SLOT_COUNT] = {"rpc", "rpc1", "rpc2", "rpc3", "rpc4", "rpc5", "rpc6", "rpc7"};
+
+    assert((slot < SR_RPC_SLOT_COUNT) && suffixes[slot]);
+
+    return suffixes[slot];
+}
+
 sr_error_info_t *
 sr_path_ds_shm(const char *mod_name, sr_datastore_t ds, int abs_path, char **path)
 {
@@ -1877,11 +1981,20 @@ sr_time_get(struct timespec *ts, uint32_t add_ms)
     ts->tv_sec += add_ms / 1000;
 }
 
-sr_error_info_t *
-sr_shm_remap(sr_shm_t *shm, size_t new_shm_size)
+/**
+ * @brief Remap and possibly resize a SHM.
+ *
+ * @param[in] shm SHM structure to remap.
+ * @param[in] new_shm_size Resize SHM to this size, if 0 read the size of the SHM file.
+ * @param[in] populate Whether to prefault all the pages of the new mapping.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+_sr_shm_remap(sr_shm_t *shm, size_t new_shm_size, int populate)
 {
     sr_error_info_t *err_info = NULL;
     size_t shm_file_size;
+    int flags;
 
     /* read the new shm size if not set */
     if (!new_shm_size && (err_info = sr_file_get_size(shm->fd, &shm_file_size))) {
@@ -1907,7 +2020,15 @@ sr_shm_remap(sr_shm_t *shm, size_t new_shm_size)
     shm->size = new_shm_size ? new_shm_size : shm_file_size;
 
     /* map */
-    shm->addr = mmap(NULL, shm->size, PROT_READ | PROT_WRITE, MAP_SHARED, shm->fd, 0);
+    flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if (populate) {
+        flags |= MAP_POPULATE;
+    }
+#else
+    (void)populate;
+#endif
+    shm->addr = mmap(NULL, shm->size, PROT_READ | PROT_WRITE, flags, shm->fd, 0);
     if (shm->addr == MAP_FAILED) {
         shm->addr = NULL;
         sr_errinfo_new(&err_info, SR_ERR_NOMEM, NULL, "Failed to map shared memory (%s).", strerror(errno));
@@ -1917,6 +2038,52 @@ sr_shm_remap(sr_shm_t *shm, size_t new_shm_size)
     return NULL;
 }
 
+sr_error_info_t *
+sr_shm_remap(sr_shm_t *shm, size_t new_shm_size)
+{
+    return _sr_shm_remap(shm, new_shm_size, 0);
+}
+
+sr_error_info_t *
+sr_shm_remap_hwm(sr_shm_t *shm, size_t min_shm_size)
+{
+    sr_error_info_t *err_info = NULL;
+    size_t shm_file_size, new_shm_size, page_size;
+
+    if (!min_shm_size) {
+        /* just follow the file */
+        return _sr_shm_remap(shm, 0, 0);
+    }
+
+    /* learn the current high-water mark, someone else may have grown it */
+    if ((err_info = sr_file_get_size(shm->fd, &shm_file_size))) {
+        return err_info;
+    }
+
+    page_size = sysconf(_SC_PAGESIZE);
+    new_shm_size = ((min_shm_size + page_size - 1) / page_size) * page_size;
+    if (new_shm_size <= shm_file_size) {
+        if ((shm_file_size <= SR_SUB_SHM_KEEP_MAX_SIZE) || (new_shm_size > shm_file_size / 4)) {
+            /* keep the high-water mark */
+            new_shm_size = shm_file_size;
+        } else if (new_shm_size < SR_SUB_SHM_KEEP_MAX_SIZE) {
+            /* shrink, but not too much */
+            new_shm_size = SR_SUB_SHM_KEEP_MAX_SIZE;
+        }
+    }
+
+    if (new_shm_size == shm->size) {
+        /* mapping is fine, only the file may need to be resized */
+        if ((new_shm_size != shm_file_size) && (ftruncate(shm->fd, new_shm_size) == -1)) {
+            sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to truncate shared memory (%s).", strerror(errno));
+            return err_info;
+        }
+        return NULL;
+    }
+
+    return _sr_shm_remap(shm, new_shm_size, new_shm_size > shm_file_size);
+}
+
 void
 sr_shm_clear(sr_shm_t *shm)
 {
@@ -2102,6 +2269,9 @@ sr_rwlock_init(sr_rwlock_t *rwlock, int shared)
         return err_info;
     }
     rwlock->readers = 0;
+    rwlock->writers = 0;
+    memset(rwlock->writer_pids, 0, sizeof rwlock->writer_pids);
+    rwlock->spins = 0;
     if ((err_info = sr_cond_init(&rwlock->cond, shared))) {
         pthread_mutex_destroy(&rwlock->mutex);
         return err_info;
@@ -2117,12 +2287,119 @@ sr_rwlock_destroy(sr_rwlock_t *rwlock)
     pthread_cond_destroy(&rwlock->cond);
 }
 
+int
+sr_rwlock_mutex_lock(sr_rwlock_t *rwlock, const struct timespec *timeout_ts)
+{
+    int ret, spins, max_spins;
+
+    /* spin up to twice as long as it has taken recently */
+    max_spins = rwlock->spins * 2 + 10;
+    if (max_spins > SR_RWLOCK_SPIN_MAX) {
+        max_spins = SR_RWLOCK_SPIN_MAX;
+    }
+
+    for (spins = 0; spins < max_spins; ++spins) {
+        ret = pthread_mutex_trylock(&rwlock->mutex);
+        if (ret != EBUSY) {
+            break;
+        }
+    }
+    if (spins == max_spins) {
+        /* block */
+        ret = pthread_mutex_timedlock(&rwlock->mutex, timeout_ts);
+    }
+
+    if (!ret) {
+        /* adapt the number of attempts, we are holding the mutex */
+        rwlock->spins += (spins - rwlock->spins) / 8;
+    }
+    return ret;
+}
+
+void
+sr_rwlock_rdwait(sr_rwlock_t *rwlock)
+{
+    struct timespec timeout_ts;
+    int ret;
+
+    if (!rwlock->writers) {
+        return;
+    }
+
+    sr_time_get(&timeout_ts, SR_RWLOCK_WRITER_PREF_TIMEOUT);
+
+    ret = 0;
+    while (!ret && rwlock->writers) {
+        /* COND WAIT */
+        ret = pthread_cond_timedwait(&rwlock->cond, &rwlock->mutex, &timeout_ts);
+    }
+
+    if ((ret == ETIMEDOUT) && rwlock->writers) {
+        /* a writer may have died while waiting */
+        sr_rwlock_writer_recover(rwlock);
+    }
+}
+
+int
+sr_rwlock_writer_add(sr_rwlock_t *rwlock)
+{
+    uint16_t i;
+
+    if (rwlock->writers == SR_RWLOCK_WRITER_COUNT) {
+        return 0;
+    }
+
+    for (i = 0; rwlock->writer_pids[i]; ++i);
+    rwlock->writer_pids[i] = getpid();
+    ++rwlock->writers;
+    return 1;
+}
+
+void
+sr_rwlock_writer_del(sr_rwlock_t *rwlock)
+{
+    uint16_t i;
+    pid_t pid;
+
+    pid = getpid();
+    for (i = 0; i < SR_RWLOCK_WRITER_COUNT; ++i) {
+        if (rwlock->writer_pids[i] == pid) {
+            rwlock->writer_pids[i] = 0;
+            --rwlock->writers;
+            return;
+        }
+    }
+
+    /* we must have been added */
+    assert(0);
+}
+
+void
+sr_rwlock_writer_recover(sr_rwlock_t *rwlock)
+{
+    uint16_t i, writers;
+
+    writers = rwlock->writers;
+    for (i = 0; i < SR_RWLOCK_WRITER_COUNT; ++i) {
+        if (rwlock->writer_pids[i] && !sr_process_exists(rwlock->writer_pids[i])) {
+            SR_LOG_WRN("Removing a waiting writer of a non-existent process with PID %ld.", (long)rwlock->writer_pids[i]);
+            rwlock->writer_pids[i] = 0;
+            --rwlock->writers;
+        }
+    }
+
+    if (writers != rwlock->writers) {
+        /* let the readers waiting for the dead writers continue */
+        pthread_cond_broadcast(&rwlock->cond);
+    }
+}
+
 sr_error_info_t *
 sr_rwlock(sr_rwlock_t *rwlock, int timeout_ms, sr_lock_mode_t mode, const char *func)
 {
     sr_error_info_t *err_info = NULL;
     struct timespec timeout_ts;
-    int ret;
+    int ret, pref;
 
     assert(timeout_ms > 0);
     assert((mode == SR_LOCK_READ) || (mode == SR_LOCK_WRITE));
@@ -2130,21 +2407,30 @@ sr_rwlock(sr_rwlock_t *rwlock, int timeout_ms, sr_lock_mode_t mode, const char *
     sr_time_get(&timeout_ts, timeout_ms);
 
     /* MUTEX LOCK */
-    ret = pthread_mutex_timedlock(&rwlock->mutex, &timeout_ts);
+    ret = sr_rwlock_mutex_lock(rwlock, &timeout_ts);
     if (ret) {
         SR_ERRINFO_LOCK(&err_info, func, ret);
         return err_info;
     }
 
     if (mode == SR_LOCK_WRITE) {
-        /* write lock */
+        /* write lock, new readers will wait for us */
         ret = 0;
+        pref = sr_rwlock_writer_add(rwlock);
         while (!ret && rwlock->readers) {
             /* COND WAIT */
             ret = pthread_cond_timedwait(&rwlock->cond, &rwlock->mutex, &timeout_ts);
         }
+        if (pref) {
+            sr_rwlock_writer_del(rwlock);
+        }
 
         if (ret) {
+            if (!rwlock->writers) {
+                /* let the readers waiting for us continue */
+                pthread_cond_broadcast(&rwlock->cond);
+            }
+
             /* MUTEX UNLOCK */
             pthread_mutex_unlock(&rwlock->mutex);
 
@@ -2152,7 +2438,8 @@ sr_rwlock(sr_rwlock_t *rwlock, int timeout_ms, sr_lock_mode_t mode, const char *
             return err_info;
         }
     } else {
-        /* read lock */
+        /* read lock, after waiting writers */
+        sr_rwlock_rdwait(rwlock);
         ++rwlock->readers;
 
         /* MUTEX UNLOCK */
@@ -2167,7 +2454,7 @@ sr_rwlock_with_recovery(sr_rwlock_t *rwlock, int timeout_ms, sr_lock_mode_t mode
 {
     sr_error_info_t *err_info = NULL;
     struct timespec timeout_ts;
-    int ret;
+    int ret, pref;
 
     assert(timeout_ms > 0);
     assert((mode == SR_LOCK_READ) || (mode == SR_LOCK_WRITE));
@@ -2175,28 +2462,37 @@ sr_rwlock_with_recovery(sr_rwlock_t *rwlock, int timeout_ms, sr_lock_mode_t mode
     sr_time_get(&timeout_ts, timeout_ms);
 
     /* MUTEX LOCK */
-    ret = pthread_mutex_timedlock(&rwlock->mutex, &timeout_ts);
+    ret = sr_rwlock_mutex_lock(rwlock, &timeout_ts);
     if (ret) {
         SR_ERRINFO_LOCK(&err_info, func, ret);
         return err_info;
     }
 
-    if (rwlock->readers) {
-        /* check that all connections still exist */
+    if (rwlock->readers && ((mode == SR_LOCK_WRITE) || sr_shmmain_state_recover_is_due(conn))) {
+        /* check that all connections still exist, read lockers only once in a while */
         if ((err_info = sr_shmmain_state_recover(conn))) {
             sr_errinfo_free(&err_info);
         }
     }
 
     if (mode == SR_LOCK_WRITE) {
-        /* write lock */
+        /* write lock, new readers will wait for us */
         ret = 0;
+        pref = sr_rwlock_writer_add(rwlock);
         while (!ret && rwlock->readers) {
             /* COND WAIT */
             ret = pthread_cond_timedwait(&rwlock->cond, &rwlock->mutex, &timeout_ts);
         }
+        if (pref) {
+            sr_rwlock_writer_del(rwlock);
+        }
 
         if (ret) {
+            if (!rwlock->writers) {
+                /* let the readers waiting for us continue */
+                pthread_cond_broadcast(&rwlock->cond);
+            }
+
             /* MUTEX UNLOCK */
             pthread_mutex_unlock(&rwlock->mutex);
 
@@ -2204,7 +2500,8 @@ sr_rwlock_with_recovery(sr_rwlock_t *rwlock, int timeout_ms, sr_lock_mode_t mode
             return err_info;
         }
     } else {
-        /* read lock */
+        /* read lock, after waiting writers */
+        sr_rwlock_rdwait(rwlock);
         ++rwlock->readers;
 
         /* MUTEX UNLOCK */
@@ -2227,7 +2524,7 @@ sr_rwunlock(sr_rwlock_t *rwlock, sr_lock_mode_t mode, const char *func)
         sr_time_get(&timeout_ts, SR_RWLOCK_READ_TIMEOUT);
 
         /* MUTEX LOCK */
-        ret = pthread_mutex_timedlock(&rwlock->mutex, &timeout_ts);
+        ret = sr_rwlock_mutex_lock(rwlock, &timeout_ts);
         if (ret) {
             SR_ERRINFO_LOCK(&err_info, func, ret);
             sr_errinfo_free(&err_info);
@@ -2254,6 +2551,165 @@ sr_rwunlock(sr_rwlock_t *rwlock, sr_lock_mode_t mode, const char *func)
     pthread_mutex_unlock(&rwlock->mutex);
 }
 
+/**
+ * @brief Worker thread of a worker pool.
+ *
+ * @param[in] arg Worker pool.
+ * @return Always NULL.
+ */
+static void *
+sr_workers_thread(void *arg)
+{
+    sr_workers_t *workers = arg;
+    uint32_t idx;
+
+    /* LOCK */
+    pthread_mutex_lock(&workers->lock);
+
+    while (1) {
+        /* wait for a task */
+        while (!workers->quit && (workers->next_task >= workers->task_count)) {
+            pthread_cond_wait(&workers->cond, &workers->lock);
+        }
+        if (workers->quit) {
+            break;
+        }
+        idx = workers->next_task++;
+
+        /* UNLOCK */
+        pthread_mutex_unlock(&workers->lock);
+
+        workers->task(workers->arg, idx);
+
+        /* LOCK */
+        pthread_mutex_lock(&workers->lock);
+
+        if (++workers->done_count == workers->task_count) {
+            pthread_cond_signal(&workers->done_cond);
+        }
+    }
+
+    /* UNLOCK */
+    pthread_mutex_unlock(&workers->lock);
+    return NULL;
+}
+
+sr_error_info_t *
+sr_workers_new(uint32_t count, sr_workers_t **workers)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_workers_t *w;
+    int ret;
+
+    assert(count);
+
+    w = calloc(1, sizeof *w);
+    SR_CHECK_MEM_RET(!w, err_info);
+    w->tids = malloc(count * sizeof *w->tids);
+    SR_CHECK_MEM_GOTO(!w->tids, err_info, error);
+    if ((err_info = sr_mutex_init(&w->lock, 0))) {
+        goto error;
+    }
+    if ((err_info = sr_cond_init(&w->cond, 0))) {
+        pthread_mutex_destroy(&w->lock);
+        goto error;
+    }
+    if ((err_info = sr_cond_init(&w->done_cond, 0))) {
+        pthread_cond_destroy(&w->cond);
+        pthread_mutex_destroy(&w->lock);
+        goto error;
+    }
+
+    /* start the threads */
+    for (w->count = 0; w->count < count; ++w->count) {
+        ret = pthread_create(&w->tids[w->count], NULL, sr_workers_thread, w);
+        if (ret) {
+            sr_errinfo_new(&err_info, SR_ERR_INTERNAL, NULL, "Creating a new thread failed (%s).", strerror(ret));
+            sr_workers_free(w);
+            return err_info;
+        }
+    }
+
+    *workers = w;
+    return NULL;
+
+error:
+    free(w->tids);
+    free(w);
+    return err_info;
+}
+
+void
+sr_workers_run(sr_workers_t *workers, void (*task)(void *arg, uint32_t idx), void *arg, uint32_t task_count)
+{
+    uint32_t idx;
+
+    /* LOCK */
+    pthread_mutex_lock(&workers->lock);
+
+    /* publish the tasks */
+    workers->task = task;
+    workers->arg = arg;
+    workers->task_count = task_count;
+    workers->next_task = 0;
+    workers->done_count = 0;
+    pthread_cond_broadcast(&workers->cond);
+
+    /* help with the tasks */
+    while (workers->next_task < workers->task_count) {
+        idx = workers->next_task++;
+
+        /* UNLOCK */
+        pthread_mutex_unlock(&workers->lock);
+
+        task(arg, idx);
+
+        /* LOCK */
+        pthread_mutex_lock(&workers->lock);
+
+        ++workers->done_count;
+    }
+
+    /* wait for all the tasks to finish */
+    while (workers->done_count < workers->task_count) {
+        pthread_cond_wait(&workers->done_cond, &workers->lock);
+    }
+    workers->task_count = 0;
+    workers->next_task = 0;
+
+    /* UNLOCK */
+    pthread_mutex_unlock(&workers->lock);
+}
+
+void
+sr_workers_free(sr_workers_t *workers)
+{
+    uint32_t i;
+
+    if (!workers) {
+        return;
+    }
+
+    /* LOCK */
+    pthread_mutex_lock(&workers->lock);
+
+    workers->quit = 1;
+    pthread_cond_broadcast(&workers->cond);
+
+    /* UNLOCK */
+    pthread_mutex_unlock(&workers->lock);
+
+    for (i = 0; i < workers->count; ++i) {
+        pthread_join(workers->tids[i], NULL);
+    }
+
+    pthread_cond_destroy(&workers->done_cond);
+    pthread_cond_destroy(&workers->cond);
+    pthread_mutex_destroy(&workers->lock);
+    free(workers->tids);
+    free(workers);
+}
+
 void *
 sr_realloc(void *ptr, size_t size)
 {
@@ -2267,13 +2723,41 @@ sr_realloc(void *ptr, size_t size)
     return new_mem;
 }
 
+/**
+ * @brief Write a whole buffer into a file descriptor.
+ *
+ * @param[in] fd File descriptor to write to.
+ * @param[in] buf Buffer to write.
+ * @param[in] size Size of @p buf.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_write_full(int fd, const char *buf, size_t size)
+{
+    sr_error_info_t *err_info = NULL;
+    ssize_t nwritten;
+
+    while (size) {
+        nwritten = write(fd, buf, size);
+        if (nwritten >= 0) {
+            size -= nwritten;
+            buf += nwritten;
+        } else if (errno != EINTR) {
+            SR_ERRINFO_SYSERRNO(&err_info, "write");
+            return err_info;
+        }
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_cp_file2shm(const char *to, const char *from, mode_t perm)
 {
     sr_error_info_t *err_info = NULL;
     int fd_to = -1, fd_from = -1;
-    char * out_ptr, buf[4096];
-    ssize_t nread, nwritten;
+    char buf[4096];
+    ssize_t nread;
     mode_t um;
 
     /* open "from" file */
@@ -2295,17 +2779,9 @@ sr_cp_file2shm(const char *to, const char *from, mode_t perm)
     }
 
     while ((nread = read(fd_from, buf, sizeof buf)) > 0) {
-        out_ptr = buf;
-        do {
-            nwritten = write(fd_to, out_ptr, nread);
-            if (nwritten >= 0) {
-                nread -= nwritten;
-                out_ptr += nwritten;
-            } else if (errno != EINTR) {
-                SR_ERRINFO_SYSERRNO(&err_info, "write");
-                goto cleanup;
-            }
-        } while (nread > 0);
+        if ((err_info = sr_write_full(fd_to, buf, nread))) {
+            goto cleanup;
+        }
     }
     if (nread == -1) {
         SR_ERRINFO_SYSERRNO(&err_info, "read");
@@ -2610,20 +3086,141 @@ sr_ev2api(sr_sub_event_t ev)
     return 0;
 }
 
-sr_error_info_t *
-sr_val_ly2sr(const struct lyd_node *node, sr_val_t *sr_val)
+/**
+ * @brief Append a string to a buffer.
+ *
+ * @param[in] buf Buffer to append to, NULL to only learn the length.
+ * @param[in] len Current length of the string in \p buf.
+ * @param[in] str String to append.
+ * @return New length of the string in \p buf.
+ */
+static size_t
+sr_buf_cat(char *buf, size_t len, const char *str)
 {
-    sr_error_info_t *err_info = NULL;
-    char *ptr;
-    const struct lyd_node_leaf_list *leaf;
-    struct lyd_node_anydata *any;
-    struct lyd_node *tree;
-    const char *origin;
+    size_t str_len = strlen(str);
 
-    sr_val->xpath = lyd_path(node);
-    SR_CHECK_MEM_GOTO(!sr_val->xpath, err_info, error);
-
-    sr_val->dflt = node->dflt;
+    if (buf) {
+        memcpy(buf + len, str, str_len);
+    }
+    return len + str_len;
+}
+
+/**
+ * @brief Append a predicate with a value to a buffer.
+ *
+ * @param[in] buf Buffer to append to, NULL to only learn the length.
+ * @param[in] len Current length of the string in \p buf.
+ * @param[in] name Name of the predicate node.
+ * @param[in] value Predicate value.
+ * @return New length of the string in \p buf.
+ */
+static size_t
+sr_buf_cat_predicate(char *buf, size_t len, const char *name, const char *value)
+{
+    const char *quot = strchr(value, '\'') ? "\"" : "'";
+
+    len = sr_buf_cat(buf, len, "[");
+    len = sr_buf_cat(buf, len, name);
+    len = sr_buf_cat(buf, len, "=");
+    len = sr_buf_cat(buf, len, quot);
+    len = sr_buf_cat(buf, len, value);
+    len = sr_buf_cat(buf, len, quot);
+    return sr_buf_cat(buf, len, "]");
+}
+
+/**
+ * @brief Print the data path of a node into a buffer, same as lyd_path() would create it.
+ *
+ * @param[in] node Data node.
+ * @param[in] buf Buffer to print into, NULL to only learn the length. It is not terminated.
+ * @return Length of the path.
+ */
+static size_t
+sr_lyd_path_print(const struct lyd_node *node, char *buf)
+{
+    const struct lys_node_list *slist;
+    const struct lyd_node *key;
+    size_t len;
+    uint8_t i;
+
+    len = node->parent ? sr_lyd_path_print(node->parent, buf) : 0;
+
+    /* node name, prefixed with its module name if it differs from the parent one */
+    len = sr_buf_cat(buf, len, "/");
+    if (!node->parent || (lyd_node_module(node) != lyd_node_module(node->parent))) {
+        len = sr_buf_cat(buf, len, lyd_node_module(node)->name);
+        len = sr_buf_cat(buf, len, ":");
+    }
+    len = sr_buf_cat(buf, len, node->schema->name);
+
+    /* predicates */
+    if (node->schema->nodetype == LYS_LIST) {
+        slist = (const struct lys_node_list *)node->schema;
+        for (i = 0, key = node->child; (i < slist->keys_size) && key && (key->schema == (struct lys_node *)slist->keys[i]);
+                ++i, key = key->next) {
+            len = sr_buf_cat_predicate(buf, len, key->schema->name, ((struct lyd_node_leaf_list *)key)->value_str);
+        }
+    } else if (node->schema->nodetype == LYS_LEAFLIST) {
+        len = sr_buf_cat_predicate(buf, len, ".", ((struct lyd_node_leaf_list *)node)->value_str);
+    }
+
+    return len;
+}
+
+/**
+ * @brief Duplicate a string, optionally into a memory pool.
+ *
+ * @param[in] str String to duplicate.
+ * @param[in,out] pool Optional pool to copy the string to, it is moved after the copy.
+ * @return Duplicated string, NULL on memory allocation failure.
+ */
+static char *
+sr_val_strdup(const char *str, char **pool)
+{
+    char *dup;
+    size_t len;
+
+    if (!pool) {
+        return strdup(str);
+    }
+
+    len = strlen(str) + 1;
+    dup = memcpy(*pool, str, len);
+    *pool += len;
+    return dup;
+}
+
+/**
+ * @brief Transform a libyang node into sysrepo value, optionally storing all the strings in a memory pool.
+ *
+ * @param[in] node libyang node to transform.
+ * @param[in,out] pool Optional pool for the strings, moved after them. Origin is not set if used
+ * and anyxml/anydata nodes are not supported.
+ * @param[out] sr_val sysrepo value.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_val_ly2sr_pool(const struct lyd_node *node, char **pool, sr_val_t *sr_val)
+{
+    sr_error_info_t *err_info = NULL;
+    char *ptr;
+    const struct lyd_node_leaf_list *leaf;
+    struct lyd_node_anydata *any;
+    struct lyd_node *tree;
+    const char *origin;
+    size_t len;
+
+    if (pool) {
+        len = sr_lyd_path_print(node, *pool);
+        (*pool)[len] = '\0';
+        sr_val->xpath = *pool;
+        *pool += len + 1;
+    } else {
+        sr_val->xpath = lyd_path(node);
+        SR_CHECK_MEM_GOTO(!sr_val->xpath, err_info, error);
+    }
+
+    sr_val->dflt = node->dflt;
 
     switch (node->schema->nodetype) {
     case LYS_LEAF:
@@ -2636,12 +3233,12 @@ sr_val_ly2sr(const struct lyd_node *node, sr_val_t *sr_val)
         switch (leaf->value_type) {
         case LY_TYPE_BINARY:
             sr_val->type = SR_BINARY_T;
-            sr_val->data.binary_val = strdup(leaf->value_str);
+            sr_val->data.binary_val = sr_val_strdup(leaf->value_str, pool);
             SR_CHECK_MEM_GOTO(!sr_val->data.binary_val, err_info, error);
             break;
         case LY_TYPE_BITS:
             sr_val->type = SR_BITS_T;
-            sr_val->data.bits_val = strdup(leaf->value_str);
+            sr_val->data.bits_val = sr_val_strdup(leaf->value_str, pool);
             SR_CHECK_MEM_GOTO(!sr_val->data.bits_val, err_info, error);
             break;
         case LY_TYPE_BOOL:
@@ -2663,17 +3260,17 @@ sr_val_ly2sr(const struct lyd_node *node, sr_val_t *sr_val)
             break;
         case LY_TYPE_ENUM:
             sr_val->type = SR_ENUM_T;
-            sr_val->data.enum_val = strdup(leaf->value_str);
+            sr_val->data.enum_val = sr_val_strdup(leaf->value_str, pool);
             SR_CHECK_MEM_GOTO(!sr_val->data.enum_val, err_info, error);
             break;
         case LY_TYPE_IDENT:
             sr_val->type = SR_IDENTITYREF_T;
-            sr_val->data.identityref_val = strdup(leaf->value_str);
+            sr_val->data.identityref_val = sr_val_strdup(leaf->value_str, pool);
             SR_CHECK_MEM_GOTO(!sr_val->data.identityref_val, err_info, error);
             break;
         case LY_TYPE_INST:
             sr_val->type = SR_INSTANCEID_T;
-            sr_val->data.instanceid_val = strdup(leaf->value_str);
+            sr_val->data.instanceid_val = sr_val_strdup(leaf->value_str, pool);
             SR_CHECK_MEM_GOTO(!sr_val->data.instanceid_val, err_info, error);
             break;
         case LY_TYPE_INT8:
@@ -2694,7 +3291,7 @@ sr_val_ly2sr(const struct lyd_node *node, sr_val_t *sr_val)
             break;
         case LY_TYPE_STRING:
             sr_val->type = SR_STRING_T;
-            sr_val->data.string_val = strdup(leaf->value_str);
+            sr_val->data.string_val = sr_val_strdup(leaf->value_str, pool);
             SR_CHECK_MEM_GOTO(!sr_val->data.string_val, err_info, error);
             break;
         case LY_TYPE_UINT8:
@@ -2733,6 +3330,7 @@ sr_val_ly2sr(const struct lyd_node *node, sr_val_t *sr_val)
         break;
     case LYS_ANYXML:
     case LYS_ANYDATA:
+        assert(!pool);
         any = (struct lyd_node_anydata *)node;
         ptr = NULL;
 
@@ -2782,16 +3380,193 @@ sr_val_ly2sr(const struct lyd_node *node, sr_val_t *sr_val)
         return err_info;
     }
 
-    /* origin */
-    sr_edit_diff_get_origin(node, &origin, NULL);
-    if (origin) {
-        sr_val->origin = strdup(origin);
+    if (!pool) {
+        /* origin */
+        sr_edit_diff_get_origin(node, &origin, NULL);
+        if (origin) {
+            sr_val->origin = strdup(origin);
+        }
+    }
+
+    return NULL;
+
+error:
+    if (!pool) {
+        free(sr_val->xpath);
+    }
+    return err_info;
+}
+
+sr_error_info_t *
+sr_val_ly2sr(const struct lyd_node *node, sr_val_t *sr_val)
+{
+    return sr_val_ly2sr_pool(node, NULL, sr_val);
+}
+
+/**
+ * @brief Get pointer to the string data of a sysrepo value, if it has any.
+ *
+ * @param[in] sr_val sysrepo value.
+ * @return Pointer to the string data member, NULL if the value type has no string data.
+ */
+static char **
+sr_val_str_data(sr_val_t *sr_val)
+{
+    switch (sr_val->type) {
+    case SR_BINARY_T:
+    case SR_BITS_T:
+    case SR_ENUM_T:
+    case SR_IDENTITYREF_T:
+    case SR_INSTANCEID_T:
+    case SR_STRING_T:
+    case SR_ANYXML_T:
+    case SR_ANYDATA_T:
+        return &sr_val->data.string_val;
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Learn the size of the string value of a sysrepo value created from a libyang node.
+ *
+ * @param[in] node libyang node, not anyxml/anydata.
+ * @return Size of the string value including the terminating zero, 0 if there is none.
+ */
+static size_t
+sr_val_ly2sr_str_size(const struct lyd_node *node)
+{
+    const struct lyd_node_leaf_list *leaf;
+
+    if (!(node->schema->nodetype & (LYS_LEAF | LYS_LEAFLIST))) {
+        return 0;
+    }
+
+    leaf = (const struct lyd_node_leaf_list *)node;
+    while (leaf->value_type == LY_TYPE_LEAFREF) {
+        leaf = (const struct lyd_node_leaf_list *)leaf->value.leafref;
+    }
+
+    switch (leaf->value_type) {
+    case LY_TYPE_BINARY:
+    case LY_TYPE_BITS:
+    case LY_TYPE_ENUM:
+    case LY_TYPE_IDENT:
+    case LY_TYPE_INST:
+    case LY_TYPE_STRING:
+        return strlen(leaf->value_str) + 1;
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+sr_error_info_t *
+sr_vals_ly2sr_arena(const struct ly_set *set, sr_val_t **values, size_t *value_cnt)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_val_t *vals = NULL;
+    char **str, *pool, *prev_origin = NULL;
+    const char *origin, *prev_node_origin = NULL;
+    size_t len, pool_len = 0;
+    uint32_t i, created = 0, moved = 0;
+    void *mem;
+
+    *values = NULL;
+    *value_cnt = 0;
+    if (!set->number) {
+        return NULL;
+    }
+
+    vals = calloc(set->number, sizeof *vals);
+    SR_CHECK_MEM_RET(!vals, err_info);
+
+    /* learn the size of all the strings, anyxml/anydata values need to be printed so they are fully created now */
+    for (i = 0; i < set->number; ++i) {
+        if (set->set.d[i]->schema->nodetype & LYS_ANYDATA) {
+            if ((err_info = sr_val_ly2sr(set->set.d[i], &vals[i]))) {
+                goto error;
+            }
+            created = i + 1;
+            str = sr_val_str_data(&vals[i]);
+            pool_len += strlen(vals[i].xpath) + 1 + ((str && *str) ? strlen(*str) + 1 : 0);
+        } else {
+            pool_len += sr_lyd_path_print(set->set.d[i], NULL) + 1 + sr_val_ly2sr_str_size(set->set.d[i]);
+        }
+
+        sr_edit_diff_get_origin(set->set.d[i], &origin, NULL);
+        if (origin && (!prev_node_origin || strcmp(prev_node_origin, origin))) {
+            prev_node_origin = origin;
+            pool_len += strlen(origin) + 1;
+        }
+    }
+
+    created = set->number;
+
+    /* the values array becomes the head of the block, string pointers of the created values are not affected */
+    mem = realloc(vals, set->number * sizeof *vals + pool_len);
+    SR_CHECK_MEM_GOTO(!mem, err_info, error);
+    vals = mem;
+    pool = (char *)(vals + set->number);
+
+    /* create all the values directly in the block */
+    for (i = 0; i < set->number; ++i) {
+        if (set->set.d[i]->schema->nodetype & LYS_ANYDATA) {
+            /* move the strings into the block */
+            len = strlen(vals[i].xpath) + 1;
+            memcpy(pool, vals[i].xpath, len);
+            free(vals[i].xpath);
+            vals[i].xpath = pool;
+            pool += len;
+
+            str = sr_val_str_data(&vals[i]);
+            if (str && *str) {
+                len = strlen(*str) + 1;
+                memcpy(pool, *str, len);
+                free(*str);
+                *str = pool;
+                pool += len;
+            }
+            free(vals[i].origin);
+            vals[i].origin = NULL;
+        } else if ((err_info = sr_val_ly2sr_pool(set->set.d[i], &pool, &vals[i]))) {
+            goto error;
+        }
+        ++moved;
+
+        /* consecutive values mostly share their origin, store it only once */
+        sr_edit_diff_get_origin(set->set.d[i], &origin, NULL);
+        if (origin) {
+            if (!prev_origin || strcmp(prev_origin, origin)) {
+                len = strlen(origin) + 1;
+                memcpy(pool, origin, len);
+                prev_origin = pool;
+                pool += len;
+            }
+            vals[i].origin = prev_origin;
+        }
     }
 
+    *values = vals;
+    *value_cnt = set->number;
     return NULL;
 
 error:
-    free(sr_val->xpath);
+    /* free the created values not yet in the block */
+    for (i = moved; i < created; ++i) {
+        if (set->set.d[i]->schema->nodetype & LYS_ANYDATA) {
+            free(vals[i].xpath);
+            str = sr_val_str_data(&vals[i]);
+            if (str) {
+                free(*str);
+            }
+            free(vals[i].origin);
+        }
+    }
+    free(vals);
     return err_info;
 }
 
@@ -3737,7 +4512,6 @@ sr_module_file_data_append(const struct lys_module *ly_mod, sr_datastore_t ds, s
     char *path = NULL;
     int fd = -1, flags;
 
-retry_open:
     /* prepare correct file path */
     if (ds ==  SR_DS_STARTUP) {
         err_info = sr_path_startup_file(ly_mod->name, &path);
@@ -3756,11 +4530,9 @@ retry_open:
     }
     if (fd == -1) {
         if ((errno == ENOENT) && (ds == SR_DS_CANDIDATE)) {
-            /* no candidate exists, just use running */
-            ds = SR_DS_RUNNING;
+            /* candidate was not modified, there is no diff */
             free(path);
-            path = NULL;
-            goto retry_open;
+            return NULL;
         }
 
         sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to open \"%s\" (%s).", path, strerror(errno));
@@ -3769,7 +4541,8 @@ retry_open:
 
     /* load the data */
     ly_errno = 0;
-    if (ds == SR_DS_OPERATIONAL) {
+    if ((ds == SR_DS_CANDIDATE) || (ds == SR_DS_OPERATIONAL)) {
+        /* stored diff */
         flags = LYD_OPT_EDIT | LYD_OPT_STRICT | LYD_OPT_NOEXTDEPS;
     } else {
         flags = LYD_OPT_CONFIG | LYD_OPT_STRICT | LYD_OPT_NOEXTDEPS;
@@ -3798,26 +4571,209 @@ error:
     return err_info;
 }
 
-sr_error_info_t *
-sr_module_file_data_set(const char *mod_name, sr_datastore_t ds, int create_flags, struct lyd_node *mod_data)
+/**
+ * @brief Set (replace) data in a startup file. The data are written into a temporary file that then atomically
+ * replaces the original one so that the file is valid even after a crash. If the temporary file cannot get the
+ * owner of the original file, it is rewritten in place.
+ *
+ * @param[in] path Startup file path.
+ * @param[in] create_flags Additional flags that will be used for opening the file,
+ * any of O_CREATE and O_EXCL are expected.
+ * @param[in] mod_data Module data.
+ * @param[in] raw_data Module data already printed in LYB, stored instead of @p mod_data if set.
+ * @param[in] raw_size Size of @p raw_data.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_module_file_startup_set(const char *path, int create_flags, struct lyd_node *mod_data, const char *raw_data,
+        size_t raw_size)
 {
     sr_error_info_t *err_info = NULL;
-    char *path = NULL;
-    int fd = -1;
+    struct stat st, tmp_st;
+    char *tmp_path = NULL;
+    int fd = -1, exists, in_place = 0;
     mode_t um;
 
-    /* learn path */
+    /* learn the owner and permissions of the current file */
+    if (stat(path, &st) == -1) {
+        if ((errno != ENOENT) || !(create_flags & O_CREAT)) {
+            sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to open \"%s\" (%s).", path, strerror(errno));
+            return err_info;
+        }
+        exists = 0;
+    } else {
+        if (create_flags & O_EXCL) {
+            sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to open \"%s\" (%s).", path, strerror(EEXIST));
+            return err_info;
+        }
+        exists = 1;
+    }
+
+    if (asprintf(&tmp_path, "%s.tmp", path) == -1) {
+        tmp_path = NULL;
+        SR_ERRINFO_MEM(&err_info);
+        goto cleanup;
+    }
+
+    /* set umask so that the correct permissions are really set */
+    um = umask(00000);
+    fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, exists ? (st.st_mode & 00777) : SR_FILE_PERM);
+    umask(um);
+    if (fd == -1) {
+        /* we cannot create files in the directory */
+        in_place = 1;
+    } else if (exists) {
+        /* keep the original owner */
+        if (fstat(fd, &tmp_st) == -1) {
+            SR_ERRINFO_SYSERRNO(&err_info, "fstat");
+            goto cleanup;
+        }
+        if (((tmp_st.st_uid != st.st_uid) || (tmp_st.st_gid != st.st_gid)) && (fchown(fd, st.st_uid, st.st_gid) == -1)) {
+            in_place = 1;
+        }
+    }
+
+    if (in_place) {
+        /* the file cannot be replaced, rewrite it */
+        if (fd > -1) {
+            close(fd);
+            fd = -1;
+            unlink(tmp_path);
+        }
+        free(tmp_path);
+        tmp_path = NULL;
+
+        um = umask(00000);
+        fd = open(path, O_WRONLY | O_TRUNC | create_flags, SR_FILE_PERM);
+        umask(um);
+        if (fd == -1) {
+            sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to open \"%s\" (%s).", path, strerror(errno));
+            goto cleanup;
+        }
+    }
+
+    /* print data */
+    if (raw_data) {
+        if ((err_info = sr_write_full(fd, raw_data, raw_size))) {
+            goto cleanup;
+        }
+    } else if (lyd_print_fd(fd, mod_data, LYD_LYB, LYP_WITHSIBLINGS)) {
+        sr_errinfo_new_ly(&err_info, lyd_node_module(mod_data)->ctx);
+        sr_errinfo_new(&err_info, SR_ERR_INTERNAL, NULL, "Failed to store data into \"%s\".", path);
+        goto cleanup;
+    }
+
+    /* the data must be on the disk before they replace the previous ones */
+    if (fsync(fd) == -1) {
+        SR_ERRINFO_SYSERRNO(&err_info, "fsync");
+        goto cleanup;
+    }
+
+    /* replace the file */
+    if (tmp_path && (rename(tmp_path, path) == -1)) {
+        SR_ERRINFO_SYSERRNO(&err_info, "rename");
+        goto cleanup;
+    }
+
+cleanup:
+    if (fd > -1) {
+        close(fd);
+    }
+    if (tmp_path) {
+        if (err_info) {
+            unlink(tmp_path);
+        }
+        free(tmp_path);
+    }
+    return err_info;
+}
+
+sr_error_info_t *
+sr_startup_dir_sync(void)
+{
+    sr_error_info_t *err_info = NULL;
+    char *path;
+    int fd;
+
+    if ((err_info = sr_path_startup_dir(&path))) {
+        return err_info;
+    }
+
+    /* sync the directory so that all the renamed startup files are durable */
+    fd = open(path, O_RDONLY | O_DIRECTORY);
+    if (fd == -1) {
+        sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to open \"%s\" (%s).", path, strerror(errno));
+        goto cleanup;
+    }
+    if (fsync(fd) == -1) {
+        SR_ERRINFO_SYSERRNO(&err_info, "fsync");
+        goto cleanup;
+    }
+
+cleanup:
+    if (fd > -1) {
+        close(fd);
+    }
+    free(path);
+    return err_info;
+}
+
+/**
+ * @brief Get the path of a module data file/SHM.
+ *
+ * @param[in] mod_name Module name.
+ * @param[in] ds Datastore.
+ * @param[out] path Path of the file or SHM name.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_module_file_path(const char *mod_name, sr_datastore_t ds, char **path)
+{
+    sr_error_info_t *err_info = NULL;
+
     switch (ds) {
     case SR_DS_STARTUP:
-        err_info = sr_path_startup_file(mod_name, &path);
+        err_info = sr_path_startup_file(mod_name, path);
         break;
     case SR_DS_RUNNING:
     case SR_DS_CANDIDATE:
     case SR_DS_OPERATIONAL:
-        err_info = sr_path_ds_shm(mod_name, ds, 0, &path);
+        err_info = sr_path_ds_shm(mod_name, ds, 0, path);
         break;
     }
-    if (err_info) {
+
+    return err_info;
+}
+
+/**
+ * @brief Set (replace) data in file/SHM for a specific module, either a data tree or raw LYB data.
+ *
+ * @param[in] mod_name Module name.
+ * @param[in] ds Target datastore
+ * @param[in] create_flags Additional flags that will be used for opening the file,
+ * any of O_CREATE and O_EXCL are expected.
+ * @param[in] mod_data Module data.
+ * @param[in] raw_data Module data already printed in LYB, stored instead of @p mod_data if set.
+ * @param[in] raw_size Size of @p raw_data.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+_sr_module_file_data_set(const char *mod_name, sr_datastore_t ds, int create_flags, struct lyd_node *mod_data,
+        const char *raw_data, size_t raw_size)
+{
+    sr_error_info_t *err_info = NULL;
+    char *path = NULL;
+    int fd = -1;
+    mode_t um;
+
+    /* learn path */
+    if ((err_info = sr_module_file_path(mod_name, ds, &path))) {
+        goto cleanup;
+    }
+
+    if (ds == SR_DS_STARTUP) {
+        /* startup data must survive a crash */
+        err_info = sr_module_file_startup_set(path, create_flags, mod_data, raw_data, raw_size);
         goto cleanup;
     }
 
@@ -3825,11 +4781,7 @@ sr_module_file_data_set(const char *mod_name, sr_datastore_t ds, int create_flag
     um = umask(00000);
 
     /* open */
-    if (ds == SR_DS_STARTUP) {
-        fd = open(path, O_WRONLY | O_TRUNC | create_flags, SR_FILE_PERM);
-    } else {
-        fd = shm_open(path, O_WRONLY | O_TRUNC | create_flags, SR_FILE_PERM);
-    }
+    fd = shm_open(path, O_WRONLY | O_TRUNC | create_flags, SR_FILE_PERM);
     umask(um);
     if (fd == -1) {
         sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to open \"%s\" (%s).", path, strerror(errno));
@@ -3837,7 +4789,11 @@ sr_module_file_data_set(const char *mod_name, sr_datastore_t ds, int create_flag
     }
 
     /* print data */
-    if (lyd_print_fd(fd, mod_data, LYD_LYB, LYP_WITHSIBLINGS)) {
+    if (raw_data) {
+        if ((err_info = sr_write_full(fd, raw_data, raw_size))) {
+            goto cleanup;
+        }
+    } else if (lyd_print_fd(fd, mod_data, LYD_LYB, LYP_WITHSIBLINGS)) {
         sr_errinfo_new_ly(&err_info, lyd_node_module(mod_data)->ctx);
         sr_errinfo_new(&err_info, SR_ERR_INTERNAL, NULL, "Failed to store data into \"%s\".", path);
         goto cleanup;
@@ -3851,6 +4807,79 @@ cleanup:
     return err_info;
 }
 
+sr_error_info_t *
+sr_module_file_data_set(const char *mod_name, sr_datastore_t ds, int create_flags, struct lyd_node *mod_data)
+{
+    return _sr_module_file_data_set(mod_name, ds, create_flags, mod_data, NULL, 0);
+}
+
+sr_error_info_t *
+sr_module_file_data_set_raw(const char *mod_name, sr_datastore_t ds, const char *data, size_t size)
+{
+    return _sr_module_file_data_set(mod_name, ds, 0, NULL, data, size);
+}
+
+sr_error_info_t *
+sr_module_file_data_get_raw(const char *mod_name, sr_datastore_t ds, char **data, size_t *size)
+{
+    sr_error_info_t *err_info = NULL;
+    char *path = NULL;
+    size_t done = 0;
+    ssize_t nread;
+    int fd = -1;
+
+    *data = NULL;
+    *size = 0;
+
+    /* learn path */
+    if ((err_info = sr_module_file_path(mod_name, ds, &path))) {
+        goto cleanup;
+    }
+
+    /* open */
+    if (ds == SR_DS_STARTUP) {
+        fd = open(path, O_RDONLY);
+    } else {
+        fd = shm_open(path, O_RDONLY, 0);
+    }
+    if (fd == -1) {
+        sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Failed to open \"%s\" (%s).", path, strerror(errno));
+        goto cleanup;
+    }
+
+    /* read all the data */
+    if ((err_info = sr_file_get_size(fd, size))) {
+        goto cleanup;
+    }
+    *data = malloc(*size ? *size : 1);
+    SR_CHECK_MEM_GOTO(!*data, err_info, cleanup);
+    while (done < *size) {
+        nread = read(fd, *data + done, *size - done);
+        if (nread > 0) {
+            done += nread;
+        } else if (!nread) {
+            /* the file was truncated, which should not happen while it is locked */
+            SR_ERRINFO_INT(&err_info);
+            goto cleanup;
+        } else if (errno != EINTR) {
+            SR_ERRINFO_SYSERRNO(&err_info, "read");
+            goto cleanup;
+        }
+    }
+
+cleanup:
+    if (fd > -1) {
+        close(fd);
+    }
+    free(path);
+    if (err_info) {
+        free(*data);
+        *data = NULL;
+        *size = 0;
+    }
+    return err_info;
+}
+
 sr_error_info_t *
 sr_module_update_oper_diff(sr_conn_ctx_t *conn, const char *mod_name)
 {
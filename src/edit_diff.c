@@ -3195,27 +3195,120 @@ sr_edit_add_check_same_node_op(sr_session_ctx_t *session, const char *xpath, con
     return err_info;
 }
 
-sr_error_info_t *
-sr_edit_add(sr_session_ctx_t *session, const char *xpath, const char *value, const char *operation,
-        const char *def_operation, const sr_move_position_t *position, const char *keys, const char *val, const char *origin)
+/**
+ * @brief Find the change node in a subtree created for its path. Only the nodes on the path
+ * and the keys of list instances are created.
+ *
+ * @param[in] first First (top-level) created node.
+ * @param[in] xpath Absolute XPath of the change node.
+ * @return Change node.
+ */
+static struct lyd_node *
+sr_edit_created_node(struct lyd_node *first, const char *xpath)
+{
+    struct lyd_node *node, *child;
+    const char *name = NULL, *ptr;
+    uint32_t depth = 0, levels, predicate = 0;
+    size_t name_len;
+    char quoted = 0;
+
+    /* learn the depth and the name of the change node */
+    for (ptr = xpath; ptr[0]; ++ptr) {
+        if (quoted) {
+            if (ptr[0] == quoted) {
+                quoted = 0;
+            }
+        } else if (ptr[0] == '[') {
+            ++predicate;
+        } else if (ptr[0] == ']') {
+            --predicate;
+        } else if ((ptr[0] == '\'') || (ptr[0] == '\"')) {
+            quoted = ptr[0];
+        } else if ((ptr[0] == '/') && !predicate) {
+            ++depth;
+            name = ptr + 1;
+        } else if ((ptr[0] == ':') && !predicate) {
+            name = ptr + 1;
+        }
+    }
+    assert(name);
+    name_len = strcspn(name, "[");
+
+    levels = depth;
+    for (node = first; node; node = node->parent) {
+        --levels;
+    }
+
+    /* go down the created nodes */
+    node = first;
+    for (; levels; --levels) {
+        child = sr_lyd_child(node, 1);
+        if (!child) {
+            /* the change node is a key of the created list instance */
+            assert(levels == 1);
+            for (child = node->child; strncmp(child->schema->name, name, name_len) || child->schema->name[name_len];
+                    child = child->next);
+        }
+        node = child;
+    }
+
+    return node;
+}
+
+/**
+ * @brief Add change into sysrepo edit, optionally relative to an existing edit node.
+ *
+ * @param[in] session Session to use.
+ * @param[in] ctx_node Existing edit node \p path is relative to, NULL for absolute \p path.
+ * @param[in] path Path of the change node, relative to \p ctx_node if set.
+ * @param[in] xpath Absolute XPath of the change node.
+ * @param[in] value Value of the change node.
+ * @param[in] operation Operation of the change node.
+ * @param[in] def_operation Default operation of the change.
+ * @param[in] position Optional position of the change node.
+ * @param[in] keys Optional relative list instance keys predicate for move change.
+ * @param[in] val Optional relative leaf-list value for move change.
+ * @param[in] origin Origin of the value, used only for ::SR_DS_OPERATIONAL.
+ * @param[in] validate Whether to validate the whole edit after the change was added.
+ * @param[out] node_p Optional created change node, NULL if the same change already existed.
+ * @param[out] first_p Optional first (top-level) node created for the change, NULL if the same change already
+ * existed. If set, only the created nodes are freed on error and the rest of the edit is kept.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_edit_add_node(sr_session_ctx_t *session, struct lyd_node *ctx_node, const char *path, const char *xpath,
+        const char *value, const char *operation, const char *def_operation, const sr_move_position_t *position,
+        const char *keys, const char *val, const char *origin, int validate, struct lyd_node **node_p,
+        struct lyd_node **first_p)
 {
     sr_error_info_t *err_info = NULL;
-    struct lyd_node *node, *sibling, *parent;
+    struct lyd_node *node, *new_node, *first, *sibling, *parent;
     const char *attr_val, *def_origin;
     enum edit_op op;
     int opts, own_oper, next_iter_oper;
 
+    if (node_p) {
+        *node_p = NULL;
+    }
+    if (first_p) {
+        *first_p = NULL;
+    }
+
     /* merge the change into existing edit */
-    opts = LYD_PATH_OPT_NOPARENTRET | (!strcmp(operation, "remove") || !strcmp(operation, "delete") ? LYD_PATH_OPT_EDIT : 0);
-    node = lyd_new_path(session->dt[session->ds].edit, session->conn->ly_ctx, xpath, (void *)value, 0, opts);
-    if (!node) {
+    opts = !strcmp(operation, "remove") || !strcmp(operation, "delete") ? LYD_PATH_OPT_EDIT : 0;
+    first = lyd_new_path(ctx_node ? ctx_node : session->dt[session->ds].edit, session->conn->ly_ctx, path,
+            (void *)value, 0, opts);
+    if (!first) {
         /* check whether it is an error */
+        node = NULL;
         if ((err_info = sr_edit_add_check_same_node_op(session, xpath, value, sr_edit_str2op(operation)))) {
             goto error;
         }
         /* node with the same operation already exists, silently ignore */
         return NULL;
     }
+    node = sr_edit_created_node(first, xpath);
+    new_node = node;
 
     /* check arguments */
     if (position) {
@@ -3360,9 +3453,9 @@ sr_edit_add(sr_session_ctx_t *session, const char *xpath, const char *value, con
         }
     }
 
-   if (SR_IS_CONVENTIONAL_DS(session->ds)) {
+    if (SR_IS_CONVENTIONAL_DS(session->ds)) {
         /* validate (only configuration datastores) */
-        if (lyd_validate(&session->dt[session->ds].edit, LYD_OPT_EDIT, NULL)) {
+        if (validate && lyd_validate(&session->dt[session->ds].edit, LYD_OPT_EDIT, NULL)) {
             sr_errinfo_new_ly(&err_info, session->conn->ly_ctx);
             sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Invalid datastore edit.");
             goto error;
@@ -3374,9 +3467,26 @@ sr_edit_add(sr_session_ctx_t *session, const char *xpath, const char *value, con
         }
     }
 
+    if (node_p) {
+        *node_p = new_node;
+    }
+    if (first_p) {
+        *first_p = first;
+    }
     return NULL;
 
 error:
+    if (first_p) {
+        /* free only the created nodes */
+        if (node) {
+            if (session->dt[session->ds].edit == first) {
+                session->dt[session->ds].edit = first->next;
+            }
+            lyd_free(first);
+        }
+        return err_info;
+    }
+
     if (node) {
         while (node->parent) {
             node = node->parent;
@@ -3391,6 +3501,558 @@ error:
     return err_info;
 }
 
+sr_error_info_t *
+sr_edit_add(sr_session_ctx_t *session, const char *xpath, const char *value, const char *operation,
+        const char *def_operation, const sr_move_position_t *position, const char *keys, const char *val, const char *origin)
+{
+    return sr_edit_add_node(session, NULL, xpath, xpath, value, operation, def_operation, position, keys, val, origin,
+            1, NULL, NULL);
+}
+
+/**
+ * @brief Learn how many leading nodes 2 simple paths have in common.
+ *
+ * @param[in] path1 First path.
+ * @param[in] path2 Second path.
+ * @param[out] rel_path2 Remainder of \p path2 relative to the last common node, if any.
+ * @return Number of common nodes.
+ */
+static uint32_t
+sr_edit_path_common_nodes(const char *path1, const char *path2, const char **rel_path2)
+{
+    uint32_t i, common = 0, predicate = 0;
+    char quoted = 0;
+
+    *rel_path2 = NULL;
+
+    for (i = 0; path1[i] && (path1[i] == path2[i]); ++i) {
+        if (quoted) {
+            if (path1[i] == quoted) {
+                quoted = 0;
+            }
+            continue;
+        }
+
+        switch (path1[i]) {
+        case '[':
+            ++predicate;
+            break;
+        case ']':
+            --predicate;
+            break;
+        case '\'':
+        case '\"':
+            quoted = path1[i];
+            break;
+        case '/':
+            if (!predicate && i) {
+                /* all the previous nodes are the same */
+                ++common;
+                *rel_path2 = path2 + i + 1;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (!path1[i] && (path2[i] == '/') && !predicate && !quoted) {
+        /* the whole path1 is a prefix of path2 */
+        ++common;
+        *rel_path2 = path2 + i + 1;
+    }
+
+    return common;
+}
+
+/**
+ * @brief Learn the number of nodes of a simple path.
+ *
+ * @param[in] path Path to examine.
+ * @return Number of path nodes.
+ */
+static uint32_t
+sr_edit_path_node_count(const char *path)
+{
+    uint32_t count = 0, predicate = 0;
+    char quoted = 0;
+    const char *ptr;
+
+    for (ptr = path; ptr[0]; ++ptr) {
+        if (quoted) {
+            if (ptr[0] == quoted) {
+                quoted = 0;
+            }
+        } else if (ptr[0] == '[') {
+            ++predicate;
+        } else if (ptr[0] == ']') {
+            --predicate;
+        } else if ((ptr[0] == '\'') || (ptr[0] == '\"')) {
+            quoted = ptr[0];
+        } else if ((ptr[0] == '/') && !predicate) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+sr_error_info_t *
+sr_edit_add_bulk(sr_session_ctx_t *session, const sr_edit_entry_t *entries, size_t entry_cnt, const char *origin)
+{
+    sr_error_info_t *err_info = NULL;
+    struct lyd_node *prev_node = NULL, *ctx_node, **created, *first;
+    const char *prev_xpath = NULL, *path, *operation, *def_operation;
+    uint32_t prev_depth = 0, depth, common, up;
+    size_t i, created_cnt = 0;
+
+    /* remember the nodes created by this call to be able to remove them on error */
+    created = malloc(entry_cnt * sizeof *created);
+    SR_CHECK_MEM_RET(entry_cnt && !created, err_info);
+
+    for (i = 0; i < entry_cnt; ++i) {
+        if (entries[i].del) {
+            operation = entries[i].opts & SR_EDIT_STRICT ? "delete" : "remove";
+            def_operation = entries[i].opts & SR_EDIT_STRICT ? "none" : "ether";
+        } else {
+            operation = entries[i].opts & SR_EDIT_STRICT ? "create" : "merge";
+            def_operation = entries[i].opts & SR_EDIT_NON_RECURSIVE ? "none" : "merge";
+        }
+
+        depth = sr_edit_path_node_count(entries[i].xpath);
+
+        /* reuse the node of the previous change for the common path prefix, if possible */
+        ctx_node = NULL;
+        path = entries[i].xpath;
+        if (prev_node) {
+            common = sr_edit_path_common_nodes(prev_xpath, entries[i].xpath, &path);
+            if (common && (common < depth) && (common <= prev_depth)) {
+                ctx_node = prev_node;
+                for (up = prev_depth - common; up; --up) {
+                    ctx_node = ctx_node->parent;
+                }
+            } else {
+                path = entries[i].xpath;
+            }
+        }
+
+        /* add the change without validation, the whole edit is validated once at the end */
+        if ((err_info = sr_edit_add_node(session, ctx_node, path, entries[i].xpath,
+                entries[i].del ? NULL : entries[i].value, operation, def_operation, NULL, NULL, NULL,
+                entries[i].del ? NULL : origin, 0, &prev_node, &first))) {
+            /* nodes of this change were freed */
+            goto cleanup;
+        }
+        if (first) {
+            created[created_cnt++] = first;
+        }
+        prev_xpath = entries[i].xpath;
+        prev_depth = depth;
+    }
+
+    if (SR_IS_CONVENTIONAL_DS(session->ds) && session->dt[session->ds].edit) {
+        if (lyd_validate(&session->dt[session->ds].edit, LYD_OPT_EDIT, NULL)) {
+            sr_errinfo_new_ly(&err_info, session->conn->ly_ctx);
+            sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Invalid datastore edit.");
+            goto cleanup;
+        }
+    }
+
+cleanup:
+    if (err_info) {
+        /* remove the created nodes, the later ones may be in the subtrees of the previous ones */
+        for (i = created_cnt; i; --i) {
+            if (session->dt[session->ds].edit == created[i - 1]) {
+                session->dt[session->ds].edit = created[i - 1]->next;
+            }
+            lyd_free(created[i - 1]);
+        }
+    }
+    free(created);
+    return err_info;
+}
+
+/**
+ * @brief Hash a diff node pointer.
+ *
+ * @param[in] node Diff node.
+ * @return Pointer hash.
+ */
+static uint32_t
+sr_diff_view_hash(const struct lyd_node *node)
+{
+    uint64_t hash = (uintptr_t)node;
+
+    hash *= UINT64_C(0x9E3779B97F4A7C15);
+    return (uint32_t)(hash >> 32);
+}
+
+/**
+ * @brief Add a diff node into a diff view, if not there already.
+ *
+ * @param[in] diff_view Diff view with a hash table large enough.
+ * @param[in] node Diff node to add.
+ * @return 0 if the node was added, 1 if it already was in the view.
+ */
+static int
+sr_diff_view_add(struct sr_diff_view_s *diff_view, const struct lyd_node *node)
+{
+    uint32_t i;
+
+    for (i = sr_diff_view_hash(node) & (diff_view->size - 1); diff_view->nodes[i]; i = (i + 1) & (diff_view->size - 1)) {
+        if (diff_view->nodes[i] == node) {
+            return 1;
+        }
+    }
+
+    diff_view->nodes[i] = node;
+    ++diff_view->count;
+    return 0;
+}
+
+/**
+ * @brief Add list keys of a diff node into a diff view.
+ *
+ * @param[in] diff_view Diff view.
+ * @param[in] node Diff node.
+ */
+static void
+sr_diff_view_add_keys(struct sr_diff_view_s *diff_view, const struct lyd_node *node)
+{
+    const struct lyd_node *key;
+
+    if (node->schema->nodetype != LYS_LIST) {
+        return;
+    }
+
+    for (key = node->child; key && lys_is_key((struct lys_node_leaf *)key->schema, NULL); key = key->next) {
+        sr_diff_view_add(diff_view, key);
+    }
+}
+
+sr_error_info_t *
+sr_diff_view_new(const struct lyd_node *diff, const char *xpath, struct sr_diff_view_s **diff_view)
+{
+    sr_error_info_t *err_info = NULL;
+    struct ly_set *set;
+    const struct lyd_node *next, *elem, *parent;
+    uint32_t i, count = 0;
+
+    *diff_view = NULL;
+
+    set = lyd_find_path(diff, xpath);
+    if (!set) {
+        sr_errinfo_new_ly(&err_info, lyd_node_module(diff)->ctx);
+        return err_info;
+    }
+
+    /* learn the maximum count of visible nodes */
+    for (i = 0; i < set->number; ++i) {
+        LY_TREE_DFS_BEGIN(set->set.d[i], next, elem) {
+            ++count;
+            LY_TREE_DFS_END(set->set.d[i], next, elem);
+        }
+        for (parent = set->set.d[i]->parent; parent; parent = parent->parent) {
+            count += (parent->schema->nodetype == LYS_LIST) ? ((struct lys_node_list *)parent->schema)->keys_size + 1 : 1;
+        }
+    }
+
+    *diff_view = calloc(1, sizeof **diff_view);
+    SR_CHECK_MEM_GOTO(!*diff_view, err_info, cleanup);
+
+    /* at most half full */
+    for ((*diff_view)->size = 8; (*diff_view)->size < count * 2; (*diff_view)->size *= 2);
+    (*diff_view)->nodes = calloc((*diff_view)->size, sizeof *(*diff_view)->nodes);
+    SR_CHECK_MEM_GOTO(!(*diff_view)->nodes, err_info, cleanup);
+
+    for (i = 0; i < set->number; ++i) {
+        /* the whole selected subtree */
+        LY_TREE_DFS_BEGIN(set->set.d[i], next, elem) {
+            sr_diff_view_add(*diff_view, elem);
+            LY_TREE_DFS_END(set->set.d[i], next, elem);
+        }
+
+        /* all the parents with their keys, until a parent already in the view, which has them all */
+        for (parent = set->set.d[i]->parent; parent && !sr_diff_view_add(*diff_view, parent); parent = parent->parent) {
+            sr_diff_view_add_keys(*diff_view, parent);
+        }
+    }
+
+cleanup:
+    ly_set_free(set);
+    if (err_info) {
+        sr_diff_view_free(*diff_view);
+        *diff_view = NULL;
+    }
+    return err_info;
+}
+
+void
+sr_diff_view_free(struct sr_diff_view_s *diff_view)
+{
+    if (!diff_view) {
+        return;
+    }
+
+    free(diff_view->nodes);
+    free(diff_view);
+}
+
+int
+sr_diff_view_contains(const struct sr_diff_view_s *diff_view, const struct lyd_node *node)
+{
+    uint32_t i;
+
+    if (!diff_view->count) {
+        return 0;
+    }
+
+    for (i = sr_diff_view_hash(node) & (diff_view->size - 1); diff_view->nodes[i]; i = (i + 1) & (diff_view->size - 1)) {
+        if (diff_view->nodes[i] == node) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void
+sr_diff_view_filter(const struct sr_diff_view_s *diff_view, struct ly_set *set)
+{
+    uint32_t i, j;
+
+    for (i = 0, j = 0; i < set->number; ++i) {
+        if (sr_diff_view_contains(diff_view, set->set.d[i])) {
+            set->set.d[j] = set->set.d[i];
+            ++j;
+        }
+    }
+    set->number = j;
+}
+
+/**
+ * @brief Compare 2 diff index schema node items, sort them by their schema nodes and then by document order.
+ *
+ * @param[in] ptr1 First item.
+ * @param[in] ptr2 Second item.
+ * @return Standard qsort() comparison result.
+ */
+static int
+sr_diff_index_schema_cmp(const void *ptr1, const void *ptr2)
+{
+    const struct sr_diff_idx_snode_s *snode1 = ptr1, *snode2 = ptr2;
+
+    if (snode1->schema != snode2->schema) {
+        return ((uintptr_t)snode1->schema < (uintptr_t)snode2->schema) ? -1 : 1;
+    }
+    return (snode1->idx < snode2->idx) ? -1 : (snode1->idx > snode2->idx);
+}
+
+sr_error_info_t *
+sr_diff_index(const struct lyd_node *diff, const struct sr_diff_view_s *diff_view, struct sr_diff_idx_s **diff_idx)
+{
+    sr_error_info_t *err_info = NULL;
+    const struct lyd_node *root, *next, *elem;
+    struct sr_diff_idx_s *idx;
+    uint32_t size, top, next_top;
+    void *mem;
+
+    if (!*diff_idx) {
+        *diff_idx = calloc(1, sizeof **diff_idx);
+        SR_CHECK_MEM_RET(!*diff_idx, err_info);
+    }
+    idx = *diff_idx;
+    idx->count = 0;
+    idx->indexed = 0;
+
+    /* all the nodes in document order, same as a "//." XPath would select; until their subtree is finished,
+     * the end of the nodes is used to link each node to its parent forming a stack of the current ancestors */
+    top = UINT32_MAX;
+    LY_TREE_FOR(diff, root) {
+        LY_TREE_DFS_BEGIN(root, next, elem) {
+            if (diff_view && !sr_diff_view_contains(diff_view, elem)) {
+                /* not part of the view */
+                goto next_elem;
+            }
+
+            if (idx->count == idx->size) {
+                size = idx->size ? idx->size * 2 : 32;
+                mem = realloc(idx->nodes, size * sizeof *idx->nodes);
+                SR_CHECK_MEM_GOTO(!mem, err_info, error);
+                idx->nodes = mem;
+                mem = realloc(idx->schema_nodes, size * sizeof *idx->schema_nodes);
+                SR_CHECK_MEM_GOTO(!mem, err_info, error);
+                idx->schema_nodes = mem;
+                idx->size = size;
+            }
+
+            /* finish the subtrees of all the nodes that are not ancestors of this node, parents of visible
+             * nodes are always visible */
+            while ((top != UINT32_MAX) && (idx->nodes[top].node != elem->parent)) {
+                next_top = idx->nodes[top].end;
+                idx->nodes[top].end = idx->count;
+                top = next_top;
+            }
+
+            idx->nodes[idx->count].node = (struct lyd_node *)elem;
+            idx->nodes[idx->count].end = top;
+            idx->schema_nodes[idx->count].schema = elem->schema;
+            idx->schema_nodes[idx->count].idx = idx->count;
+            top = idx->count;
+            ++idx->count;
+
+next_elem:
+            LY_TREE_DFS_END(root, next, elem);
+        }
+    }
+
+    /* finish the remaining subtrees */
+    while (top != UINT32_MAX) {
+        next_top = idx->nodes[top].end;
+        idx->nodes[top].end = idx->count;
+        top = next_top;
+    }
+
+    /* sort the nodes by their schema nodes */
+    qsort(idx->schema_nodes, idx->count, sizeof *idx->schema_nodes, sr_diff_index_schema_cmp);
+
+    idx->indexed = 1;
+    return NULL;
+
+error:
+    idx->count = 0;
+    return err_info;
+}
+
+void
+sr_diff_index_free(struct sr_diff_idx_s *diff_idx)
+{
+    if (!diff_idx) {
+        return;
+    }
+
+    free(diff_idx->nodes);
+    free(diff_idx->schema_nodes);
+    free(diff_idx);
+}
+
+/**
+ * @brief Add diff nodes from an index into a set.
+ *
+ * @param[in] diff_idx Diff index.
+ * @param[in] i Index of the first node to add.
+ * @param[in] descendants Whether to add all the descendants of the node, too.
+ * @param[in] set Set to add to.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_diff_index_add(const struct sr_diff_idx_s *diff_idx, uint32_t i, int descendants, struct ly_set *set)
+{
+    sr_error_info_t *err_info = NULL;
+    uint32_t end;
+
+    end = descendants ? diff_idx->nodes[i].end : i + 1;
+    for (; i < end; ++i) {
+        if (ly_set_add(set, diff_idx->nodes[i].node, LY_SET_OPT_USEASLIST) == -1) {
+            sr_errinfo_new_ly(&err_info, lyd_node_module(diff_idx->nodes[i].node)->ctx);
+            return err_info;
+        }
+    }
+
+    return NULL;
+}
+
+sr_error_info_t *
+sr_diff_index_find(const struct sr_diff_idx_s *diff_idx, struct ly_ctx *ly_ctx, const char *xpath, struct ly_set **set)
+{
+    sr_error_info_t *err_info = NULL;
+    const struct lys_module *ly_mod = NULL;
+    const struct lys_node *snode = NULL;
+    char *path = NULL, *mod_name;
+    size_t len;
+    int descendants = 0;
+    uint32_t i, lo, hi, mid;
+
+    *set = NULL;
+
+    /* only simple schema paths without any predicates can be used */
+    if ((xpath[0] != '/') || (xpath[1] == '/') || strpbrk(xpath, "[]()|=@ ")) {
+        return NULL;
+    }
+
+    len = strlen(xpath);
+    if ((len > 3) && !strcmp(xpath + len - 3, "//.")) {
+        /* the nodes with all their descendants */
+        descendants = 1;
+        len -= 3;
+    }
+    if (strstr(xpath, "//") != (descendants ? xpath + len : NULL)) {
+        return NULL;
+    }
+
+    path = strndup(xpath, len);
+    SR_CHECK_MEM_RET(!path, err_info);
+
+    if ((len > 2) && !strcmp(path + len - 2, ":*") && !strchr(path + 1, '/')) {
+        /* all the top-level nodes of a module */
+        path[len - 2] = '\0';
+        mod_name = path + 1;
+        ly_mod = ly_ctx_get_module(ly_ctx, mod_name, NULL, 1);
+        if (!ly_mod) {
+            /* fallback to XPath evaluation to get a proper error */
+            goto cleanup;
+        }
+    } else if (strchr(path, '*')) {
+        goto cleanup;
+    } else {
+        snode = ly_ctx_get_node(ly_ctx, NULL, path, 0);
+        if (!snode) {
+            ly_err_clean(ly_ctx, NULL);
+            goto cleanup;
+        }
+    }
+
+    *set = ly_set_new();
+    SR_CHECK_MEM_GOTO(!*set, err_info, cleanup);
+
+    if (ly_mod) {
+        /* top-level nodes, skip their subtrees */
+        for (i = 0; i < diff_idx->count; i = diff_idx->nodes[i].end) {
+            if ((lyd_node_module(diff_idx->nodes[i].node) == ly_mod)
+                    && (err_info = sr_diff_index_add(diff_idx, i, descendants, *set))) {
+                goto cleanup;
+            }
+        }
+    } else {
+        /* find the first node of the schema node */
+        lo = 0;
+        hi = diff_idx->count;
+        while (lo < hi) {
+            mid = lo + (hi - lo) / 2;
+            if ((uintptr_t)diff_idx->schema_nodes[mid].schema < (uintptr_t)snode) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        /* all the nodes of the schema node in document order, their subtrees cannot overlap */
+        for (i = lo; (i < diff_idx->count) && (diff_idx->schema_nodes[i].schema == snode); ++i) {
+            if ((err_info = sr_diff_index_add(diff_idx, diff_idx->schema_nodes[i].idx, descendants, *set))) {
+                goto cleanup;
+            }
+        }
+    }
+
+cleanup:
+    free(path);
+    if (err_info) {
+        ly_set_free(*set);
+        *set = NULL;
+    }
+    return err_info;
+}
+
 sr_error_info_t *
 sr_diff_set_getnext(struct ly_set *set, uint32_t *idx, struct lyd_node **node, sr_change_oper_t *op)
 {
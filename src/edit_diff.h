@@ -160,6 +160,88 @@ sr_error_info_t *sr_diff_ly2sr(struct lyd_difflist *ly_diff, struct lyd_node **d
 sr_error_info_t *sr_edit_add(sr_session_ctx_t *session, const char *xpath, const char *value, const char *operation,
         const char *def_operation, const sr_move_position_t *position, const char *keys, const char *val, const char *origin);
 
+/**
+ * @brief Add several changes into sysrepo edit at once. Consecutive changes with a common path prefix
+ * reuse the already created edit nodes and the whole edit is validated only once. On error, only the edit
+ * nodes created by this call are removed.
+ *
+ * @param[in] session Session to use.
+ * @param[in] entries Array of changes.
+ * @param[in] entry_cnt Count of \p entries.
+ * @param[in] origin Origin of the values, used only for ::SR_DS_OPERATIONAL.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_edit_add_bulk(sr_session_ctx_t *session, const sr_edit_entry_t *entries, size_t entry_cnt,
+        const char *origin);
+
+/**
+ * @brief Create a view of a diff. The view consists of the selected subtrees with all their parents
+ * (and their list keys), same as if they were duplicated. All the visible nodes are hashed so that
+ * checking a node is in constant time.
+ *
+ * @param[in] diff Diff to create the view of.
+ * @param[in] xpath XPath selecting the subtrees.
+ * @param[out] diff_view Created diff view, with no nodes if \p xpath selected nothing.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_diff_view_new(const struct lyd_node *diff, const char *xpath, struct sr_diff_view_s **diff_view);
+
+/**
+ * @brief Free a diff view.
+ *
+ * @param[in] diff_view Diff view to free.
+ */
+void sr_diff_view_free(struct sr_diff_view_s *diff_view);
+
+/**
+ * @brief Learn whether a diff node is part of a diff view.
+ *
+ * @param[in] diff_view Diff view.
+ * @param[in] node Diff node to check.
+ * @return non-zero if the node is visible, 0 otherwise.
+ */
+int sr_diff_view_contains(const struct sr_diff_view_s *diff_view, const struct lyd_node *node);
+
+/**
+ * @brief Remove all the diff nodes not part of a diff view from a set, keeping their order.
+ *
+ * @param[in] diff_view Diff view.
+ * @param[in,out] set Set of diff nodes to filter.
+ */
+void sr_diff_view_filter(const struct sr_diff_view_s *diff_view, struct ly_set *set);
+
+/**
+ * @brief Create an index of a sysrepo diff, which can be used for repeated change selection
+ * without XPath evaluation. The diff nodes are indexed by their schema nodes.
+ *
+ * @param[in] diff Diff to index.
+ * @param[in] diff_view Optional view of the diff, only its nodes are indexed.
+ * @param[in,out] diff_idx Diff index. If it exists (is not indexed), its memory is reused.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_diff_index(const struct lyd_node *diff, const struct sr_diff_view_s *diff_view,
+        struct sr_diff_idx_s **diff_idx);
+
+/**
+ * @brief Free a diff index.
+ *
+ * @param[in] diff_idx Diff index to free.
+ */
+void sr_diff_index_free(struct sr_diff_idx_s *diff_idx);
+
+/**
+ * @brief Select changes from an indexed sysrepo diff. Only simple paths (without predicates),
+ * possibly selecting all the descendants (ending with `//.`), are supported.
+ *
+ * @param[in] diff_idx Diff index.
+ * @param[in] ly_ctx libyang context.
+ * @param[in] xpath XPath selecting the changes.
+ * @param[out] set Selected diff nodes, same as XPath evaluation would return. NULL if \p xpath is not supported.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_diff_index_find(const struct sr_diff_idx_s *diff_idx, struct ly_ctx *ly_ctx, const char *xpath,
+        struct ly_set **set);
+
 /**
  * @brief Get next change from a sysrepo diff set.
  *
@@ -31,6 +31,7 @@
 #include <signal.h>
 #include <getopt.h>
 #include <pthread.h>
+#include <time.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -41,6 +42,9 @@
 #include "sysrepo.h"
 #include "bin_common.h"
 
+/** default number of threads handling events of all the plugin subscriptions */
+#define SRPD_DISPATCH_THREADS 2
+
 /** protected flag for terminating sysrepo-plugind */
 int loop_finish;
 pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
@@ -48,11 +52,23 @@ pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
 
 struct srpd_plugin_s {
     void *handle;
+    char *name;
     srp_init_cb_t init_cb;
     srp_cleanup_cb_t cleanup_cb;
+    sr_session_ctx_t *sess;
     void *private_data;
 };
 
+/** context shared by the threads initializing plugins in parallel */
+struct srpd_init_s {
+    sr_conn_ctx_t *conn;
+    struct srpd_plugin_s *plugins;
+    int plugin_count;
+    int next;
+    int failed;
+    pthread_mutex_t lock;
+};
+
 static void
 version_print(void)
 {
@@ -68,7 +84,7 @@ help_print(void)
 {
     printf(
         "Usage:\n"
-        "  sysrepo-plugind [-h] [-v <level>] [-d]\n"
+        "  sysrepo-plugind [-h] [-v <level>] [-d] [-t <count>] [-i <count>]\n"
         "\n"
         "Options:\n"
         "  -h, --help           Prints usage help.\n"
@@ -76,9 +92,17 @@ help_print(void)
         "  -v, --verbosity <level>\n"
         "                       Change verbosity to a level (none, error, warning, info, debug) or number (0, 1, 2, 3, 4).\n"
         "  -d, --debug          Debug mode - is not daemonized and logs to stderr instead of syslog.\n"
+        "  -t, --threads <count>\n"
+        "                       Number of threads handling events of all the plugin subscriptions (default %u),\n"
+        "                       0 for a separate thread for each subscription. More threads are added while all\n"
+        "                       of them are busy so that callbacks can wait for other plugin subscriptions.\n"
+        "  -i, --init-threads <count>\n"
+        "                       Number of threads initializing the plugins in parallel, each plugin on its own session\n"
+        "                       (default 0 - sequentially on a single session). Use only for independent plugins.\n"
         "\n"
         "Environment variable $SRPD_PLUGINS_PATH overwrites the default plugins path.\n"
-        "\n"
+        "\n",
+        SRPD_DISPATCH_THREADS
     );
 }
 
@@ -279,7 +303,15 @@ load_plugins(struct srpd_plugin_s **plugins, int *plugin_count)
         }
 
         /* finally store the plugin */
+        (*plugins)[*plugin_count].name = strdup(ent->d_name);
+        if (!(*plugins)[*plugin_count].name) {
+            error_print(0, "strdup() failed (%s).", strerror(errno));
+            dlclose(handle);
+            rc = -1;
+            break;
+        }
         (*plugins)[*plugin_count].handle = handle;
+        (*plugins)[*plugin_count].sess = NULL;
         (*plugins)[*plugin_count].private_data = NULL;
         ++(*plugin_count);
     }
@@ -288,6 +320,103 @@ load_plugins(struct srpd_plugin_s **plugins, int *plugin_count)
     return rc;
 }
 
+static long
+time_diff_ms(const struct timespec *ts_start, const struct timespec *ts_end)
+{
+    return (ts_end->tv_sec - ts_start->tv_sec) * 1000 + (ts_end->tv_nsec - ts_start->tv_nsec) / 1000000;
+}
+
+static int
+init_plugin(struct srpd_plugin_s *plugin)
+{
+    struct timespec ts_start, ts_end;
+    int r;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts_start);
+    r = plugin->init_cb(plugin->sess, &plugin->private_data);
+    clock_gettime(CLOCK_MONOTONIC, &ts_end);
+
+    if (r != SR_ERR_OK) {
+        SRP_LOG_ERR("Plugin \"%s\" initialization failed (%s).", plugin->name, sr_strerror(r));
+        return -1;
+    }
+
+    SRP_LOG_INF("Plugin \"%s\" initialized in %ld ms.", plugin->name, time_diff_ms(&ts_start, &ts_end));
+    return 0;
+}
+
+static void *
+init_plugins_thread(void *arg)
+{
+    struct srpd_init_s *init = (struct srpd_init_s *)arg;
+    struct srpd_plugin_s *plugin;
+    int r;
+
+    while (1) {
+        /* get the next plugin to initialize */
+        pthread_mutex_lock(&init->lock);
+        if (init->failed || (init->next == init->plugin_count)) {
+            pthread_mutex_unlock(&init->lock);
+            break;
+        }
+        plugin = &init->plugins[init->next];
+        ++init->next;
+        pthread_mutex_unlock(&init->lock);
+
+        /* initialize it on its own session */
+        if ((r = sr_session_start(init->conn, SR_DS_RUNNING, &plugin->sess)) != SR_ERR_OK) {
+            SRP_LOG_ERR("Failed to start new session for plugin \"%s\" (%s).", plugin->name, sr_strerror(r));
+        }
+        if (r || init_plugin(plugin)) {
+            pthread_mutex_lock(&init->lock);
+            init->failed = 1;
+            pthread_mutex_unlock(&init->lock);
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static int
+init_plugins_parallel(sr_conn_ctx_t *conn, struct srpd_plugin_s *plugins, int plugin_count, uint32_t init_thread_count)
+{
+    struct srpd_init_s init = {conn, plugins, plugin_count, 0, 0, PTHREAD_MUTEX_INITIALIZER};
+    pthread_t *tids;
+    uint32_t i, count = 0;
+    int r;
+
+    if (init_thread_count > (uint32_t)plugin_count) {
+        init_thread_count = plugin_count;
+    }
+
+    tids = malloc(init_thread_count * sizeof *tids);
+    if (!tids) {
+        SRP_LOG_ERR("malloc() failed (%s).", strerror(errno));
+        return -1;
+    }
+
+    for (i = 0; i < init_thread_count; ++i) {
+        if ((r = pthread_create(&tids[i], NULL, init_plugins_thread, &init))) {
+            SRP_LOG_ERR("Creating a new thread failed (%s).", strerror(r));
+            pthread_mutex_lock(&init.lock);
+            init.failed = 1;
+            pthread_mutex_unlock(&init.lock);
+            break;
+        }
+        ++count;
+    }
+
+    /* wait for all the plugins to be initialized */
+    for (i = 0; i < count; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    free(tids);
+    pthread_mutex_destroy(&init.lock);
+
+    return init.failed ? -1 : 0;
+}
+
 int
 main(int argc, char** argv)
 {
@@ -295,18 +424,23 @@ main(int argc, char** argv)
     sr_conn_ctx_t *conn = NULL;
     sr_session_ctx_t *sess = NULL;
     sr_log_level_t log_level = SR_LL_ERR;
-    int plugin_count = 0, i, r, rc = EXIT_FAILURE, opt, debug = 0;
+    int plugin_count = 0, i, r, rc = EXIT_FAILURE, opt, debug = 0, dispatcher = 0;
+    uint32_t thread_count = SRPD_DISPATCH_THREADS, init_thread_count = 0;
+    struct timespec ts_start, ts_end;
+    char *ptr;
     struct option options[] = {
         {"help",      no_argument,       NULL, 'h'},
         {"version",   no_argument,       NULL, 'V'},
         {"verbosity", required_argument, NULL, 'v'},
         {"debug",     no_argument,       NULL, 'd'},
+        {"threads",   required_argument, NULL, 't'},
+        {"init-threads", required_argument, NULL, 'i'},
         {NULL,        0,                 NULL, 0},
     };
 
     /* process options */
     opterr = 0;
-    while ((opt = getopt_long(argc, argv, "hVv:d", options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "hVv:dt:i:", options, NULL)) != -1) {
         switch (opt) {
         case 'h':
             version_print();
@@ -338,6 +472,20 @@ main(int argc, char** argv)
         case 'd':
             debug = 1;
             break;
+        case 't':
+            thread_count = strtoul(optarg, &ptr, 10);
+            if (!optarg[0] || ptr[0]) {
+                error_print(0, "Invalid thread count \"%s\"", optarg);
+                goto cleanup;
+            }
+            break;
+        case 'i':
+            init_thread_count = strtoul(optarg, &ptr, 10);
+            if (!optarg[0] || ptr[0]) {
+                error_print(0, "Invalid init thread count \"%s\"", optarg);
+                goto cleanup;
+            }
+            break;
         default:
             error_print(0, "Invalid option or missing argument: -%c", optopt);
             goto cleanup;
@@ -364,20 +512,37 @@ main(int argc, char** argv)
         goto cleanup;
     }
 
-    /* create session */
-    if ((r = sr_session_start(conn, SR_DS_RUNNING, &sess)) != SR_ERR_OK) {
-        error_print(r, "Failed to start new session");
-        goto cleanup;
+    /* handle events of all the plugin subscriptions by a few shared threads */
+    if (thread_count) {
+        if ((r = sr_dispatcher_start(thread_count)) != SR_ERR_OK) {
+            error_print(r, "Failed to start event dispatcher");
+            goto cleanup;
+        }
+        dispatcher = 1;
     }
 
     /* init plugins */
-    for (i = 0; i < plugin_count; ++i) {
-        r = plugins[i].init_cb(sess, &plugins[i].private_data);
-        if (r != SR_ERR_OK) {
-            SRP_LOG_ERR("Plugin initialization failed (%s).", sr_strerror(r));
+    clock_gettime(CLOCK_MONOTONIC, &ts_start);
+    if (init_thread_count && plugin_count) {
+        if (init_plugins_parallel(conn, plugins, plugin_count, init_thread_count)) {
             goto cleanup;
         }
+    } else {
+        /* create session */
+        if ((r = sr_session_start(conn, SR_DS_RUNNING, &sess)) != SR_ERR_OK) {
+            error_print(r, "Failed to start new session");
+            goto cleanup;
+        }
+
+        for (i = 0; i < plugin_count; ++i) {
+            plugins[i].sess = sess;
+            if (init_plugin(&plugins[i])) {
+                goto cleanup;
+            }
+        }
     }
+    clock_gettime(CLOCK_MONOTONIC, &ts_end);
+    SRP_LOG_INF("All %d plugins initialized in %ld ms.", plugin_count, time_diff_ms(&ts_start, &ts_end));
 
     /* wait for a terminating signal */
     pthread_mutex_lock(&lock);
@@ -388,7 +553,7 @@ main(int argc, char** argv)
 
     /* cleanup plugins */
     for (i = 0; i < plugin_count; ++i) {
-        plugins[i].cleanup_cb(sess, plugins[i].private_data);
+        plugins[i].cleanup_cb(plugins[i].sess, plugins[i].private_data);
     }
 
     /* success */
@@ -397,9 +562,14 @@ main(int argc, char** argv)
 cleanup:
     for (i = 0; i < plugin_count; ++i) {
         dlclose(plugins[i].handle);
+        free(plugins[i].name);
     }
     free(plugins);
 
+    /* unsubscribes all the remaining subscriptions */
     sr_disconnect(conn);
+    if (dispatcher) {
+        sr_dispatcher_stop();
+    }
     return rc;
 }
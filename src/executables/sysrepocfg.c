@@ -32,7 +32,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <ctype.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include <libyang/libyang.h>
 
@@ -87,6 +89,9 @@ help_print(void)
         "  -n, --not-strict             Silently ignore any unknown data (import, edit, rpc, notification, copy-from op).\n"
         "  -p, --depth <number>         Limit the depth of returned subtrees, 0 so unlimited by default (export op).\n"
         "  -v, --verbosity <level>      Change verbosity to a level (none, error, warning, info, debug) or number (0, 1, 2, 3, 4).\n"
+        "  -S, --stream                 Process the data module by module to limit memory use, only \"xml\" format is\n"
+        "                               supported and the import is no longer a single transaction (import, export op).\n"
+        "  -t, --threads <count>        Number of modules exported in parallel, 1 by default (export op with --stream).\n"
         "\n"
     );
 }
@@ -194,6 +199,35 @@ step_read_file(FILE *file, char **mem)
     return EXIT_SUCCESS;
 }
 
+static int
+step_learn_format(const char *file_path, LYD_FORMAT *format)
+{
+    const char *ptr;
+
+    if (*format != LYD_UNKNOWN) {
+        return EXIT_SUCCESS;
+    }
+
+    if (!file_path) {
+        error_print(0, "When reading data from STDIN, format must be specified");
+        return EXIT_FAILURE;
+    }
+
+    ptr = strrchr(file_path, '.');
+    if (ptr && !strcmp(ptr, ".xml")) {
+        *format = LYD_XML;
+    } else if (ptr && !strcmp(ptr, ".json")) {
+        *format = LYD_JSON;
+    } else if (ptr && !strcmp(ptr, ".lyb")) {
+        *format = LYD_LYB;
+    } else {
+        error_print(0, "Failed to detect format of \"%s\"", file_path);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
 static int
 step_load_data(sr_session_ctx_t *sess, const char *file_path, LYD_FORMAT format, int flags, struct lyd_node **data)
 {
@@ -203,23 +237,8 @@ step_load_data(sr_session_ctx_t *sess, const char *file_path, LYD_FORMAT format,
     ly_ctx = (struct ly_ctx *)sr_get_context(sr_session_get_connection(sess));
 
     /* learn format */
-    if (format == LYD_UNKNOWN) {
-        if (!file_path) {
-            error_print(0, "When reading data from STDIN, format must be specified");
-            return EXIT_FAILURE;
-        }
-
-        ptr = strrchr(file_path, '.');
-        if (ptr && !strcmp(ptr, ".xml")) {
-            format = LYD_XML;
-        } else if (ptr && !strcmp(ptr, ".json")) {
-            format = LYD_JSON;
-        } else if (ptr && !strcmp(ptr, ".lyb")) {
-            format = LYD_LYB;
-        } else {
-            error_print(0, "Failed to detect format of \"%s\"", file_path);
-            return EXIT_FAILURE;
-        }
+    if (step_learn_format(file_path, &format)) {
+        return EXIT_FAILURE;
     }
 
     /* do not validate candidate data */
@@ -348,6 +367,481 @@ op_export(sr_session_ctx_t *sess, const char *file_path, const char *module_name
     return EXIT_SUCCESS;
 }
 
+/* buffer holding a single top-level XML subtree */
+struct stream_buf {
+    char *mem;
+    size_t size;
+    size_t used;
+};
+
+/* pending data of a module being imported */
+struct stream_import_s {
+    sr_session_ctx_t *sess;
+    const struct lys_module *ly_mod;
+    struct lyd_node *data;
+    const struct lys_module **done_mods;
+    uint32_t done_count;
+};
+
+/* a module being exported */
+struct stream_export_s {
+    sr_session_ctx_t *sess;
+    const char *module_name;
+    uint32_t max_depth;
+    FILE *file;
+    pthread_t tid;
+    int threaded;
+    char *str;
+    int r;
+};
+
+static int
+stream_buf_add(struct stream_buf *buf, int c)
+{
+    void *mem;
+    size_t size;
+
+    /* keep space for the terminating zero */
+    if (buf->used + 1 >= buf->size) {
+        size = buf->size ? buf->size << 1 : 4096;
+        mem = realloc(buf->mem, size);
+        if (!mem) {
+            error_print(0, "Memory allocation failed");
+            return EXIT_FAILURE;
+        }
+        buf->mem = mem;
+        buf->size = size;
+    }
+
+    buf->mem[buf->used++] = c;
+    return EXIT_SUCCESS;
+}
+
+static int
+stream_read_until(FILE *file, struct stream_buf *buf, const char *end)
+{
+    size_t end_len = strlen(end), start = buf->used;
+    int c;
+
+    while ((buf->used - start < end_len) || strncmp(buf->mem + buf->used - end_len, end, end_len)) {
+        if ((c = getc(file)) == EOF) {
+            error_print(0, "Unexpected end of XML data");
+            return EXIT_FAILURE;
+        }
+        if (stream_buf_add(buf, c)) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* read the next top-level XML element with all its descendants, returns 1 on success, 0 on end of input, -1 on error */
+static int
+stream_read_xml_subtree(FILE *file, struct stream_buf *buf)
+{
+    int c, prev, quote, elem, depth = 0;
+
+    buf->used = 0;
+    while ((c = getc(file)) != EOF) {
+        if (c != '<') {
+            if (depth) {
+                /* text content */
+                if (stream_buf_add(buf, c)) {
+                    return -1;
+                }
+            } else if (!isspace(c)) {
+                error_print(0, "Unexpected character '%c' outside XML elements", c);
+                return -1;
+            }
+            continue;
+        }
+
+        if (stream_buf_add(buf, c) || ((c = getc(file)) == EOF) || stream_buf_add(buf, c)) {
+            error_print(0, "Unexpected end of XML data");
+            return -1;
+        }
+
+        elem = 0;
+        if (c == '?') {
+            /* processing instruction */
+            if (stream_read_until(file, buf, "?>")) {
+                return -1;
+            }
+        } else if (c == '!') {
+            /* comment, CDATA, or DOCTYPE */
+            if (((c = getc(file)) == EOF) || stream_buf_add(buf, c)) {
+                error_print(0, "Unexpected end of XML data");
+                return -1;
+            }
+            if (stream_read_until(file, buf, (c == '-') ? "-->" : ((c == '[') ? "]]>" : ">"))) {
+                return -1;
+            }
+        } else if (c == '/') {
+            /* closing tag */
+            if (!depth) {
+                error_print(0, "Unexpected closing tag outside XML elements");
+                return -1;
+            }
+            if (stream_read_until(file, buf, ">")) {
+                return -1;
+            }
+            --depth;
+            elem = 1;
+        } else {
+            /* opening tag, '>' may appear in attribute values */
+            quote = 0;
+            do {
+                prev = c;
+                if (((c = getc(file)) == EOF) || stream_buf_add(buf, c)) {
+                    error_print(0, "Unexpected end of XML data");
+                    return -1;
+                }
+                if (quote) {
+                    if (c == quote) {
+                        quote = 0;
+                    }
+                } else if ((c == '"') || (c == '\'')) {
+                    quote = c;
+                }
+            } while (quote || (c != '>'));
+            if (prev != '/') {
+                ++depth;
+            }
+            elem = 1;
+        }
+
+        if (!depth) {
+            if (elem) {
+                /* whole top-level subtree read */
+                buf->mem[buf->used] = '\0';
+                return 1;
+            }
+
+            /* skip top-level comments and processing instructions */
+            buf->used = 0;
+        }
+    }
+
+    if (depth) {
+        error_print(0, "Unexpected end of XML data");
+        return -1;
+    }
+    return 0;
+}
+
+static int
+stream_mod_has_data(const struct lys_module *ly_mod, int config)
+{
+    const struct lys_node *snode = NULL;
+
+    while ((snode = lys_getnext(snode, NULL, ly_mod, 0))) {
+        if ((snode->nodetype & (LYS_CONTAINER | LYS_LIST | LYS_LEAF | LYS_LEAFLIST | LYS_ANYDATA))
+                && (!config || (snode->flags & LYS_CONFIG_W))) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int
+stream_import_flush(struct stream_import_s *imp)
+{
+    void *mem;
+    uint32_t i;
+    int r;
+
+    if (!imp->ly_mod) {
+        return EXIT_SUCCESS;
+    }
+
+    for (i = 0; (i < imp->done_count) && (imp->done_mods[i] != imp->ly_mod); ++i) {}
+    if (i < imp->done_count) {
+        /* another part of already imported module data, merge it */
+        r = sr_edit_batch(imp->sess, imp->data, "merge");
+        if (!r) {
+            r = sr_apply_changes(imp->sess, 0);
+        }
+        lyd_free_withsiblings(imp->data);
+        if (r) {
+            sr_discard_changes(imp->sess);
+            error_print(r, "Merging data of module \"%s\" failed", imp->ly_mod->name);
+            return EXIT_FAILURE;
+        }
+    } else {
+        /* replace module config (always spends data) */
+        r = sr_replace_config(imp->sess, imp->ly_mod->name, imp->data, sr_session_get_ds(imp->sess), 0);
+        if (r) {
+            error_print(r, "Replace config of module \"%s\" failed", imp->ly_mod->name);
+            return EXIT_FAILURE;
+        }
+
+        mem = realloc(imp->done_mods, (imp->done_count + 1) * sizeof *imp->done_mods);
+        if (!mem) {
+            error_print(0, "Memory allocation failed");
+            return EXIT_FAILURE;
+        }
+        imp->done_mods = mem;
+        imp->done_mods[imp->done_count] = imp->ly_mod;
+        ++imp->done_count;
+    }
+
+    imp->ly_mod = NULL;
+    imp->data = NULL;
+    return EXIT_SUCCESS;
+}
+
+static int
+op_import_stream(sr_session_ctx_t *sess, const char *file_path, const char *module_name, LYD_FORMAT format,
+        int not_strict)
+{
+    struct ly_ctx *ly_ctx;
+    const struct lys_module *ly_mod;
+    struct stream_import_s imp = {sess, NULL, NULL, NULL, 0};
+    struct stream_buf buf = {NULL, 0, 0};
+    struct lyd_node *data, *node;
+    FILE *file = stdin;
+    uint32_t i, idx;
+    int r, flags, rc = EXIT_FAILURE;
+
+    ly_ctx = (struct ly_ctx *)sr_get_context(sr_session_get_connection(sess));
+
+    if (step_learn_format(file_path, &format)) {
+        return EXIT_FAILURE;
+    } else if (format != LYD_XML) {
+        error_print(0, "Only XML data can be imported in a stream");
+        return EXIT_FAILURE;
+    }
+
+    if (file_path) {
+        file = fopen(file_path, "r");
+        if (!file) {
+            error_print(0, "Failed to open \"%s\" for reading (%s)", file_path, strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+
+    flags = LYD_OPT_CONFIG | LYD_OPT_TRUSTED | (not_strict ? 0 : LYD_OPT_STRICT);
+    while ((r = stream_read_xml_subtree(file, &buf)) == 1) {
+        /* parse a single top-level subtree */
+        data = lyd_parse_mem(ly_ctx, buf.mem, LYD_XML, flags);
+        if (ly_errno) {
+            error_ly_print(ly_ctx);
+            error_print(0, "Data parsing failed");
+            goto cleanup;
+        }
+
+        while (data) {
+            node = data;
+            data = data->next;
+            lyd_unlink(node);
+
+            if (node->dflt) {
+                /* default nodes of any modules are created by the parser, not needed */
+                lyd_free(node);
+                continue;
+            }
+
+            ly_mod = lyd_node_module(node);
+            if (module_name && strcmp(ly_mod->name, module_name)) {
+                error_print(0, "Data of module \"%s\" cannot be imported into module \"%s\"", ly_mod->name, module_name);
+                lyd_free(node);
+                lyd_free_withsiblings(data);
+                goto cleanup;
+            }
+
+            /* import all the previous data of a different module */
+            if (imp.ly_mod && (imp.ly_mod != ly_mod) && stream_import_flush(&imp)) {
+                lyd_free(node);
+                lyd_free_withsiblings(data);
+                goto cleanup;
+            }
+
+            imp.ly_mod = ly_mod;
+            if (!imp.data) {
+                imp.data = node;
+            } else {
+                lyd_insert_sibling(&imp.data, node);
+            }
+        }
+    }
+    if ((r == -1) || stream_import_flush(&imp)) {
+        goto cleanup;
+    }
+
+    /* modules without any data in the input are emptied, like when importing all the data at once */
+    idx = ly_ctx_internal_modules_count(ly_ctx);
+    while ((ly_mod = ly_ctx_get_module_iter(ly_ctx, &idx))) {
+        if (!ly_mod->implemented || (module_name && strcmp(ly_mod->name, module_name)) || !stream_mod_has_data(ly_mod, 1)) {
+            continue;
+        }
+        for (i = 0; (i < imp.done_count) && (imp.done_mods[i] != ly_mod); ++i) {}
+        if (i < imp.done_count) {
+            continue;
+        }
+
+        r = sr_replace_config(sess, ly_mod->name, NULL, sr_session_get_ds(sess), 0);
+        if (r) {
+            error_print(r, "Replace config of module \"%s\" failed", ly_mod->name);
+            goto cleanup;
+        }
+    }
+
+    rc = EXIT_SUCCESS;
+
+cleanup:
+    lyd_free_withsiblings(imp.data);
+    free(imp.done_mods);
+    free(buf.mem);
+    if (file_path) {
+        fclose(file);
+    }
+    return rc;
+}
+
+static void *
+stream_export_thread(void *arg)
+{
+    struct stream_export_s *exp = (struct stream_export_s *)arg;
+    struct lyd_node *data;
+    char *xpath;
+
+    exp->str = NULL;
+    if (asprintf(&xpath, "/%s:*", exp->module_name) == -1) {
+        exp->r = SR_ERR_NOMEM;
+        return NULL;
+    }
+
+    exp->r = sr_get_data(exp->sess, xpath, exp->max_depth, 0, 0, &data);
+    free(xpath);
+    if (exp->r || !data) {
+        return NULL;
+    }
+
+    if (exp->file) {
+        /* print directly */
+        lyd_print_file(exp->file, data, LYD_XML, LYP_FORMAT | LYP_WITHSIBLINGS);
+    } else {
+        /* to be printed in the correct order */
+        lyd_print_mem(&exp->str, data, LYD_XML, LYP_FORMAT | LYP_WITHSIBLINGS);
+    }
+    lyd_free_withsiblings(data);
+    return NULL;
+}
+
+static int
+op_export_stream(sr_session_ctx_t *sess, const char *file_path, const char *module_name, LYD_FORMAT format,
+        uint32_t max_depth, uint32_t thread_count)
+{
+    struct ly_ctx *ly_ctx;
+    const struct lys_module *ly_mod;
+    struct stream_export_s *exps = NULL;
+    const char **mod_names = NULL;
+    FILE *file = NULL;
+    void *mem;
+    uint32_t i, j, idx, count, mod_count = 0;
+    int r, failed, rc = EXIT_FAILURE;
+
+    ly_ctx = (struct ly_ctx *)sr_get_context(sr_session_get_connection(sess));
+
+    if (format == LYD_UNKNOWN) {
+        format = LYD_XML;
+    } else if (format != LYD_XML) {
+        error_print(0, "Only XML data can be exported in a stream");
+        return EXIT_FAILURE;
+    }
+
+    if (file_path) {
+        file = fopen(file_path, "w");
+        if (!file) {
+            error_print(0, "Failed to open \"%s\" for writing (%s)", file_path, strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* learn all the modules to export */
+    idx = ly_ctx_internal_modules_count(ly_ctx);
+    while ((ly_mod = ly_ctx_get_module_iter(ly_ctx, &idx))) {
+        if (!ly_mod->implemented || (module_name && strcmp(ly_mod->name, module_name)) || !stream_mod_has_data(ly_mod, 0)) {
+            continue;
+        }
+
+        mem = realloc(mod_names, (mod_count + 1) * sizeof *mod_names);
+        if (!mem) {
+            error_print(0, "Memory allocation failed");
+            goto cleanup;
+        }
+        mod_names = mem;
+        mod_names[mod_count] = ly_mod->name;
+        ++mod_count;
+    }
+    if (thread_count > mod_count) {
+        thread_count = mod_count ? mod_count : 1;
+    }
+
+    /* prepare a session for every thread */
+    exps = calloc(thread_count, sizeof *exps);
+    if (!exps) {
+        error_print(0, "Memory allocation failed");
+        goto cleanup;
+    }
+    for (j = 0; j < thread_count; ++j) {
+        if (!j) {
+            exps[j].sess = sess;
+        } else if ((r = sr_session_start(sr_session_get_connection(sess), sr_session_get_ds(sess), &exps[j].sess))) {
+            error_print(r, "Failed to start a session");
+            goto cleanup;
+        }
+        exps[j].max_depth = max_depth;
+        exps[j].file = (thread_count == 1) ? (file ? file : stdout) : NULL;
+    }
+
+    for (i = 0; i < mod_count; i += count) {
+        count = ((mod_count - i) < thread_count) ? (mod_count - i) : thread_count;
+
+        /* get and print the data of the next modules */
+        for (j = 0; j < count; ++j) {
+            exps[j].module_name = mod_names[i + j];
+            exps[j].threaded = (thread_count > 1) && !pthread_create(&exps[j].tid, NULL, stream_export_thread, &exps[j]);
+            if (!exps[j].threaded) {
+                stream_export_thread(&exps[j]);
+            }
+        }
+
+        /* print them in order */
+        failed = 0;
+        for (j = 0; j < count; ++j) {
+            if (exps[j].threaded) {
+                pthread_join(exps[j].tid, NULL);
+            }
+            if (!failed && exps[j].r) {
+                error_print(exps[j].r, "Getting data of module \"%s\" failed", exps[j].module_name);
+                failed = 1;
+            } else if (!failed && exps[j].str) {
+                fputs(exps[j].str, file ? file : stdout);
+            }
+            free(exps[j].str);
+        }
+        if (failed) {
+            goto cleanup;
+        }
+    }
+
+    rc = EXIT_SUCCESS;
+
+cleanup:
+    for (j = 1; exps && (j < thread_count); ++j) {
+        sr_session_stop(exps[j].sess);
+    }
+    free(exps);
+    free(mod_names);
+    if (file) {
+        fclose(file);
+    }
+    return rc;
+}
+
 static int
 op_edit(sr_session_ctx_t *sess, const char *file_path, const char *editor, const char *module_name, LYD_FORMAT format,
         int lock, int not_strict)
@@ -569,8 +1063,8 @@ main(int argc, char** argv)
     const char *module_name = NULL, *editor = NULL, *file_path = NULL, *xpath = NULL;
     char *ptr;
     sr_log_level_t log_level = SR_LL_ERR;
-    int r, rc = EXIT_FAILURE, opt, operation = 0, lock = 0, not_strict = 0;
-    uint32_t max_depth = 0;
+    int r, rc = EXIT_FAILURE, opt, operation = 0, lock = 0, not_strict = 0, stream = 0;
+    uint32_t max_depth = 0, thread_count = 1;
     struct option options[] = {
         {"help",            no_argument,       NULL, 'h'},
         {"version",         no_argument,       NULL, 'V'},
@@ -588,6 +1082,8 @@ main(int argc, char** argv)
         {"not-strict",      no_argument,       NULL, 'n'},
         {"depth",           required_argument, NULL, 'p'},
         {"verbosity",       required_argument, NULL, 'v'},
+        {"stream",          no_argument,       NULL, 'S'},
+        {"threads",         required_argument, NULL, 't'},
         {NULL,              0,                 NULL, 0},
     };
 
@@ -598,7 +1094,7 @@ main(int argc, char** argv)
 
     /* process options */
     opterr = 0;
-    while ((opt = getopt_long(argc, argv, "hVI::X::E::R::N::C:d:m:x:f:lnp:v:", options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "hVI::X::E::R::N::C:d:m:x:f:lnp:v:St:", options, NULL)) != -1) {
         switch (opt) {
         case 'h':
             version_print();
@@ -753,6 +1249,16 @@ main(int argc, char** argv)
                 goto cleanup;
             }
             break;
+        case 'S':
+            stream = 1;
+            break;
+        case 't':
+            thread_count = strtoul(optarg, &ptr, 10);
+            if (ptr[0] || !thread_count) {
+                error_print(0, "Invalid thread count \"%s\"", optarg);
+                goto cleanup;
+            }
+            break;
         default:
             error_print(0, "Invalid option or missing argument: -%c", optopt);
             goto cleanup;
@@ -765,6 +1271,18 @@ main(int argc, char** argv)
         goto cleanup;
     }
 
+    /* check streaming options */
+    if (stream && (operation != 'I') && (operation != 'X')) {
+        error_print(0, "Only import and export can be performed in a stream");
+        goto cleanup;
+    } else if (stream && xpath) {
+        error_print(0, "Options --stream and --xpath cannot be combined");
+        goto cleanup;
+    } else if ((thread_count > 1) && (!stream || (operation != 'X'))) {
+        error_print(0, "Option --threads is supported only for export with --stream");
+        goto cleanup;
+    }
+
     /* set logging */
     sr_log_stderr(log_level);
 
@@ -783,10 +1301,18 @@ main(int argc, char** argv)
     /* perform the operation */
     switch (operation) {
     case 'I':
-        rc = op_import(sess, file_path, module_name, format, not_strict);
+        if (stream) {
+            rc = op_import_stream(sess, file_path, module_name, format, not_strict);
+        } else {
+            rc = op_import(sess, file_path, module_name, format, not_strict);
+        }
         break;
     case 'X':
-        rc = op_export(sess, file_path, module_name, xpath, format, max_depth);
+        if (stream) {
+            rc = op_export_stream(sess, file_path, module_name, format, max_depth, thread_count);
+        } else {
+            rc = op_export(sess, file_path, module_name, xpath, format, max_depth);
+        }
         break;
     case 'E':
         rc = op_edit(sess, file_path, editor, module_name, format, lock, not_strict);
@@ -405,7 +405,7 @@ cleanup:
  * @param[in] sr_deps Internal sysrepo data dependencies to add to.
  * @param[in] dep_type Dependency type.
  * @param[in] mod_name Name of the module with the dependency.
- * @param[in] node Node causing the dependency.
+ * @param[in] node Node causing the dependency, for ::SR_DEP_REF the referenced top-level node, if known.
  * @return err_info, NULL on success.
  */
 static sr_error_info_t *
@@ -413,17 +413,26 @@ sr_lydmods_moddep_add(struct lyd_node *sr_deps, sr_mod_dep_type_t dep_type, cons
 {
     const struct lys_node *data_child;
     char *data_path = NULL, *expr = NULL;
-    struct lyd_node *sr_instid;
+    struct lyd_node *sr_instid, *sr_ref;
     struct ly_set *set = NULL;
     sr_error_info_t *err_info = NULL;
 
     assert(((dep_type == SR_DEP_REF) && mod_name) || ((dep_type == SR_DEP_INSTID) && node));
 
-    if (dep_type == SR_DEP_REF) {
+    if ((dep_type == SR_DEP_REF) && (!node || !strcmp(sr_deps->schema->name, "data-deps"))) {
+        /* whole module is needed */
+        node = NULL;
         if (asprintf(&expr, "module[.='%s']", mod_name) == -1) {
             SR_ERRINFO_MEM(&err_info);
             goto cleanup;
         }
+    } else if (dep_type == SR_DEP_REF) {
+        /* only the referenced subtree is needed by the operation */
+        data_path = lys_data_path(node);
+        if (!data_path || (asprintf(&expr, "ref-path[xpath='%s']", data_path) == -1)) {
+            SR_ERRINFO_MEM(&err_info);
+            goto cleanup;
+        }
     } else {
         /* find the instance node(s) */
         switch (node->nodetype) {
@@ -480,11 +489,25 @@ sr_lydmods_moddep_add(struct lyd_node *sr_deps, sr_mod_dep_type_t dep_type, cons
     }
 
     /* create new dependency */
-    if (dep_type == SR_DEP_REF) {
+    if ((dep_type == SR_DEP_REF) && !node) {
         if (!lyd_new_leaf(sr_deps, NULL, "module", mod_name)) {
             sr_errinfo_new_ly(&err_info, lyd_node_module(sr_deps)->ctx);
             goto cleanup;
         }
+    } else if (dep_type == SR_DEP_REF) {
+        sr_ref = lyd_new(sr_deps, NULL, "ref-path");
+        if (!sr_ref) {
+            sr_errinfo_new_ly(&err_info, lyd_node_module(sr_deps)->ctx);
+            goto cleanup;
+        }
+        if (!lyd_new_leaf(sr_ref, NULL, "xpath", data_path)) {
+            sr_errinfo_new_ly(&err_info, lyd_node_module(sr_deps)->ctx);
+            goto cleanup;
+        }
+        if (!lyd_new_leaf(sr_ref, NULL, "module", mod_name)) {
+            sr_errinfo_new_ly(&err_info, lyd_node_module(sr_deps)->ctx);
+            goto cleanup;
+        }
     } else {
         sr_instid = lyd_new(sr_deps, NULL, "inst-id");
         if (!sr_instid) {
@@ -513,9 +536,9 @@ cleanup:
  *
  * @param[in] atom Node to check.
  * @param[in] top_node Top-level node for the expression.
- * @return Foreign dependency module, NULL if atom is not foreign.
+ * @return Foreign top-level node of the atom, NULL if atom is not foreign.
  */
-static struct lys_module *
+static const struct lys_node *
 sr_lydmods_moddep_expr_atom_is_foreign(const struct lys_node *atom, const struct lys_node *top_node)
 {
     assert(atom && top_node && (!lys_parent(top_node) || (top_node->nodetype & (LYS_RPC | LYS_ACTION | LYS_NOTIF))));
@@ -531,12 +554,12 @@ sr_lydmods_moddep_expr_atom_is_foreign(const struct lys_node *atom, const struct
 
     if (top_node->nodetype & (LYS_RPC | LYS_ACTION | LYS_NOTIF)) {
         /* outside operation, foreign node */
-        return (struct lys_module *)lys_node_module(atom);
+        return atom;
     }
 
     if (lys_node_module(atom) != lys_node_module(top_node)) {
         /* foreing top-level node module (so cannot be augment), foreign node */
-        return (struct lys_module *)lys_node_module(atom);
+        return atom;
     }
 
     /* same top-level modules, local node */
@@ -549,18 +572,17 @@ sr_lydmods_moddep_expr_atom_is_foreign(const struct lys_node *atom, const struct
  * @param[in] ctx_node Expression context node.
  * @param[in] expr Expression.
  * @param[in] lyxp_opt libyang lyxp options.
- * @param[out] dep_mods Array of dependent modules.
- * @param[out] dep_mod_count Dependent module count.
+ * @param[out] dep_nodes Array of referenced foreign top-level nodes.
+ * @param[out] dep_node_count Referenced foreign top-level node count.
  * @return err_info, NULL on success.
  */
 static sr_error_info_t *
-sr_lydmods_moddep_expr_get_dep_mods(const struct lys_node *ctx_node, const char *expr, int lyxp_opt,
-        struct lys_module ***dep_mods, size_t *dep_mod_count)
+sr_lydmods_moddep_expr_get_dep_nodes(const struct lys_node *ctx_node, const char *expr, int lyxp_opt,
+        const struct lys_node ***dep_nodes, size_t *dep_node_count)
 {
     sr_error_info_t *err_info = NULL;
     struct ly_set *set;
-    const struct lys_node *top_node;
-    struct lys_module *dep_mod;
+    const struct lys_node *top_node, *dep_node;
     size_t i, j;
 
     /* find out if we are in an operation, otherwise simply find top-level node */
@@ -578,25 +600,25 @@ sr_lydmods_moddep_expr_get_dep_mods(const struct lys_node *ctx_node, const char
 
     /* find all top-level foreign nodes (augment nodes are not considered foreign now) */
     for (i = 0; i < set->number; ++i) {
-        if ((dep_mod = sr_lydmods_moddep_expr_atom_is_foreign(set->set.s[i], top_node))) {
+        if ((dep_node = sr_lydmods_moddep_expr_atom_is_foreign(set->set.s[i], top_node))) {
             /* check for duplicities */
-            for (j = 0; j < *dep_mod_count; ++j) {
-                if ((*dep_mods)[j] == dep_mod) {
+            for (j = 0; j < *dep_node_count; ++j) {
+                if ((*dep_nodes)[j] == dep_node) {
                     break;
                 }
             }
 
-            /* add a new dependency module */
-            if (j == *dep_mod_count) {
-                *dep_mods = sr_realloc(*dep_mods, (*dep_mod_count + 1) * sizeof **dep_mods);
-                if (!*dep_mods) {
-                    *dep_mod_count = 0;
+            /* add a new dependency node */
+            if (j == *dep_node_count) {
+                *dep_nodes = sr_realloc(*dep_nodes, (*dep_node_count + 1) * sizeof **dep_nodes);
+                if (!*dep_nodes) {
+                    *dep_node_count = 0;
                     SR_ERRINFO_MEM(&err_info);
                     goto cleanup;
                 }
 
-                (*dep_mods)[*dep_mod_count] = dep_mod;
-                ++(*dep_mod_count);
+                (*dep_nodes)[*dep_node_count] = dep_node;
+                ++(*dep_node_count);
             }
         }
     }
@@ -608,6 +630,58 @@ cleanup:
     return err_info;
 }
 
+/**
+ * @brief Collect dependency modules from an XPath expression.
+ *
+ * @param[in] ctx_node Expression context node.
+ * @param[in] expr Expression.
+ * @param[in] lyxp_opt libyang lyxp options.
+ * @param[out] dep_mods Array of dependent modules.
+ * @param[out] dep_mod_count Dependent module count.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_lydmods_moddep_expr_get_dep_mods(const struct lys_node *ctx_node, const char *expr, int lyxp_opt,
+        struct lys_module ***dep_mods, size_t *dep_mod_count)
+{
+    sr_error_info_t *err_info = NULL;
+    const struct lys_node **dep_nodes = NULL;
+    struct lys_module *dep_mod;
+    size_t i, j, dep_node_count = 0;
+
+    if ((err_info = sr_lydmods_moddep_expr_get_dep_nodes(ctx_node, expr, lyxp_opt, &dep_nodes, &dep_node_count))) {
+        return err_info;
+    }
+
+    for (i = 0; i < dep_node_count; ++i) {
+        dep_mod = (struct lys_module *)lys_node_module(dep_nodes[i]);
+
+        /* check for duplicities */
+        for (j = 0; j < *dep_mod_count; ++j) {
+            if ((*dep_mods)[j] == dep_mod) {
+                break;
+            }
+        }
+
+        /* add a new dependency module */
+        if (j == *dep_mod_count) {
+            *dep_mods = sr_realloc(*dep_mods, (*dep_mod_count + 1) * sizeof **dep_mods);
+            if (!*dep_mods) {
+                *dep_mod_count = 0;
+                SR_ERRINFO_MEM(&err_info);
+                goto cleanup;
+            }
+
+            (*dep_mods)[*dep_mod_count] = dep_mod;
+            ++(*dep_mod_count);
+        }
+    }
+
+cleanup:
+    free(dep_nodes);
+    return err_info;
+}
+
 /**
  * @brief Collect dependencies from a type.
  *
@@ -622,7 +696,8 @@ sr_lydmods_moddep_type(const struct lys_type *type, struct lys_node *node, struc
     sr_error_info_t *err_info = NULL;
     const struct lys_type *t;
     struct lys_module **dep_mods = NULL;
-    size_t dep_mod_count = 0;
+    const struct lys_node **dep_nodes = NULL;
+    size_t i, dep_mod_count = 0, dep_node_count = 0;
 
     switch (type->base) {
     case LY_TYPE_INST:
@@ -642,19 +717,20 @@ sr_lydmods_moddep_type(const struct lys_type *type, struct lys_node *node, struc
         break;
     case LY_TYPE_LEAFREF:
         assert(type->info.lref.path);
-        if ((err_info = sr_lydmods_moddep_expr_get_dep_mods(node, type->info.lref.path, 0, &dep_mods, &dep_mod_count))) {
+        if ((err_info = sr_lydmods_moddep_expr_get_dep_nodes(node, type->info.lref.path, 0, &dep_nodes, &dep_node_count))) {
             return err_info;
         }
-        assert(dep_mod_count < 2);
 
-        if (dep_mod_count) {
-            /* a foregin module is referenced */
-            err_info = sr_lydmods_moddep_add(sr_deps, SR_DEP_REF, dep_mods[0]->name, NULL);
-            free(dep_mods);
-            if (err_info) {
-                return err_info;
+        /* a foregin module is referenced, remember all its top-level nodes (even from predicates) */
+        for (i = 0; i < dep_node_count; ++i) {
+            if ((err_info = sr_lydmods_moddep_add(sr_deps, SR_DEP_REF, lys_node_module(dep_nodes[i])->name, dep_nodes[i]))) {
+                break;
             }
         }
+        free(dep_nodes);
+        if (err_info) {
+            return err_info;
+        }
         break;
     case LY_TYPE_UNION:
         t = NULL;
@@ -685,8 +761,8 @@ static sr_error_info_t *
 sr_lydmods_add_data_deps_r(struct lyd_node *sr_mod, struct lys_node *data_root, struct lyd_node *sr_deps)
 {
     sr_error_info_t *err_info = NULL;
-    struct lys_module **dep_mods;
-    size_t dep_mod_count;
+    const struct lys_node **dep_nodes;
+    size_t j, dep_node_count;
     struct lys_node *next, *elem;
     struct lys_type *type;
     struct lys_when *when;
@@ -703,8 +779,8 @@ sr_lydmods_add_data_deps_r(struct lyd_node *sr_mod, struct lys_node *data_root,
         when = NULL;
         must_size = 0;
         musts = NULL;
-        dep_mods = NULL;
-        dep_mod_count = 0;
+        dep_nodes = NULL;
+        dep_node_count = 0;
 
         switch (elem->nodetype) {
         case LYS_LEAF:
@@ -788,25 +864,26 @@ sr_lydmods_add_data_deps_r(struct lyd_node *sr_mod, struct lys_node *data_root,
             }
         }
         if (when) {
-            if ((err_info = sr_lydmods_moddep_expr_get_dep_mods(elem, when->cond, LYXP_WHEN, &dep_mods, &dep_mod_count))) {
+            if ((err_info = sr_lydmods_moddep_expr_get_dep_nodes(elem, when->cond, LYXP_WHEN, &dep_nodes, &dep_node_count))) {
                 return err_info;
             }
         }
         for (i = 0; i < must_size; ++i) {
-            if ((err_info = sr_lydmods_moddep_expr_get_dep_mods(elem, musts[i].expr, LYXP_MUST, &dep_mods, &dep_mod_count))) {
-                free(dep_mods);
+            if ((err_info = sr_lydmods_moddep_expr_get_dep_nodes(elem, musts[i].expr, LYXP_MUST, &dep_nodes,
+                    &dep_node_count))) {
+                free(dep_nodes);
                 return err_info;
             }
         }
 
         /* add those collected from when and must */
-        for (i = 0; i < dep_mod_count; ++i) {
-            if ((err_info = sr_lydmods_moddep_add(sr_deps, SR_DEP_REF, dep_mods[i]->name, NULL))) {
-                free(dep_mods);
+        for (j = 0; j < dep_node_count; ++j) {
+            if ((err_info = sr_lydmods_moddep_add(sr_deps, SR_DEP_REF, lys_node_module(dep_nodes[j])->name, dep_nodes[j]))) {
+                free(dep_nodes);
                 return err_info;
             }
         }
-        free(dep_mods);
+        free(dep_nodes);
 
         /* LY_TREE_DFS_END */
         if (elem->nodetype & (LYS_LEAF | LYS_LEAFLIST | LYS_ANYDATA)) {
@@ -1818,6 +1895,11 @@ sr_lydmods_sched_update_data(const struct lyd_node *sr_mods, const struct ly_ctx
         lyd_free_withsiblings(mod_data);
     }
 
+    /* make all the startup files durable */
+    if (set->number && (err_info = sr_startup_dir_sync())) {
+        goto cleanup;
+    }
+
     /* success */
 
 cleanup:
@@ -2741,3 +2823,50 @@ cleanup:
     return err_info;
 }
 
+sr_error_info_t *
+sr_lydmods_update_subtree_lock(struct ly_ctx *ly_ctx, const char *mod_name, const char *list_name)
+{
+    sr_error_info_t *err_info = NULL;
+    struct lyd_node *sr_mods = NULL;
+    char *path = NULL;
+    struct ly_set *set = NULL;
+
+    /* parse current module information */
+    if ((err_info = sr_lydmods_parse(ly_ctx, &sr_mods))) {
+        goto cleanup;
+    }
+
+    /* change subtree-lock accordingly */
+    if (asprintf(&path, "module[name=\"%s\"]/subtree-lock", mod_name) == -1) {
+        SR_ERRINFO_MEM(&err_info);
+        goto cleanup;
+    }
+    set = lyd_find_path(sr_mods, path);
+    SR_CHECK_INT_GOTO(!set, err_info, cleanup);
+    if (!list_name && (set->number == 1)) {
+        /* remove subtree lock */
+        lyd_free(set->set.d[0]);
+    } else if (list_name) {
+        /* add or change subtree lock */
+        ly_errno = 0;
+        if (!lyd_new_path(sr_mods, NULL, path, (void *)list_name, 0, LYD_PATH_OPT_UPDATE) && ly_errno) {
+            sr_errinfo_new_ly(&err_info, lyd_node_module(sr_mods)->ctx);
+            SR_ERRINFO_INT(&err_info);
+            goto cleanup;
+        }
+    }
+
+    /* store the updated persistent data tree */
+    if ((err_info = sr_lydmods_print(&sr_mods))) {
+        goto cleanup;
+    }
+
+    /* success */
+
+cleanup:
+    free(path);
+    ly_set_free(set);
+    lyd_free_withsiblings(sr_mods);
+    return err_info;
+}
+
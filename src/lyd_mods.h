@@ -190,4 +190,14 @@ sr_error_info_t *sr_lydmods_deferred_change_feature(struct ly_ctx *ly_ctx, const
  */
 sr_error_info_t *sr_lydmods_update_replay_support(struct ly_ctx *ly_ctx, const char *mod_name, int replay_support);
 
+/**
+ * @brief Update subtree lock in sysrepo module data.
+ *
+ * @param[in] ly_ctx Context to use for parsing the data.
+ * @param[in] mod_name Module to update.
+ * @param[in] list_name Top-level list whose instances to lock separately, NULL to lock only the whole module.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_lydmods_update_subtree_lock(struct ly_ctx *ly_ctx, const char *mod_name, const char *list_name);
+
 #endif
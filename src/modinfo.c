@@ -210,6 +210,119 @@ sr_modinfo_edit_apply(struct sr_mod_info_s *mod_info, const struct lyd_node *edi
     return NULL;
 }
 
+int
+sr_modinfo_edit_noop(const struct sr_mod_info_s *mod_info)
+{
+    uint32_t i;
+
+    if (mod_info->diff || (mod_info->ds == SR_DS_OPERATIONAL)) {
+        /* operational edits are stored as they are */
+        return 0;
+    }
+
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        if ((mod_info->mods[i].state & MOD_INFO_REQ) && (mod_info->mods[i].state & MOD_INFO_CHANGED)) {
+            return 0;
+        }
+    }
+
+    /* no data nor default flags were changed, the data are exactly the stored ones */
+    return 1;
+}
+
+/**
+ * @brief Get the subtree lock hash of a top-level data node.
+ *
+ * @param[in] node Top-level data node.
+ * @param[out] hash Node hash, never 0.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_modinfo_subtree_hash(const struct lyd_node *node, uint32_t *hash)
+{
+    sr_error_info_t *err_info = NULL;
+    char *path;
+
+    /* list instances are identified by their keys */
+    path = lyd_path(node);
+    SR_CHECK_MEM_RET(!path, err_info);
+
+    *hash = sr_str_hash(path);
+    if (!*hash) {
+        *hash = 1;
+    }
+
+    free(path);
+    return NULL;
+}
+
+sr_error_info_t *
+sr_modinfo_subtree_collect(struct sr_mod_info_s *mod_info, const struct lyd_node *edit)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_mod_info_mod_s *mod;
+    const struct lyd_node *root;
+    const char *list_name;
+    uint32_t i, j, hash, *hashes;
+    uint16_t count;
+
+    if (mod_info->ds != SR_DS_RUNNING) {
+        /* only running changes are rebased on concurrent changes */
+        return NULL;
+    }
+
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        mod = &mod_info->mods[i];
+        if (!(mod->state & MOD_INFO_REQ) || !mod->shm_mod->subtree_lock || mod->shm_mod->inv_data_dep_count) {
+            /* the whole module is locked */
+            continue;
+        }
+        list_name = mod_info->conn->ext_shm.addr + mod->shm_mod->subtree_lock;
+
+        hashes = NULL;
+        count = 0;
+        LY_TREE_FOR(edit, root) {
+            if (lyd_node_module(root) != mod->ly_mod) {
+                continue;
+            }
+
+            if ((root->schema->nodetype != LYS_LIST) || strcmp(root->schema->name, list_name)) {
+                /* not a subtree, the whole module is locked */
+                break;
+            }
+
+            if ((err_info = sr_modinfo_subtree_hash(root, &hash))) {
+                free(hashes);
+                return err_info;
+            }
+            for (j = 0; (j < count) && (hashes[j] != hash); ++j);
+            if (j < count) {
+                /* already collected */
+                continue;
+            }
+
+            if (count == SR_MOD_SUBTREE_LOCK_COUNT) {
+                /* too many subtrees, the whole module is locked */
+                break;
+            }
+            hashes = sr_realloc(hashes, (count + 1) * sizeof *hashes);
+            SR_CHECK_MEM_RET(!hashes, err_info);
+            hashes[count] = hash;
+            ++count;
+        }
+
+        if (root || !count) {
+            free(hashes);
+            continue;
+        }
+
+        mod->subtree_hashes = hashes;
+        mod->subtree_hash_count = count;
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_modinfo_diff_merge(struct sr_mod_info_s *mod_info, struct lyd_node *orig_diff)
 {
@@ -274,6 +387,64 @@ error:
     return err_info;
 }
 
+/**
+ * @brief Learn whether a diff of replaced data is needed regardless of the change subscribers.
+ *
+ * @param[in] mod_info Mod info to use.
+ * @param[out] diff_needed Whether a diff is always needed.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_modinfo_replace_diff_needed(struct sr_mod_info_s *mod_info, int *diff_needed)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_mod_t *shm_mod;
+
+    *diff_needed = 1;
+
+    if (mod_info->ds == SR_DS_CANDIDATE) {
+        /* candidate data are stored as a diff */
+        return NULL;
+    }
+
+    if (mod_info->conn->diff_check_cb) {
+        /* the diff is checked by the connection callback */
+        return NULL;
+    }
+
+    if ((mod_info->ds == SR_DS_RUNNING) || (mod_info->ds == SR_DS_STARTUP)) {
+        /* netconf-config-change notification is generated from the diff */
+        shm_mod = sr_shmmain_find_module(&mod_info->conn->main_shm, mod_info->conn->ext_shm.addr,
+                "ietf-netconf-notifications", 0);
+        SR_CHECK_INT_RET(!shm_mod, err_info);
+        if ((shm_mod->flags & SR_MOD_REPLAY_SUPPORT) || shm_mod->notif_sub_count) {
+            return NULL;
+        }
+    }
+
+    *diff_needed = 0;
+    return NULL;
+}
+
+sr_error_info_t *
+sr_modinfo_changes_observed(struct sr_mod_info_s *mod_info, int *observed)
+{
+    sr_error_info_t *err_info = NULL;
+    uint32_t i;
+
+    if ((err_info = sr_modinfo_replace_diff_needed(mod_info, observed))) {
+        return err_info;
+    }
+
+    for (i = 0; !*observed && (i < mod_info->mod_count); ++i) {
+        if (sr_shmsub_change_has_subscription(mod_info->conn, mod_info->mods[i].shm_mod, mod_info->ds)) {
+            *observed = 1;
+        }
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_modinfo_replace(struct sr_mod_info_s *mod_info, struct lyd_node **src_data)
 {
@@ -282,15 +453,36 @@ sr_modinfo_replace(struct sr_mod_info_s *mod_info, struct lyd_node **src_data)
     struct sr_mod_info_mod_s *mod;
     struct lyd_node *src_mod_data, *dst_mod_data, *diff;
     uint32_t i;
+    int diff_needed;
 
     assert(!mod_info->diff && !mod_info->data_cached);
 
+    if ((err_info = sr_modinfo_replace_diff_needed(mod_info, &diff_needed))) {
+        return err_info;
+    }
+
     for (i = 0; i < mod_info->mod_count; ++i) {
         mod = &mod_info->mods[i];
         if (mod->state & MOD_INFO_REQ) {
             dst_mod_data = sr_module_data_unlink(&mod_info->data, mod->ly_mod);
             src_mod_data = sr_module_data_unlink(src_data, mod->ly_mod);
 
+            if (!diff_needed && !sr_shmsub_change_has_subscription(mod_info->conn, mod->shm_mod, mod_info->ds)) {
+                /* nobody can learn about the changes, do not spend time generating the diff (bulk load) */
+                if (dst_mod_data || src_mod_data) {
+                    mod->state |= MOD_INFO_CHANGED;
+                }
+
+                /* use new data */
+                if (mod_info->data) {
+                    sr_ly_link(mod_info->data, src_mod_data);
+                } else {
+                    mod_info->data = src_mod_data;
+                }
+                lyd_free_withsiblings(dst_mod_data);
+                continue;
+            }
+
             /* get libyang diff on only this module's data */
             if (!(ly_diff = lyd_diff(dst_mod_data, src_mod_data, LYD_DIFFOPT_WITHDEFAULTS))) {
                 sr_errinfo_new_ly(&err_info, mod_info->conn->ly_ctx);
@@ -686,7 +878,7 @@ sr_module_oper_data_update(struct sr_mod_info_mod_s *mod, sr_sid_t *sid, const c
         } else if ((shm_msub->sub_type == SR_OPER_SUB_STATE) && (opts & SR_OPER_NO_STATE)) {
             /* useless to retrieve state data */
             continue;
-        } else if (!sr_xpath_oper_data_required(request_xpath, sub_xpath)) {
+        } else if (mod->oper_sub_req ? !mod->oper_sub_req[i] : !sr_xpath_oper_data_required(request_xpath, sub_xpath)) {
             /* useless to retrieve this data because they would be filtered out anyway */
             continue;
         }
@@ -1047,6 +1239,33 @@ sr_oper_data_trim_r(struct lyd_node **data, struct lyd_node *sibling, sr_get_ope
     }
 }
 
+/**
+ * @brief Load stored candidate diff of a module. It is ignored if it is not based on the current running data.
+ *
+ * @param[in] mod Mod info module to process.
+ * @param[out] diff Candidate diff, NULL if candidate was not modified.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_module_candidate_diff_load(struct sr_mod_info_mod_s *mod, struct lyd_node **diff)
+{
+    sr_error_info_t *err_info = NULL;
+
+    *diff = NULL;
+    if ((err_info = sr_module_file_data_append(mod->ly_mod, SR_DS_CANDIDATE, diff))) {
+        return err_info;
+    }
+
+    if (*diff && (mod->shm_mod->cand_ver != mod->shm_mod->ver)) {
+        SR_LOG_WRN("Module \"%s\" candidate data are based on previous running data, they are ignored.",
+                mod->ly_mod->name);
+        lyd_free_withsiblings(*diff);
+        *diff = NULL;
+    }
+
+    return NULL;
+}
+
 /**
  * @brief Load module data of a specific module.
  *
@@ -1067,10 +1286,15 @@ sr_modinfo_module_data_load(struct sr_mod_info_s *mod_info, struct sr_mod_info_m
     sr_error_info_t *err_info = NULL;
     sr_conn_ctx_t *conn = mod_info->conn;
     struct sr_mod_cache_s *mod_cache = NULL;
-    struct lyd_node *mod_data;
+    struct lyd_node *mod_data, *diff = NULL;
     sr_datastore_t conf_ds;
 
-    if (((mod_info->ds == SR_DS_RUNNING) || (mod_info->ds == SR_DS_OPERATIONAL)) && (conn->opts & SR_CONN_CACHE_RUNNING)) {
+    if ((mod_info->ds == SR_DS_RUNNING) || (mod_info->ds == SR_DS_CANDIDATE)) {
+        /* remember the version of running data (candidate is based on), before they are loaded */
+        mod->run_ver = mod->shm_mod->ver;
+    }
+
+    if ((mod_info->ds != SR_DS_STARTUP) && (conn->opts & SR_CONN_CACHE_RUNNING)) {
         /* we are caching, so in all cases load the module into cache if not yet there */
         mod_cache = &conn->mod_cache;
         if ((err_info = sr_modcache_module_running_update(mod_cache, mod, NULL, mod_info->data_cached))) {
@@ -1080,7 +1304,7 @@ sr_modinfo_module_data_load(struct sr_mod_info_s *mod_info, struct sr_mod_info_m
 
     if (!mod_info->data_cached) {
         if (mod_cache) {
-            assert((mod_info->ds == SR_DS_RUNNING) || (mod_info->ds == SR_DS_OPERATIONAL));
+            assert(mod_info->ds != SR_DS_STARTUP);
 
             /* we are caching, copy module data from the cache and link it */
             if (mod_info->ds == SR_DS_OPERATIONAL) {
@@ -1101,11 +1325,11 @@ sr_modinfo_module_data_load(struct sr_mod_info_s *mod_info, struct sr_mod_info_m
                 mod_info->data = mod_data;
             }
         } else {
-            /* get current persistent data */
-            if (mod_info->ds == SR_DS_OPERATIONAL) {
-                conf_ds = SR_DS_RUNNING;
+            /* get current persistent data, candidate and operational data are based on running */
+            if (mod_info->ds == SR_DS_STARTUP) {
+                conf_ds = SR_DS_STARTUP;
             } else {
-                conf_ds = mod_info->ds;
+                conf_ds = SR_DS_RUNNING;
             }
             if ((err_info = sr_module_file_data_append(mod->ly_mod, conf_ds, &mod_info->data))) {
                 return err_info;
@@ -1126,7 +1350,17 @@ sr_modinfo_module_data_load(struct sr_mod_info_s *mod_info, struct sr_mod_info_m
             }
         }
 
-        if (mod_info->ds == SR_DS_OPERATIONAL) {
+        if (mod_info->ds == SR_DS_CANDIDATE) {
+            /* apply stored candidate diff */
+            if ((err_info = sr_module_candidate_diff_load(mod, &diff))) {
+                return err_info;
+            }
+            err_info = sr_diff_mod_apply(diff, mod->ly_mod, 0, &mod_info->data);
+            lyd_free_withsiblings(diff);
+            if (err_info) {
+                return err_info;
+            }
+        } else if (mod_info->ds == SR_DS_OPERATIONAL) {
             /* append any operational data provided by clients */
             if ((err_info = sr_module_oper_data_update(mod, sid, request_xpath, conn->ext_shm.addr,
                         timeout_ms, opts, &mod_info->data, cb_error_info))) {
@@ -1448,8 +1682,13 @@ sr_modinfo_op_validate(struct sr_mod_info_s *mod_info, struct lyd_node *op, sr_m
         mod = &mod_info->mods[i];
         switch (mod->state & MOD_INFO_TYPE_MASK) {
         case MOD_INFO_REQ:
+            if ((mod->ly_mod != lyd_node_module(top_op)) || !lys_parent(op->schema)) {
+                /* module of another nested operation validated using the same data */
+                break;
+            }
+
             /* this is the module of the nested operation and we need to check that operation's parent data node exists */
-            assert((mod->ly_mod == lyd_node_module(top_op)) && lys_parent(op->schema) && op->parent);
+            assert(op->parent);
             parent_xpath = lyd_path(op->parent);
             SR_CHECK_MEM_GOTO(!parent_xpath, err_info, cleanup);
 
@@ -1502,6 +1741,107 @@ cleanup:
     return err_info;
 }
 
+/**
+ * @brief Learn whether operations reference only some subtrees of a dependency module.
+ *
+ * @param[in] shm_mod Dependency module.
+ * @param[in] shm_deps Main SHM dependencies of each operation.
+ * @param[in] shm_dep_counts Main SHM dependency count of each operation.
+ * @param[in] op_count Operation count.
+ * @return 0 if the whole module is referenced, non-zero if only some subtrees.
+ */
+static int
+sr_modinfo_op_dep_paths_only(sr_mod_t *shm_mod, sr_mod_data_dep_t * const *shm_deps, const uint16_t *shm_dep_counts,
+        uint32_t op_count)
+{
+    uint32_t i;
+    uint16_t j;
+    int paths_only = 0;
+
+    for (i = 0; i < op_count; ++i) {
+        for (j = 0; j < shm_dep_counts[i]; ++j) {
+            if (shm_deps[i][j].module != shm_mod->name) {
+                continue;
+            }
+
+            if (!shm_deps[i][j].xpath) {
+                /* whole module is referenced */
+                return 0;
+            }
+            paths_only = 1;
+        }
+    }
+
+    return paths_only;
+}
+
+sr_error_info_t *
+sr_modinfo_op_oper_subs(struct sr_mod_info_s *mod_info, sr_mod_data_dep_t * const *shm_deps,
+        const uint16_t *shm_dep_counts, uint32_t op_count, uint8_t **oper_sub_req)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_mod_info_mod_s *mod;
+    sr_mod_oper_sub_t *shm_msub;
+    char *ext_shm_addr = mod_info->conn->ext_shm.addr;
+    uint8_t *req;
+    uint32_t i, j, size = 0;
+    uint16_t k, l;
+
+    *oper_sub_req = NULL;
+
+    for (i = 0; i < op_count; ++i) {
+        for (k = 0; k < shm_dep_counts[i]; ++k) {
+            if (shm_deps[i][k].type == SR_DEP_INSTID) {
+                /* any module data may be referenced, require everything */
+                return NULL;
+            }
+        }
+    }
+
+    /* count the subscriptions of all the dependency modules with only some subtrees referenced */
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        mod = &mod_info->mods[i];
+        if (((mod->state & MOD_INFO_TYPE_MASK) == MOD_INFO_DEP)
+                && sr_modinfo_op_dep_paths_only(mod->shm_mod, shm_deps, shm_dep_counts, op_count)) {
+            size += mod->shm_mod->oper_sub_count;
+        }
+    }
+    if (!size) {
+        /* no subscriptions to skip */
+        return NULL;
+    }
+
+    *oper_sub_req = calloc(size, sizeof **oper_sub_req);
+    SR_CHECK_MEM_RET(!*oper_sub_req, err_info);
+
+    req = *oper_sub_req;
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        mod = &mod_info->mods[i];
+        if (((mod->state & MOD_INFO_TYPE_MASK) != MOD_INFO_DEP) || !mod->shm_mod->oper_sub_count
+                || !sr_modinfo_op_dep_paths_only(mod->shm_mod, shm_deps, shm_dep_counts, op_count)) {
+            continue;
+        }
+
+        /* a subscription is required only if it provides some of the referenced subtrees */
+        shm_msub = (sr_mod_oper_sub_t *)(ext_shm_addr + mod->shm_mod->oper_subs);
+        for (l = 0; l < mod->shm_mod->oper_sub_count; ++l) {
+            for (j = 0; j < op_count; ++j) {
+                for (k = 0; k < shm_dep_counts[j]; ++k) {
+                    if ((shm_deps[j][k].module == mod->shm_mod->name) && sr_xpath_oper_data_required(
+                            ext_shm_addr + shm_deps[j][k].xpath, ext_shm_addr + shm_msub[l].xpath)) {
+                        req[l] = 1;
+                    }
+                }
+            }
+        }
+
+        mod->oper_sub_req = req;
+        req += mod->shm_mod->oper_sub_count;
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_modinfo_data_load(struct sr_mod_info_s *mod_info, uint8_t mod_type, int cache, sr_sid_t *sid,
         const char *request_xpath, uint32_t timeout_ms, sr_get_oper_options_t opts, sr_error_info_t **cb_error_info)
@@ -1628,7 +1968,7 @@ sr_modinfo_generate_config_change_notif(struct sr_mod_info_s *mod_info, sr_sessi
     time_t notif_ts;
     sr_mod_notif_sub_t *notif_subs;
     uint32_t idx = 0, notif_sub_count;
-    char *xpath, nc_str[11];
+    char *xpath, nc_str[11], *notif_lyb = NULL;
     const char *op_enum;
     sr_change_oper_t op;
 
@@ -1753,12 +2093,18 @@ sr_modinfo_generate_config_change_notif(struct sr_mod_info_s *mod_info, sr_sessi
         }
     }
 
+    /* print the notification only once for both replay and subscribers */
+    if (lyd_print_mem(&notif_lyb, notif, LYD_LYB, 0)) {
+        sr_errinfo_new_ly(&err_info, mod_info->conn->ly_ctx);
+        goto cleanup;
+    }
+
     /* store the notification for a replay, we continue on failure */
-    tmp_err_info = sr_replay_store(session, notif, notif_ts);
+    tmp_err_info = sr_replay_store(session, notif, notif_lyb, notif_ts);
 
     /* send the notification (non-validated, if everything works correctly it must be valid) */
-    if (notif_sub_count && (err_info = sr_shmsub_notif_notify(notif, notif_ts, session->sid, (uint32_t *)notif_subs,
-            notif_sub_count))) {
+    if (notif_sub_count && (err_info = sr_shmsub_notif_notify(lyd_node_module(notif), &notif_lyb, 1, notif_ts,
+            session->sid, (uint32_t *)notif_subs, notif_sub_count))) {
         goto cleanup;
     }
 
@@ -1767,6 +2113,7 @@ sr_modinfo_generate_config_change_notif(struct sr_mod_info_s *mod_info, sr_sessi
 cleanup:
     ly_set_free(set);
     lyd_free_withsiblings(notif);
+    free(notif_lyb);
     if (err_info) {
         /* write this only if the notification failed to be created/sent */
         sr_errinfo_new(&err_info, err_info->err_code, NULL, "Failed to generate netconf-config-change notification, "
@@ -1778,24 +2125,275 @@ cleanup:
     return err_info;
 }
 
+/**
+ * @brief Keep candidate data of a module unchanged when its running data are being replaced, any stored
+ * candidate diff is rebased on the new running data. Candidate diff that was applied on running is removed instead.
+ *
+ * Running data must not be stored yet. On success, candidate WRITE lock is held and must be released
+ * once the new running data are stored and their version updated so that candidate stores cannot
+ * interleave with the running store.
+ *
+ * @param[in] mod Mod info module to process.
+ * @param[in] new_data New running data of the module.
+ * @param[out] cand_lock Held candidate lock.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_modinfo_candidate_rebase(struct sr_mod_info_mod_s *mod, struct lyd_node *new_data, sr_rwlock_t **cand_lock)
+{
+    sr_error_info_t *err_info = NULL;
+    struct lyd_node *diff = NULL, *cand_data = NULL;
+    struct lyd_difflist *ly_diff = NULL;
+    sr_rwlock_t *lock;
+    char *path;
+    int r;
+
+    *cand_lock = NULL;
+
+    /* CANDIDATE WRITE LOCK (ignoring datastore lock, candidate data will not change) */
+    lock = &mod->shm_mod->data_lock_info[SR_DS_CANDIDATE].lock;
+    if ((err_info = sr_rwlock(lock, SR_MOD_LOCK_TIMEOUT * 1000, SR_LOCK_WRITE, __func__))) {
+        return err_info;
+    }
+
+    /* learn whether candidate was modified */
+    if ((err_info = sr_path_ds_shm(mod->ly_mod->name, SR_DS_CANDIDATE, 1, &path))) {
+        goto cleanup;
+    }
+    r = access(path, F_OK);
+    free(path);
+    if ((r == -1) && (errno != ENOENT)) {
+        SR_ERRINFO_SYSERRNO(&err_info, "access");
+        goto cleanup;
+    } else if (r == -1) {
+        /* candidate is the same as running */
+        goto cleanup;
+    }
+
+    if (mod->state & MOD_INFO_CAND_COMMIT) {
+        /* candidate diff was applied, reset candidate */
+        if ((err_info = sr_path_ds_shm(mod->ly_mod->name, SR_DS_CANDIDATE, 0, &path))) {
+            goto cleanup;
+        }
+        if ((shm_unlink(path) == -1) && (errno != ENOENT)) {
+            SR_LOG_WRN("Failed to unlink \"%s\" (%s).", path, strerror(errno));
+        }
+        free(path);
+        goto cleanup;
+    }
+
+    if (mod->shm_mod->cand_ver != mod->shm_mod->ver) {
+        /* stale diff, ignored anyway */
+        goto cleanup;
+    }
+
+    /* candidate data are the current running data with the diff applied */
+    if ((err_info = sr_module_candidate_diff_load(mod, &diff))) {
+        goto cleanup;
+    }
+    if ((err_info = sr_module_file_data_append(mod->ly_mod, SR_DS_RUNNING, &cand_data))) {
+        goto cleanup;
+    }
+    if ((err_info = sr_diff_mod_apply(diff, mod->ly_mod, 0, &cand_data))) {
+        goto cleanup;
+    }
+    lyd_free_withsiblings(diff);
+    diff = NULL;
+
+    /* create the diff from the new running data */
+    if (!(ly_diff = lyd_diff(new_data, cand_data, LYD_DIFFOPT_WITHDEFAULTS))) {
+        sr_errinfo_new_ly(&err_info, mod->ly_mod->ctx);
+        goto cleanup;
+    }
+    if ((ly_diff->type[0] != LYD_DIFF_END) && (err_info = sr_diff_ly2sr(ly_diff, &diff))) {
+        goto cleanup;
+    }
+    if ((err_info = sr_module_file_data_set(mod->ly_mod->name, SR_DS_CANDIDATE, 0, diff))) {
+        goto cleanup;
+    }
+
+    /* the diff is now based on the new running data */
+    mod->shm_mod->cand_ver = mod->shm_mod->ver + 1;
+
+cleanup:
+    if (err_info) {
+        /* CANDIDATE UNLOCK */
+        sr_rwunlock(lock, SR_LOCK_WRITE, __func__);
+    } else {
+        *cand_lock = lock;
+    }
+    lyd_free_diff(ly_diff);
+    lyd_free_withsiblings(diff);
+    lyd_free_withsiblings(cand_data);
+    return err_info;
+}
+
+sr_error_info_t *
+sr_modinfo_candidate_apply(struct sr_mod_info_s *mod_info)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_mod_info_mod_s *mod;
+    struct lyd_node *diff;
+    sr_rwlock_t *lock;
+    uint32_t i;
+
+    assert((mod_info->ds == SR_DS_RUNNING) && !mod_info->diff);
+
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        mod = &mod_info->mods[i];
+        if (!(mod->state & MOD_INFO_REQ)) {
+            continue;
+        }
+
+        /* CANDIDATE READ LOCK */
+        lock = &mod->shm_mod->data_lock_info[SR_DS_CANDIDATE].lock;
+        if ((err_info = sr_rwlock(lock, SR_MOD_LOCK_TIMEOUT * 1000, SR_LOCK_READ, __func__))) {
+            return err_info;
+        }
+
+        /* running data are locked so the diff cannot become stale */
+        err_info = sr_module_candidate_diff_load(mod, &diff);
+
+        /* CANDIDATE UNLOCK */
+        sr_rwunlock(lock, SR_LOCK_READ, __func__);
+
+        if (err_info) {
+            return err_info;
+        }
+        if (!diff) {
+            continue;
+        }
+
+        /* apply the diff and use it as the changes */
+        if ((err_info = sr_diff_mod_apply(diff, mod->ly_mod, 0, &mod_info->data))) {
+            lyd_free_withsiblings(diff);
+            return err_info;
+        }
+        mod->state |= MOD_INFO_CHANGED | MOD_INFO_CAND_COMMIT;
+        if (mod_info->diff) {
+            sr_ly_link(mod_info->diff, diff);
+        } else {
+            mod_info->diff = diff;
+        }
+    }
+
+    return NULL;
+}
+
+sr_error_info_t *
+sr_modinfo_subtree_check(const struct sr_mod_info_s *mod_info)
+{
+    sr_error_info_t *err_info = NULL;
+    const struct sr_mod_info_mod_s *mod;
+    const struct lyd_node *root;
+    uint32_t i, hash;
+    uint16_t j;
+
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        mod = &mod_info->mods[i];
+        if (!(mod->state & MOD_INFO_SUBTREE)) {
+            continue;
+        }
+
+        LY_TREE_FOR(mod_info->diff, root) {
+            if (lyd_node_module(root) != mod->ly_mod) {
+                continue;
+            }
+
+            if ((err_info = sr_modinfo_subtree_hash(root, &hash))) {
+                return err_info;
+            }
+            for (j = 0; (j < mod->subtree_hash_count) && (mod->subtree_hashes[j] != hash); ++j);
+            if (j == mod->subtree_hash_count) {
+                sr_errinfo_new(&err_info, SR_ERR_OPERATION_FAILED, NULL, "Module \"%s\" changes are not limited"
+                        " to the locked subtrees.", mod->ly_mod->name);
+                return err_info;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Apply changes of a module with only its subtrees locked on its current running data, which could have
+ * been changed since the module data were loaded. Mod info module data are replaced.
+ *
+ * @param[in] mod_info Mod info to use.
+ * @param[in] mod Mod info module to process.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_modinfo_subtree_rebase_mod(struct sr_mod_info_s *mod_info, struct sr_mod_info_mod_s *mod)
+{
+    sr_error_info_t *err_info = NULL;
+    struct lyd_node *mod_data = NULL;
+
+    /* apply the changes on the current data */
+    if ((err_info = sr_module_file_data_append(mod->ly_mod, SR_DS_RUNNING, &mod_data))) {
+        goto cleanup;
+    }
+    if ((err_info = sr_diff_mod_apply(mod_info->diff, mod->ly_mod, 0, &mod_data))) {
+        goto cleanup;
+    }
+
+    /* replace the module data */
+    lyd_free_withsiblings(sr_module_data_unlink(&mod_info->data, mod->ly_mod));
+    if (mod_info->data) {
+        sr_ly_link(mod_info->data, mod_data);
+    } else {
+        mod_info->data = mod_data;
+    }
+    mod_data = NULL;
+
+    /* constraints between the subtrees must still hold */
+    if (lyd_validate_modules(&mod_info->data, &mod->ly_mod, 1, LYD_OPT_CONFIG)) {
+        sr_errinfo_new_ly(&err_info, mod_info->conn->ly_ctx);
+        SR_ERRINFO_VALID(&err_info);
+        goto cleanup;
+    }
+    mod->run_ver = mod->shm_mod->ver;
+
+cleanup:
+    lyd_free_withsiblings(mod_data);
+    return err_info;
+}
+
+sr_error_info_t *
+sr_modinfo_subtree_rebase(struct sr_mod_info_s *mod_info)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_mod_info_mod_s *mod;
+    uint32_t i;
+
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        mod = &mod_info->mods[i];
+        if (!(mod->state & MOD_INFO_SUBTREE) || !(mod->state & MOD_INFO_CHANGED)
+                || (mod->shm_mod->ver == mod->run_ver)) {
+            /* the whole module is locked or no other subtrees were changed since the data were loaded */
+            continue;
+        }
+
+        if ((err_info = sr_modinfo_subtree_rebase_mod(mod_info, mod))) {
+            return err_info;
+        }
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_modinfo_data_store(struct sr_mod_info_s *mod_info)
 {
     sr_error_info_t *err_info = NULL, *tmp_err_info = NULL;
     struct sr_mod_info_mod_s *mod;
     struct lyd_node *mod_data, *diff = NULL;
+    sr_rwlock_t *cand_lock = NULL;
     uint32_t i;
-    int change, create_flags;
+    int change, startup_stored = 0;
 
     assert(!mod_info->data_cached);
 
-    /* candidate file may need to be created */
-    if (mod_info->ds == SR_DS_CANDIDATE) {
-        create_flags = O_CREAT;
-    } else {
-        create_flags = 0;
-    }
-
     for (i = 0; i < mod_info->mod_count; ++i) {
         mod = &mod_info->mods[i];
         if (mod->state & MOD_INFO_CHANGED) {
@@ -1814,19 +2412,59 @@ sr_modinfo_data_store(struct sr_mod_info_s *mod_info)
                 }
                 lyd_free_withsiblings(diff);
                 diff = NULL;
+            } else if (mod_info->ds == SR_DS_CANDIDATE) {
+                if (mod->shm_mod->ver != mod->run_ver) {
+                    /* the stored diff cannot be based on the running data candidate was loaded on */
+                    sr_errinfo_new(&err_info, SR_ERR_OPERATION_FAILED, NULL, "Module \"%s\" running data were changed"
+                            " concurrently, candidate changes cannot be stored.", mod->ly_mod->name);
+                    goto cleanup;
+                }
+
+                /* load current diff and merge it with the new diff */
+                if ((err_info = sr_module_candidate_diff_load(mod, &diff))) {
+                    goto cleanup;
+                }
+                if ((err_info = sr_diff_mod_merge(mod_info->diff, NULL, mod->ly_mod, &diff, NULL))) {
+                    goto cleanup;
+                }
+
+                /* store the new diff, even an empty one marks candidate as modified */
+                if ((err_info = sr_module_file_data_set(mod->ly_mod->name, SR_DS_CANDIDATE, O_CREAT, diff))) {
+                    goto cleanup;
+                }
+                mod->shm_mod->cand_ver = mod->run_ver;
+                lyd_free_withsiblings(diff);
+                diff = NULL;
             } else {
+                /* modules with only subtrees locked must have been rebased */
+                assert(!(mod->state & MOD_INFO_SUBTREE) || (mod->shm_mod->ver == mod->run_ver));
+
                 /* separate data of this module */
                 mod_data = sr_module_data_unlink(&mod_info->data, mod->ly_mod);
 
+                if ((mod_info->ds == SR_DS_RUNNING)
+                        && (err_info = sr_modinfo_candidate_rebase(mod, mod_data, &cand_lock))) {
+                    goto cleanup;
+                }
+
                 /* store the new data */
-                if ((err_info = sr_module_file_data_set(mod->ly_mod->name, mod_info->ds, create_flags, mod_data))) {
+                if ((err_info = sr_module_file_data_set(mod->ly_mod->name, mod_info->ds, 0, mod_data))) {
                     goto cleanup;
                 }
+                if (mod_info->ds == SR_DS_STARTUP) {
+                    startup_stored = 1;
+                }
 
                 if (mod_info->ds == SR_DS_RUNNING) {
                     /* update module running data version */
                     ++mod->shm_mod->ver;
 
+                    if (cand_lock) {
+                        /* CANDIDATE UNLOCK */
+                        sr_rwunlock(cand_lock, SR_LOCK_WRITE, __func__);
+                        cand_lock = NULL;
+                    }
+
                     if (mod_info->conn->opts & SR_CONN_CACHE_RUNNING) {
                         /* we are caching so update cache with these data,
                          * HACK data are simply removed from mod_info because they are no longer
@@ -1865,7 +2503,16 @@ sr_modinfo_data_store(struct sr_mod_info_s *mod_info)
         }
     }
 
+    if (startup_stored) {
+        /* make all the stored startup files durable at once */
+        err_info = sr_startup_dir_sync();
+    }
+
 cleanup:
+    if (cand_lock) {
+        /* CANDIDATE UNLOCK */
+        sr_rwunlock(cand_lock, SR_LOCK_WRITE, __func__);
+    }
     if (tmp_err_info) {
         sr_errinfo_merge(&err_info, tmp_err_info);
     }
@@ -1900,9 +2547,117 @@ sr_modinfo_candidate_reset(struct sr_mod_info_s *mod_info)
     return NULL;
 }
 
+sr_error_info_t *
+sr_modinfo_query_prepare(sr_conn_ctx_t *conn, const char *xpath, sr_datastore_t ds, sr_query_t *query)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_mod_info_s mod_info;
+    uint32_t i;
+
+    memset(&mod_info, 0, sizeof mod_info);
+
+    /* collect all required modules */
+    if ((err_info = sr_shmmod_collect_xpath(conn, xpath, ds, &mod_info))) {
+        goto cleanup;
+    }
+
+    if (mod_info.mod_count) {
+        query->mods = calloc(mod_info.mod_count, sizeof *query->mods);
+        SR_CHECK_MEM_GOTO(!query->mods, err_info, cleanup);
+    }
+
+    /* remember them in the same (locking) order */
+    for (i = 0; i < mod_info.mod_count; ++i) {
+        query->mods[i].shm_mod = mod_info.mods[i].shm_mod;
+        query->mods[i].ly_mod = mod_info.mods[i].ly_mod;
+        query->mods[i].state = mod_info.mods[i].state & MOD_INFO_TYPE_MASK;
+    }
+    query->mod_count = mod_info.mod_count;
+
+cleanup:
+    sr_modinfo_free(&mod_info);
+    return err_info;
+}
+
+/**
+ * @brief Evaluate which operational subscriptions of a prepared query module are required by the query.
+ *
+ * @param[in] xpath Query XPath.
+ * @param[in] ext_shm_addr Ext SHM address.
+ * @param[in,out] qmod Prepared query module to update.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_modinfo_query_oper_subs(const char *xpath, char *ext_shm_addr, struct sr_query_mod_s *qmod)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_mod_oper_sub_t *shm_msub;
+    uint16_t i;
+
+    qmod->oper_sub_req = sr_realloc(qmod->oper_sub_req, qmod->shm_mod->oper_sub_count * sizeof *qmod->oper_sub_req);
+    if (!qmod->oper_sub_req) {
+        qmod->oper_sub_count = 0;
+        SR_ERRINFO_MEM(&err_info);
+        return err_info;
+    }
+
+    shm_msub = (sr_mod_oper_sub_t *)(ext_shm_addr + qmod->shm_mod->oper_subs);
+    for (i = 0; i < qmod->shm_mod->oper_sub_count; ++i) {
+        qmod->oper_sub_req[i] = sr_xpath_oper_data_required(xpath, ext_shm_addr + shm_msub[i].xpath);
+    }
+    qmod->oper_sub_count = qmod->shm_mod->oper_sub_count;
+    qmod->oper_sub_gen = qmod->shm_mod->oper_sub_gen;
+
+    return NULL;
+}
+
+sr_error_info_t *
+sr_modinfo_query_load(sr_query_t *query, struct sr_mod_info_s *mod_info)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_query_mod_s *qmod;
+    uint32_t i;
+
+    mod_info->ds = query->ds;
+    mod_info->conn = query->conn;
+
+    if (!query->mod_count) {
+        return NULL;
+    }
+
+    mod_info->mods = calloc(query->mod_count, sizeof *mod_info->mods);
+    SR_CHECK_MEM_RET(!mod_info->mods, err_info);
+    mod_info->mod_count = query->mod_count;
+
+    for (i = 0; i < query->mod_count; ++i) {
+        qmod = &query->mods[i];
+
+        mod_info->mods[i].shm_mod = qmod->shm_mod;
+        mod_info->mods[i].state = qmod->state;
+        mod_info->mods[i].ly_mod = qmod->ly_mod;
+
+        if ((query->ds != SR_DS_OPERATIONAL) || !(qmod->state & MOD_INFO_REQ) || !qmod->shm_mod->oper_sub_count) {
+            /* no operational subscriptions will be used */
+            continue;
+        }
+
+        if (!qmod->oper_sub_req || (qmod->oper_sub_gen != qmod->shm_mod->oper_sub_gen)) {
+            /* subscriptions changed since the last execution */
+            if ((err_info = sr_modinfo_query_oper_subs(query->xpath, query->conn->ext_shm.addr, qmod))) {
+                return err_info;
+            }
+        }
+        mod_info->mods[i].oper_sub_req = qmod->oper_sub_req;
+    }
+
+    return NULL;
+}
+
 void
 sr_modinfo_free(struct sr_mod_info_s *mod_info)
 {
+    uint32_t i;
+
     lyd_free_withsiblings(mod_info->diff);
     if (mod_info->data_cached) {
         mod_info->data_cached = 0;
@@ -1913,5 +2668,8 @@ sr_modinfo_free(struct sr_mod_info_s *mod_info)
         lyd_free_withsiblings(mod_info->data);
     }
 
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        free(mod_info->mods[i].subtree_hashes);
+    }
     free(mod_info->mods);
 }
@@ -34,6 +34,9 @@
 #define MOD_INFO_RLOCK   0x08 /* read-locked module */
 #define MOD_INFO_WLOCK   0x10 /* write-locked module */
 #define MOD_INFO_CHANGED 0x20 /* module data were changed */
+#define MOD_INFO_CAND_COMMIT 0x40 /* module candidate diff was applied, it is removed once the data are stored */
+#define MOD_INFO_SUBTREE 0x80 /* only subtrees of the module are write-locked */
+#define MOD_INFO_RUN_RLOCK 0x100 /* read-locked running data of a candidate module */
 
 /**
  * @brief Mod info structure, used for keeping all relevant modules for a data operation.
@@ -47,10 +50,15 @@ struct sr_mod_info_s {
 
     struct sr_mod_info_mod_s {
         sr_mod_t *shm_mod;      /**< Module SHM structure. */
-        uint8_t state;          /**< Module state (flags). */
+        uint16_t state;         /**< Module state (flags). */
         const struct lys_module *ly_mod;    /**< Module libyang structure. */
+        const uint8_t *oper_sub_req;    /**< Optional flags whether each operational subscription is required
+                                             by the request, evaluated from the request XPath if NULL. */
 
         uint32_t request_id;    /**< Request ID of the published event. */
+        uint32_t run_ver;       /**< Running data version running or candidate data were loaded on. */
+        uint32_t *subtree_hashes;   /**< Hashes of top-level list instances to WRITE-lock instead of the module. */
+        uint16_t subtree_hash_count;    /**< Subtree hash count. */
     } *mods;                    /**< Relevant modules. */
     uint32_t mod_count;         /**< Modules count. */
 };
@@ -98,6 +106,26 @@ struct sr_mod_info_mod_s *sr_modinfo_next_mod(struct sr_mod_info_mod_s *last, st
  */
 sr_error_info_t *sr_modinfo_edit_apply(struct sr_mod_info_s *mod_info, const struct lyd_node *edit, int create_diff);
 
+/**
+ * @brief Learn whether an applied edit changed nothing, not even default flags, so that the data
+ * do not need to be validated nor stored.
+ *
+ * @param[in] mod_info Mod info with an applied edit.
+ * @return non-zero if the edit was a no-op, 0 otherwise.
+ */
+int sr_modinfo_edit_noop(const struct sr_mod_info_s *mod_info);
+
+/**
+ * @brief Collect hashes of top-level list instances changed by an edit in required running modules
+ * with a subtree lock so that only these subtrees are WRITE-locked. Modules with inverse dependencies
+ * or edits of any other top-level nodes are WRITE-locked as a whole.
+ *
+ * @param[in] mod_info Mod info to update.
+ * @param[in] edit Edit to be applied.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_subtree_collect(struct sr_mod_info_s *mod_info, const struct lyd_node *edit);
+
 /**
  * @brief Merge sysrepo diff to mod info diff.
  *
@@ -108,7 +136,18 @@ sr_error_info_t *sr_modinfo_edit_apply(struct sr_mod_info_s *mod_info, const str
 sr_error_info_t *sr_modinfo_diff_merge(struct sr_mod_info_s *mod_info, struct lyd_node *orig_diff);
 
 /**
- * @brief Replace mod info data with new data.
+ * @brief Learn whether anyone can observe changes of mod info modules, either by a change subscription,
+ * connection diff callback, or a generated netconf-config-change notification.
+ *
+ * @param[in] mod_info Mod info to use.
+ * @param[out] observed Whether the changes can be observed.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_changes_observed(struct sr_mod_info_s *mod_info, int *observed);
+
+/**
+ * @brief Replace mod info data with new data. No diff is created for modules whose changes
+ * cannot be observed by anyone, they are only flagged as changed.
  *
  * @param[in] mod_info Mod info to use.
  * @param[in,out] src_data New data to set, are spent.
@@ -116,6 +155,15 @@ sr_error_info_t *sr_modinfo_diff_merge(struct sr_mod_info_s *mod_info, struct ly
  */
 sr_error_info_t *sr_modinfo_replace(struct sr_mod_info_s *mod_info, struct lyd_node **src_data);
 
+/**
+ * @brief Apply stored candidate diffs of all the required modules on mod info running data so that they
+ * can be committed. The applied diffs become the mod info diff.
+ *
+ * @param[in] mod_info Mod info with loaded running data.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_candidate_apply(struct sr_mod_info_s *mod_info);
+
 /**
  * @brief Validate data for modules in mod info.
  *
@@ -139,7 +187,8 @@ sr_error_info_t *sr_modinfo_validate(struct sr_mod_info_s *mod_info, int finish_
 sr_error_info_t *sr_modinfo_add_defaults(struct sr_mod_info_s *mod_info, int finish_diff);
 
 /**
- * @brief Validate operation using modules in mod info.
+ * @brief Validate operation using modules in mod info. The same mod info (and its data)
+ * can be used for validating several operations.
  *
  * @param[in] mod_info Mod info to use.
  * @param[in] op Operation data tree (RPC/action/notification).
@@ -155,6 +204,21 @@ sr_error_info_t *sr_modinfo_add_defaults(struct sr_mod_info_s *mod_info, int fin
 sr_error_info_t *sr_modinfo_op_validate(struct sr_mod_info_s *mod_info, struct lyd_node *op, sr_mod_data_dep_t *shm_deps,
         uint16_t shm_dep_count, int output, sr_sid_t *sid, uint32_t timeout_ms, sr_error_info_t **cb_error_info);
 
+/**
+ * @brief Decide which operational subscriptions of operation dependency modules need to be called
+ * to validate the operations. Only subscriptions providing the referenced subtrees are called for
+ * modules whose data are not referenced as a whole. Should be called just before loading the data.
+ *
+ * @param[in] mod_info Mod info with the collected operation dependency modules.
+ * @param[in] shm_deps Main SHM dependencies of each operation.
+ * @param[in] shm_dep_counts Main SHM dependency count of each operation.
+ * @param[in] op_count Operation count.
+ * @param[out] oper_sub_req Flags referenced by mod info modules, to be freed once the data are loaded.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_op_oper_subs(struct sr_mod_info_s *mod_info, sr_mod_data_dep_t * const *shm_deps,
+        const uint16_t *shm_dep_counts, uint32_t op_count, uint8_t **oper_sub_req);
+
 /**
  * @brief Load data for modules in mod info.
  *
@@ -192,6 +256,25 @@ sr_error_info_t *sr_modinfo_get_filter(struct sr_mod_info_s *mod_info, const cha
  */
 sr_error_info_t *sr_modinfo_generate_config_change_notif(struct sr_mod_info_s *mod_info, sr_session_ctx_t *session);
 
+/**
+ * @brief Check that changes of modules with only their subtrees locked do not affect any other subtrees,
+ * which could be locked and changed by other sessions.
+ *
+ * @param[in] mod_info Mod info with the final diff.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_subtree_check(const struct sr_mod_info_s *mod_info);
+
+/**
+ * @brief Apply changes of modules with only their subtrees locked on their current running data, which
+ * could have been changed since the data were loaded, and validate them. Must be called with the modules
+ * WRITE-locked, before the data are stored.
+ *
+ * @param[in] mod_info Mod info to use.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_subtree_rebase(struct sr_mod_info_s *mod_info);
+
 /**
  * @brief Store data (persistently) from mod info.
  *
@@ -208,6 +291,28 @@ sr_error_info_t *sr_modinfo_data_store(struct sr_mod_info_s *mod_info);
  */
 sr_error_info_t *sr_modinfo_candidate_reset(struct sr_mod_info_s *mod_info);
 
+/**
+ * @brief Collect all modules required by a query XPath and remember them in a prepared query.
+ * Main SHM read lock must be held.
+ *
+ * @param[in] conn Connection to use.
+ * @param[in] xpath Query XPath.
+ * @param[in] ds Datastore.
+ * @param[in,out] query Prepared query to fill.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_query_prepare(sr_conn_ctx_t *conn, const char *xpath, sr_datastore_t ds, sr_query_t *query);
+
+/**
+ * @brief Fill mod info from a prepared query, refreshing any outdated cached information about
+ * operational subscriptions. Main SHM read lock must be held.
+ *
+ * @param[in] query Prepared query.
+ * @param[in,out] mod_info Empty mod info to fill.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_modinfo_query_load(sr_query_t *query, struct sr_mod_info_s *mod_info);
+
 /**
  * @brief Free mod info.
  *
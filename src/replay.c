@@ -357,12 +357,12 @@ cleanup:
  *
  * @param[in] ly_mod Notification module.
  * @param[in] shm_mod Notification SHM module.
- * @param[in] notif_lyb Notification in LYB format, is spent!
+ * @param[in] notif_lyb Notification in LYB format.
  * @param[in] notif_ts Notification timestamp.
  * @return err_info, NULL on success.
  */
 static sr_error_info_t *
-sr_notif_write(const struct lys_module *ly_mod, sr_mod_t *shm_mod, char *notif_lyb, time_t notif_ts)
+sr_notif_write(const struct lys_module *ly_mod, sr_mod_t *shm_mod, const char *notif_lyb, time_t notif_ts)
 {
     sr_error_info_t *err_info = NULL;
     time_t from_ts, to_ts;
@@ -433,7 +433,6 @@ cleanup:
     if (fd > -1) {
         close(fd);
     }
-    free(notif_lyb);
     return err_info;
 }
 
@@ -502,11 +501,12 @@ error:
 }
 
 sr_error_info_t *
-sr_replay_store(sr_session_ctx_t *sess, const struct lyd_node *notif, time_t notif_ts)
+sr_replay_store(sr_session_ctx_t *sess, const struct lyd_node *notif, const char *notif_lyb, time_t notif_ts)
 {
     sr_error_info_t *err_info = NULL;
     sr_mod_t *shm_mod;
-    char *notif_lyb;
+    char *notif_lyb_dup;
+    int notif_lyb_len;
     const struct lys_module *ly_mod;
     struct lyd_node *notif_op;
 
@@ -528,16 +528,16 @@ sr_replay_store(sr_session_ctx_t *sess, const struct lyd_node *notif, time_t not
         return NULL;
     }
 
-    /* convert notification into LYB */
-    if (lyd_print_mem(&notif_lyb, notif, LYD_LYB, LYP_WITHSIBLINGS)) {
-        sr_errinfo_new_ly(&err_info, ly_mod->ctx);
-        return err_info;
-    }
-
-    /* notif_lyb is always spent! */
     if (sess->notif_buf.tid) {
+        /* the buffer outlives the caller LYB, store its copy (it is always spent) */
+        notif_lyb_len = lyd_lyb_data_length(notif_lyb);
+        SR_CHECK_INT_RET(notif_lyb_len == -1, err_info);
+        notif_lyb_dup = malloc(notif_lyb_len);
+        SR_CHECK_MEM_RET(!notif_lyb_dup, err_info);
+        memcpy(notif_lyb_dup, notif_lyb, notif_lyb_len);
+
         /* store the notification in the buffer */
-        if ((err_info = sr_notif_buf_store(&sess->notif_buf, ly_mod, notif_lyb, notif_ts))) {
+        if ((err_info = sr_notif_buf_store(&sess->notif_buf, ly_mod, notif_lyb_dup, notif_ts))) {
             return err_info;
         }
         SR_LOG_INF("Notification \"%s\" buffered to be stored for replay.", notif_op->schema->name);
@@ -602,7 +602,7 @@ sr_notif_buf_thread(void *arg)
                 break;
             }
 
-            /* store the notification, continue normally on error (notif_lyb is spent!) */
+            /* store the notification, continue normally on error */
             err_info = sr_notif_write(first->notif_mod, shm_mod, first->notif_lyb, first->notif_ts);
             sr_errinfo_free(&err_info);
 
@@ -611,6 +611,7 @@ sr_notif_buf_thread(void *arg)
             first = first->next;
 
             /* free prev */
+            free(prev->notif_lyb);
             free(prev);
         }
     }
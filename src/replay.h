@@ -49,10 +49,12 @@ sr_error_info_t *sr_replay_find_file(const char *mod_name, time_t from_ts, time_
  *
  * @param[in] sess Session to use.
  * @param[in] notif Notification to store.
+ * @param[in] notif_lyb Notification printed in LYB format, the same buffer is used for publishing it.
  * @param[in] notif_ts Notification timestamp to store.
  * @return err_info, NULL on success.
  */
-sr_error_info_t *sr_replay_store(sr_session_ctx_t *sess, const struct lyd_node *notif, time_t notif_ts);
+sr_error_info_t *sr_replay_store(sr_session_ctx_t *sess, const struct lyd_node *notif, const char *notif_lyb,
+        time_t notif_ts);
 
 /**
  * @brief Notification buffer thread.
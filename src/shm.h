@@ -69,7 +69,8 @@ typedef enum sr_mod_dep_type_e {
 struct sr_mod_data_dep_s {
     sr_mod_dep_type_t type;     /**< Dependency type. */
     off_t module;               /**< Dependant module name. */
-    off_t xpath;                /**< XPath of the node with the dependency. */
+    off_t xpath;                /**< XPath of the node with the dependency (instance-identifier) or of the only
+                                     referenced subtree of the module (operation module reference), 0 if whole module. */
 };
 
 /**
@@ -133,13 +134,21 @@ struct sr_mod_s {
         uint8_t ds_locked;      /**< Whether module data are datastore locked (NETCONF locks). */
         sr_sid_t sid;           /**< Session ID of the locking session (user is always NULL). */
         time_t ds_ts;           /**< Timestamp of the datastore lock. */
+
+        struct {
+            uint32_t hash;      /**< Hash of the WRITE-locked top-level list instance. */
+            pid_t pid;          /**< PID of the process holding the lock. */
+        } subtrees[SR_MOD_SUBTREE_LOCK_COUNT];  /**< WRITE-locked subtrees, the module itself is not WRITE-locked. */
+        uint16_t subtree_count; /**< Number of WRITE-locked subtrees. */
     } data_lock_info[SR_DS_COUNT]; /**< Module data lock information for each datastore. */
     sr_rwlock_t replay_lock;    /**< Process-shared lock for accessing stored notifications for replay. */
     uint32_t ver;               /**< Module data version (non-zero). */
+    uint32_t cand_ver;          /**< Running data version the stored candidate diff is based on. */
 
     off_t name;                 /**< Module name. */
     char rev[11];               /**< Module revision. */
     uint8_t flags;              /**< Module flags. */
+    off_t subtree_lock;         /**< Name of the top-level list whose instances are WRITE-locked separately, 0 if none. */
 
     off_t features;             /**< Array of enabled features (off_t *). */
     uint16_t feat_count;        /**< Number of enabled features. */
@@ -153,13 +162,17 @@ struct sr_mod_s {
     struct {
         off_t subs;             /**< Array of change subscriptions. */
         uint16_t sub_count;     /**< Number of change subscriptions. */
+        uint16_t sub_cap;       /**< Number of change subscriptions the array has room for. */
     } change_sub[SR_DS_COUNT];  /**< Change subscriptions for each datastore. */
 
     off_t oper_subs;            /**< Array of operational subscriptions. */
     uint16_t oper_sub_count;    /**< Number of operational subscriptions. */
+    uint16_t oper_sub_cap;      /**< Number of operational subscriptions the array has room for. */
+    uint32_t oper_sub_gen;      /**< Operational subscriptions generation, changed whenever one is added or removed. */
 
     off_t notif_subs;           /**< Array of notification subscriptions. */
     uint16_t notif_sub_count;   /**< Number of notification subscriptions. */
+    uint16_t notif_sub_cap;     /**< Number of notification subscriptions the array has room for. */
 };
 
 /**
@@ -179,6 +192,7 @@ typedef struct sr_rpc_s {
     off_t op_path;              /**< Simple path of the RPC/action subscribed to. */
     off_t subs;                 /**< Array of RPC/action subscriptions. */
     uint16_t sub_count;         /**< Number of RPC/action subscriptions. */
+    uint16_t sub_cap;           /**< Number of RPC/action subscriptions the array has room for. */
 } sr_rpc_t;
 
 /**
@@ -231,6 +245,8 @@ typedef struct sr_main_shm_s {
     struct {
         off_t conns;            /**< Array of existing connections. */
         uint32_t conn_count;    /**< Number of existing connections. */
+        struct timespec recover_ts; /**< Monotonic time when non-existent connections should be checked for again
+                                         by READ lockers. */
     } conn_state;               /**< Information about connection state. */
 } sr_main_shm_t;
 
@@ -303,7 +319,8 @@ typedef struct sr_multi_sub_shm_s {
  *
  * FOR SUBSCRIBERS
  * followed by:
- * event SR_SUB_EV_NOTIF - time_t notif_timestamp; char *notif_lyb - notification
+ * event SR_SUB_EV_NOTIF - time_t notif_timestamp; uint32_t notif_count; char *notif_lyb - notifications, notif_count
+ *                          of them one after another
  */
 
 /*
@@ -355,6 +372,16 @@ void sr_shmmain_ext_print(sr_shm_t *shm_main, char *ext_shm_addr, size_t ext_shm
  */
 sr_error_info_t *sr_shmmain_ext_defrag(sr_shm_t *shm_main, sr_shm_t *shm_ext, char **defrag_ext_buf);
 
+/**
+ * @brief Get the size of unused subscription array capacity in Ext SHM. It is included in the wasted memory
+ * but is expected to be reused by future subscriptions.
+ *
+ * @param[in] shm_main Main SHM.
+ * @param[in] ext_shm_addr Ext SHM mapping address.
+ * @return Ext SHM size of the unused capacity.
+ */
+size_t sr_shmmain_ext_get_unused_cap(sr_shm_t *shm_main, char *ext_shm_addr);
+
 /**
  * @brief Check all used directories and create them if any are missing.
  *
@@ -446,6 +473,15 @@ void sr_shmmain_state_del_evpipe(sr_conn_ctx_t *conn, uint32_t evpipe_num);
  */
 sr_error_info_t *sr_shmmain_state_recover(sr_conn_ctx_t *conn);
 
+/**
+ * @brief Learn whether checking for non-existent connections is due. It is done at most once
+ * per ::SR_CONN_RECOVER_INTERVAL when only READ locking main SHM. Main SHM lock mutex is expected to be held.
+ *
+ * @param[in] conn Connection to use.
+ * @return 0 if not, non-zero if it is.
+ */
+int sr_shmmain_state_recover_is_due(sr_conn_ctx_t *conn);
+
 /**
  * @brief Initialize libyang context with only the internal sysrepo module.
  *
@@ -623,6 +659,16 @@ sr_error_info_t *sr_shmmain_del_rpc(sr_main_shm_t *main_shm, char *ext_shm_addr,
  */
 sr_error_info_t *sr_shmmain_update_replay_support(sr_shm_t *shm_main, char *ext_shm_addr, const char *mod_name, int replay_support);
 
+/**
+ * @brief Change subtree lock of a module in main SHM. Main SHM must be WRITE-locked with remap.
+ *
+ * @param[in] conn Connection to use.
+ * @param[in] mod_name Module name.
+ * @param[in] list_name Top-level list whose instances to lock separately, NULL to lock only the whole module.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_shmmain_update_subtree_lock(sr_conn_ctx_t *conn, const char *mod_name, const char *list_name);
+
 /**
  * @brief Check data file existence and owner/permissions of all the modules in main SHM.
  * Startup file must always exist, owner/permissions are read from it.
@@ -690,7 +736,9 @@ sr_error_info_t *sr_shmmod_collect_op(sr_conn_ctx_t *conn, const char *op_path,
         sr_mod_data_dep_t **shm_deps, uint16_t *shm_dep_count, struct sr_mod_info_s *mod_info);
 
 /**
- * @brief READ lock all modules in mod info.
+ * @brief READ lock all modules in mod info. If upgradable, required modules with collected
+ * subtree hashes have only these subtrees WRITE-locked. Candidate modules have their running
+ * data READ-locked as well, before the candidate lock.
  *
  * @param[in] mod_info Mod info to use.
  * @param[in] upgradable Whether the lock will be upgraded to WRITE later.
@@ -699,6 +747,14 @@ sr_error_info_t *sr_shmmod_collect_op(sr_conn_ctx_t *conn, const char *op_path,
  */
 sr_error_info_t *sr_shmmod_modinfo_rdlock(struct sr_mod_info_s *mod_info, int upgradable, sr_sid_t sid);
 
+/**
+ * @brief READ unlock modules in mod info with WRITE-locked subtrees once their data were loaded
+ * so that changes of other subtrees can be stored meanwhile. Subtrees stay locked.
+ *
+ * @param[in] mod_info Mod info to use.
+ */
+void sr_shmmod_modinfo_subtree_rdunlock(struct sr_mod_info_s *mod_info);
+
 /**
  * @brief Upgrade READ lock on modules in mod info to WRITE lock.
  * Works only for upgradable READ lock, in which case there will only be one
@@ -888,6 +944,16 @@ sr_error_info_t *sr_shmsub_open_map(const char *name, const char *suffix1, int64
  */
 sr_error_info_t *sr_shmsub_notify_evpipe(uint32_t evpipe_num);
 
+/**
+ * @brief Learn whether there are any subscribers for changes of a module. Main SHM read lock is expected to be held.
+ *
+ * @param[in] conn Connection to use.
+ * @param[in] shm_mod SHM module.
+ * @param[in] ds Datastore.
+ * @return 0 if not, non-zero if there are.
+ */
+int sr_shmsub_change_has_subscription(sr_conn_ctx_t *conn, sr_mod_t *shm_mod, sr_datastore_t ds);
+
 /**
  * @brief Notify about (generate) a change "update" event.
  *
@@ -933,7 +999,8 @@ sr_error_info_t *sr_shmsub_change_notify_change(struct sr_mod_info_s *mod_info,
 sr_error_info_t *sr_shmsub_change_notify_change_done(struct sr_mod_info_s *mod_info, sr_sid_t sid);
 
 /**
- * @brief Notify about (generate) a change "abort" event.
+ * @brief Notify about (generate) a change "abort" event. If no callback failed, all the subscribers
+ * that processed the "change" event are notified.
  *
  * @param[in] mod_info Mod info to use.
  * @param[in] sid Originator sysrepo session ID.
@@ -962,6 +1029,7 @@ sr_error_info_t *sr_shmsub_oper_notify(const struct lys_module *ly_mod, const ch
 /**
  * @brief Notify about (generate) an RPC/action event.
  * Main SHM lock(0,0,0) must be held and this function may temporarily unlock it!
+ * The event is written into any free request slot so several requests of one RPC/action can be in flight.
  *
  * @param[in] conn Connection to use.
  * @param[in] op_path Path identifying the RPC/action.
@@ -990,44 +1058,50 @@ sr_error_info_t *sr_shmsub_rpc_notify_abort(sr_conn_ctx_t *conn, const char *op_
         sr_sid_t sid, uint32_t request_id);
 
 /**
- * @brief Notify about (generate) a notification event.
+ * @brief Notify about (generate) a notification event. All the notifications are published in a single event.
  *
- * @param[in] notif Notification data tree.
- * @param[in] notif_ts Notification timestamp.
+ * @param[in] ly_mod Module of all the notifications.
+ * @param[in] notif_lybs Array of notifications printed in LYB format.
+ * @param[in] notif_count Count of @p notif_lybs.
+ * @param[in] notif_ts Timestamp of the notifications.
  * @param[in] sid Originator sysrepo session ID.
  * @param[in] notif_sub_evpipe_nums Array of subscribers event pipe numbers.
  * @param[in] notif_sub_count Number of subscribers.
  * @return err_info, NULL on success.
  */
-sr_error_info_t *sr_shmsub_notif_notify(const struct lyd_node *notif, time_t notif_ts, sr_sid_t sid,
-        uint32_t *notif_sub_evpipe_nums, uint32_t notif_sub_count);
+sr_error_info_t *sr_shmsub_notif_notify(const struct lys_module *ly_mod, char * const *notif_lybs, uint32_t notif_count,
+        time_t notif_ts, sr_sid_t sid, uint32_t *notif_sub_evpipe_nums, uint32_t notif_sub_count);
 
 /**
  * @brief Process all module change events, if any.
  *
  * @param[in] change_subs Module change subscriptions.
- * @param[in] conn Connection to use.
+ * @param[in] subscription Subscription structure with the callback sessions and optional worker pool
+ * for calling callbacks of the same event in parallel.
  * @return err_info, NULL on success.
  */
-sr_error_info_t *sr_shmsub_change_listen_process_module_events(struct modsub_change_s *change_subs, sr_conn_ctx_t *conn);
+sr_error_info_t *sr_shmsub_change_listen_process_module_events(struct modsub_change_s *change_subs,
+        sr_subscription_ctx_t *subscription);
 
 /**
  * @brief Process all module operational events, if any.
  *
  * @param[in] oper_subs Module operational subscriptions.
- * @param[in] conn Connection to use.
+ * @param[in] subscription Subscription structure with the callback sessions.
  * @return err_info, NULL on success.
  */
-sr_error_info_t *sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs, sr_conn_ctx_t *conn);
+sr_error_info_t *sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs,
+        sr_subscription_ctx_t *subscription);
 
 /**
- * @brief Process all RPC/action events for one RPC/action, if any.
+ * @brief Process all RPC/action events in all the request slots for one RPC/action, if any.
  *
- * @param[in] rpc_sub RPC/action subscriptions.
- * @param[in] conn Connection to use.
+ * @param[in] rpc_subs RPC/action subscriptions.
+ * @param[in] subscription Subscription structure with the callback sessions.
  * @return err_info, NULL on success.
  */
-sr_error_info_t *sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs, sr_conn_ctx_t *conn);
+sr_error_info_t *sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs,
+        sr_subscription_ctx_t *subscription);
 
 /**
  * @brief Process all module notification events, if any.
@@ -1083,4 +1157,35 @@ sr_error_info_t *sr_shmsub_notif_listen_module_replay(struct modsub_notif_s *not
  */
 void *sr_shmsub_listen_thread(void *arg);
 
+/**
+ * @brief Start the event dispatcher handling events of all the subsequently created subscriptions.
+ *
+ * @param[in] thread_count Number of dispatcher threads.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_shmsub_dispatch_start(uint32_t thread_count);
+
+/**
+ * @brief Stop the event dispatcher, fails if it still handles any subscriptions.
+ *
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_shmsub_dispatch_stop(void);
+
+/**
+ * @brief Add subscriptions to the event dispatcher, if running.
+ *
+ * @param[in] subs Subscriptions structure.
+ * @param[out] added Whether the subscriptions were added and will be handled by the dispatcher.
+ * @return err_info, NULL on success.
+ */
+sr_error_info_t *sr_shmsub_dispatch_add(sr_subscription_ctx_t *subs, int *added);
+
+/**
+ * @brief Remove subscriptions from the event dispatcher, waits until they are not being processed.
+ *
+ * @param[in] subs Subscriptions structure.
+ */
+void sr_shmsub_dispatch_del(sr_subscription_ctx_t *subs);
+
 #endif
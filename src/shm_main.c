@@ -190,8 +190,8 @@ sr_shmmain_ext_print(sr_shm_t *shm_main, char *ext_shm_addr, size_t ext_shm_size
                 items = sr_realloc(items, (item_count + 1) * sizeof *items);
                 items[item_count].start = shm_rpc[i].subs;
                 items[item_count].size = shm_rpc[i].sub_count * sizeof *rpc_subs;
-                asprintf(&(items[item_count].name), "rpc subs (%u, op_path \"%s\")", shm_rpc[i].sub_count,
-                        ext_shm_addr + shm_rpc[i].op_path);
+                asprintf(&(items[item_count].name), "rpc subs (%u/%u, op_path \"%s\")", shm_rpc[i].sub_count,
+                        shm_rpc[i].sub_cap, ext_shm_addr + shm_rpc[i].op_path);
                 ++item_count;
 
                 rpc_subs = (sr_rpc_sub_t *)(ext_shm_addr + shm_rpc[i].subs);
@@ -216,6 +216,16 @@ sr_shmmain_ext_print(sr_shm_t *shm_main, char *ext_shm_addr, size_t ext_shm_size
         asprintf(&(items[item_count].name), "module name (\"%s\")", ext_shm_addr + shm_mod->name);
         ++item_count;
 
+        if (shm_mod->subtree_lock) {
+            /* add subtree lock list name */
+            items = sr_realloc(items, (item_count + 1) * sizeof *items);
+            items[item_count].start = shm_mod->subtree_lock;
+            items[item_count].size = sr_strshmlen(ext_shm_addr + shm_mod->subtree_lock);
+            asprintf(&(items[item_count].name), "subtree lock (\"%s\", mod \"%s\")", ext_shm_addr + shm_mod->subtree_lock,
+                    ext_shm_addr + shm_mod->name);
+            ++item_count;
+        }
+
         if (shm_mod->features) {
             /* add features array */
             items = sr_realloc(items, (item_count + 1) * sizeof *items);
@@ -287,8 +297,8 @@ sr_shmmain_ext_print(sr_shm_t *shm_main, char *ext_shm_addr, size_t ext_shm_size
                 items = sr_realloc(items, (item_count + 1) * sizeof *items);
                 items[item_count].start = shm_mod->change_sub[ds].subs;
                 items[item_count].size = shm_mod->change_sub[ds].sub_count * sizeof *change_subs;
-                asprintf(&(items[item_count].name), "%s change subs (%u, mod \"%s\")", sr_ds2str(ds),
-                        shm_mod->change_sub[ds].sub_count, ext_shm_addr + shm_mod->name);
+                asprintf(&(items[item_count].name), "%s change subs (%u/%u, mod \"%s\")", sr_ds2str(ds),
+                        shm_mod->change_sub[ds].sub_count, shm_mod->change_sub[ds].sub_cap, ext_shm_addr + shm_mod->name);
                 ++item_count;
 
                 /* add xpaths */
@@ -311,8 +321,8 @@ sr_shmmain_ext_print(sr_shm_t *shm_main, char *ext_shm_addr, size_t ext_shm_size
             items = sr_realloc(items, (item_count + 1) * sizeof *items);
             items[item_count].start = shm_mod->oper_subs;
             items[item_count].size = shm_mod->oper_sub_count * sizeof *oper_subs;
-            asprintf(&(items[item_count].name), "oper subs (%u, mod \"%s\")", shm_mod->oper_sub_count,
-                    ext_shm_addr + shm_mod->name);
+            asprintf(&(items[item_count].name), "oper subs (%u/%u, mod \"%s\")", shm_mod->oper_sub_count,
+                    shm_mod->oper_sub_cap, ext_shm_addr + shm_mod->name);
             ++item_count;
 
             /* add xpaths */
@@ -474,11 +484,11 @@ sr_shmmain_defrag_copy_array_with_string(char *ext_shm_addr, off_t array, size_t
     off_t ret, *item;
     uint16_t i;
 
-    if (!array && !count) {
-        /* empty array */
+    if (!count) {
+        /* empty array (subscription arrays may still have some capacity left) */
         return 0;
     }
-    assert(array && count);
+    assert(array);
 
     /* current offset */
     ret = *ext_buf_cur - ext_buf;
@@ -532,6 +542,11 @@ sr_shmmain_ext_defrag(sr_shm_t *shm_main, sr_shm_t *shm_ext, char **defrag_ext_b
 
     /* 2) copy the rest of arrays */
     SR_SHM_MOD_FOR(shm_main->addr, shm_main->size, shm_mod) {
+        /* copy subtree lock list name */
+        if (shm_mod->subtree_lock) {
+            shm_mod->subtree_lock = sr_shmstrcpy(ext_buf, shm_ext->addr + shm_mod->subtree_lock, &ext_buf_cur);
+        }
+
         /* copy and update features */
         shm_mod->features = sr_shmmain_defrag_copy_array_with_string(shm_ext->addr, shm_mod->features, sizeof(off_t),
                 shm_mod->feat_count, ext_buf, &ext_buf_cur);
@@ -558,15 +573,22 @@ sr_shmmain_ext_defrag(sr_shm_t *shm_main, sr_shm_t *shm_ext, char **defrag_ext_b
                     old_op_deps[i].out_dep_count, ext_buf, &ext_buf_cur);
         }
 
-        /* copy change subscriptions */
+        /* copy change subscriptions, any unused capacity is dropped */
         for (i = 0; i < SR_DS_COUNT; ++i) {
             shm_mod->change_sub[i].subs = sr_shmmain_defrag_copy_array_with_string(shm_ext->addr, shm_mod->change_sub[i].subs,
                     sizeof(sr_mod_change_sub_t), shm_mod->change_sub[i].sub_count, ext_buf, &ext_buf_cur);
+            shm_mod->change_sub[i].sub_cap = shm_mod->change_sub[i].sub_count;
         }
 
         /* copy operational subscriptions */
         shm_mod->oper_subs = sr_shmmain_defrag_copy_array_with_string(shm_ext->addr, shm_mod->oper_subs,
                 sizeof(sr_mod_oper_sub_t), shm_mod->oper_sub_count, ext_buf, &ext_buf_cur);
+        shm_mod->oper_sub_cap = shm_mod->oper_sub_count;
+
+        /* copy notification subscriptions */
+        shm_mod->notif_subs = sr_shmcpy(ext_buf, shm_ext->addr + shm_mod->notif_subs,
+                shm_mod->notif_sub_count * sizeof(sr_mod_notif_sub_t), &ext_buf_cur);
+        shm_mod->notif_sub_cap = shm_mod->notif_sub_count;
     }
 
     main_shm = (sr_main_shm_t *)shm_main->addr;
@@ -597,6 +619,7 @@ sr_shmmain_ext_defrag(sr_shm_t *shm_main, sr_shm_t *shm_ext, char **defrag_ext_b
     for (i = 0; i < main_shm->rpc_sub_count; ++i) {
         shm_rpc[i].subs = sr_shmmain_defrag_copy_array_with_string(shm_ext->addr, shm_rpc[i].subs,
                 sizeof(sr_rpc_sub_t), shm_rpc[i].sub_count, ext_buf, &ext_buf_cur);
+        shm_rpc[i].sub_cap = shm_rpc[i].sub_count;
     }
 
     /* check size */
@@ -610,6 +633,33 @@ sr_shmmain_ext_defrag(sr_shm_t *shm_main, sr_shm_t *shm_ext, char **defrag_ext_b
     return NULL;
 }
 
+size_t
+sr_shmmain_ext_get_unused_cap(sr_shm_t *shm_main, char *ext_shm_addr)
+{
+    size_t unused = 0;
+    sr_main_shm_t *main_shm;
+    sr_mod_t *shm_mod;
+    sr_rpc_t *shm_rpc;
+    uint16_t i;
+
+    main_shm = (sr_main_shm_t *)shm_main->addr;
+
+    SR_SHM_MOD_FOR(shm_main->addr, shm_main->size, shm_mod) {
+        for (i = 0; i < SR_DS_COUNT; ++i) {
+            unused += (shm_mod->change_sub[i].sub_cap - shm_mod->change_sub[i].sub_count) * sizeof(sr_mod_change_sub_t);
+        }
+        unused += (shm_mod->oper_sub_cap - shm_mod->oper_sub_count) * sizeof(sr_mod_oper_sub_t);
+        unused += (shm_mod->notif_sub_cap - shm_mod->notif_sub_count) * sizeof(sr_mod_notif_sub_t);
+    }
+
+    shm_rpc = (sr_rpc_t *)(ext_shm_addr + main_shm->rpc_subs);
+    for (i = 0; i < main_shm->rpc_sub_count; ++i) {
+        unused += (shm_rpc[i].sub_cap - shm_rpc[i].sub_count) * sizeof(sr_rpc_sub_t);
+    }
+
+    return unused;
+}
+
 sr_error_info_t *
 sr_shmmain_check_dirs(void)
 {
@@ -916,6 +966,42 @@ sr_shmmain_state_del_evpipe(sr_conn_ctx_t *conn, uint32_t evpipe_num)
     }
 }
 
+/**
+ * @brief Learn whether a module has any subscriptions.
+ *
+ * @param[in] shm_mod SHM module.
+ * @return 0 if not, non-zero if there are some.
+ */
+static int
+sr_shmmain_mod_has_subs(sr_mod_t *shm_mod)
+{
+    sr_datastore_t ds;
+
+    for (ds = 0; ds < SR_DS_COUNT; ++ds) {
+        if (shm_mod->change_sub[ds].sub_count) {
+            return 1;
+        }
+    }
+
+    return shm_mod->oper_sub_count || shm_mod->notif_sub_count;
+}
+
+int
+sr_shmmain_state_recover_is_due(sr_conn_ctx_t *conn)
+{
+    struct timespec cur_ts, *due_ts;
+
+    due_ts = &((sr_main_shm_t *)conn->main_shm.addr)->conn_state.recover_ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &cur_ts);
+    if ((cur_ts.tv_sec < due_ts->tv_sec) || ((cur_ts.tv_sec == due_ts->tv_sec) && (cur_ts.tv_nsec < due_ts->tv_nsec))) {
+        /* checked recently */
+        return 0;
+    }
+
+    return 1;
+}
+
 sr_error_info_t *
 sr_shmmain_state_recover(sr_conn_ctx_t *conn)
 {
@@ -924,7 +1010,7 @@ sr_shmmain_state_recover(sr_conn_ctx_t *conn)
     sr_mod_t *shm_mod;
     sr_rpc_t *shm_rpc;
     sr_main_shm_t *main_shm;
-    uint32_t i, j, k, *evpipes;
+    uint32_t i, j, k, l, rpc_count, *evpipes;
     sr_conn_state_lock_t (*mod_locks)[3];
     struct sr_mod_lock_s *shm_lock;
     struct timespec timeout_ts;
@@ -933,6 +1019,15 @@ sr_shmmain_state_recover(sr_conn_ctx_t *conn)
     main_shm = (sr_main_shm_t *)conn->main_shm.addr;
     sr_time_get(&timeout_ts, SR_MOD_LOCK_TIMEOUT * 1000);
 
+    /* remember when the next check is due */
+    clock_gettime(CLOCK_MONOTONIC, &main_shm->conn_state.recover_ts);
+    main_shm->conn_state.recover_ts.tv_sec += SR_CONN_RECOVER_INTERVAL / 1000;
+    main_shm->conn_state.recover_ts.tv_nsec += (SR_CONN_RECOVER_INTERVAL % 1000) * 1000000;
+    if (main_shm->conn_state.recover_ts.tv_nsec >= 1000000000) {
+        ++main_shm->conn_state.recover_ts.tv_sec;
+        main_shm->conn_state.recover_ts.tv_nsec -= 1000000000;
+    }
+
     conn_s = (sr_conn_state_t *)(conn->ext_shm.addr + main_shm->conn_state.conns);
     i = 0;
     while (i < main_shm->conn_state.conn_count) {
@@ -952,14 +1047,17 @@ sr_shmmain_state_recover(sr_conn_ctx_t *conn)
                 break;
             }
 
+            /* remove the process from main SHM waiting writers */
+            sr_rwlock_writer_recover(&main_shm->lock);
+
             /* recover held module locks */
             mod_locks = (sr_conn_state_lock_t (*)[3])(conn->ext_shm.addr + conn_s[i].mod_locks);
             shm_mod = SR_FIRST_SHM_MOD(conn->main_shm.addr);
             for (j = 0; j < main_shm->mod_count; ++j) {
                 for (k = 0; k < 3; ++k) {
-                    if ((mod_locks[j][k].mode == SR_LOCK_READ) || (mod_locks[j][k].mode == SR_LOCK_WRITE)) {
-                        shm_lock = &shm_mod[j].data_lock_info[k];
-
+                    shm_lock = &shm_mod[j].data_lock_info[k];
+                    if ((mod_locks[j][k].mode == SR_LOCK_READ) || (mod_locks[j][k].mode == SR_LOCK_WRITE)
+                            || shm_lock->subtree_count || shm_lock->lock.writers) {
                         /* SHM MOD MUTEX LOCK */
                         ret = pthread_mutex_timedlock(&shm_lock->lock.mutex, &timeout_ts);
                         if (ret) {
@@ -975,6 +1073,23 @@ sr_shmmain_state_recover(sr_conn_ctx_t *conn)
                                 shm_lock->write_locked = 0;
                             }
 
+                            /* unlock all subtree locks of the process */
+                            l = 0;
+                            while (l < shm_lock->subtree_count) {
+                                if (shm_lock->subtrees[l].pid == conn_s[i].pid) {
+                                    --shm_lock->subtree_count;
+                                    shm_lock->subtrees[l] = shm_lock->subtrees[shm_lock->subtree_count];
+                                } else {
+                                    ++l;
+                                }
+                            }
+
+                            /* remove the process from waiting writers */
+                            sr_rwlock_writer_recover(&shm_lock->lock);
+
+                            /* wake up anyone waiting for the locks */
+                            pthread_cond_broadcast(&shm_lock->lock.cond);
+
                             /* SHM MOD MUTEX UNLOCK */
                             pthread_mutex_unlock(&shm_lock->lock.mutex);
                         }
@@ -982,10 +1097,14 @@ sr_shmmain_state_recover(sr_conn_ctx_t *conn)
                 }
             }
 
-            /* go through all the modules and their subscriptions and delete any matching (stale) ones */
+            /* go through all the modules with some subscriptions and delete any matching (stale) ones */
             evpipes = (uint32_t *)(conn->ext_shm.addr + conn_s[i].evpipes);
-            for (j = 0; j < conn_s[i].evpipe_count; ++j) {
-                SR_SHM_MOD_FOR(conn->main_shm.addr, conn->main_shm.size, shm_mod) {
+            SR_SHM_MOD_FOR(conn->main_shm.addr, conn->main_shm.size, shm_mod) {
+                if (!conn_s[i].evpipe_count || !sr_shmmain_mod_has_subs(shm_mod)) {
+                    continue;
+                }
+
+                for (j = 0; j < conn_s[i].evpipe_count; ++j) {
                     for (k = 0; k < SR_DS_COUNT; ++k) {
                         if ((tmp_err = sr_shmmod_change_subscription_stop(conn, shm_mod, NULL, k, 0, 0, evpipes[j], 1))) {
                             sr_errinfo_merge(&err_info, tmp_err);
@@ -998,13 +1117,23 @@ sr_shmmain_state_recover(sr_conn_ctx_t *conn)
                         sr_errinfo_merge(&err_info, tmp_err);
                     }
                 }
+            }
 
+            /* the same for RPCs, an RPC is removed with its last subscription */
+            k = 0;
+            while (conn_s[i].evpipe_count && (k < main_shm->rpc_sub_count)) {
+                rpc_count = main_shm->rpc_sub_count;
                 shm_rpc = (sr_rpc_t *)(conn->ext_shm.addr + main_shm->rpc_subs);
-                for (k = 0; k < main_shm->rpc_sub_count; ++k) {
+                for (j = 0; (j < conn_s[i].evpipe_count) && (rpc_count == main_shm->rpc_sub_count); ++j) {
                     if ((tmp_err = sr_shmmain_rpc_subscription_stop(conn, &shm_rpc[k], NULL, 0, evpipes[j], 1))) {
                         sr_errinfo_merge(&err_info, tmp_err);
                     }
                 }
+
+                if (rpc_count == main_shm->rpc_sub_count) {
+                    /* RPC was not removed, next one */
+                    ++k;
+                }
             }
 
             /* remove this connection from state */
@@ -1087,10 +1216,10 @@ sr_shmmain_ext_get_size_main_shm(sr_shm_t *shm_main, char *ext_shm_addr)
             assert(oper_subs[i].xpath);
             shm_size += sr_strshmlen(ext_shm_addr + oper_subs[i].xpath);
         }
-        shm_size += shm_mod->oper_subs * sizeof *oper_subs;
+        shm_size += shm_mod->oper_sub_count * sizeof *oper_subs;
 
         /* notif subscriptions */
-        shm_size += shm_mod->notif_subs * sizeof(sr_mod_notif_sub_t);
+        shm_size += shm_mod->notif_sub_count * sizeof(sr_mod_notif_sub_t);
     }
 
     return shm_size;
@@ -1112,7 +1241,7 @@ sr_shmmain_ext_get_lydmods_size(struct lyd_node *sr_mods)
 
     LY_TREE_FOR(sr_mods->child, sr_mod) {
         LY_TREE_FOR(sr_mod->child, sr_child) {
-            if (!strcmp(sr_child->schema->name, "name")) {
+            if (!strcmp(sr_child->schema->name, "name") || !strcmp(sr_child->schema->name, "subtree-lock")) {
                 /* a string */
                 shm_size += sr_strshmlen(((struct lyd_node_leaf_list *)sr_child)->value_str);
             } else if (!strcmp(sr_child->schema->name, "enabled-feature")) {
@@ -1151,7 +1280,7 @@ sr_shmmain_ext_get_lydmods_size(struct lyd_node *sr_mods)
                             /* another data dependency */
                             shm_size += sizeof(sr_mod_data_dep_t);
 
-                            if (!strcmp(sr_dep->schema->name, "inst-id")) {
+                            if (!strcmp(sr_dep->schema->name, "inst-id") || !strcmp(sr_dep->schema->name, "ref-path")) {
                                 LY_TREE_FOR(sr_dep->child, sr_instid) {
                                     if (!strcmp(sr_instid->schema->name, "xpath")) {
                                         /* a string */
@@ -1272,6 +1401,25 @@ sr_shmmain_fill_data_deps(sr_shm_t *shm_main, char *ext_shm_addr, struct lyd_nod
 
             /* no xpath */
             shm_deps[*dep_i].xpath = 0;
+        } else if (!strcmp(sr_dep->schema->name, "ref-path")) {
+            dep_found = 1;
+
+            /* set dep type */
+            shm_deps[*dep_i].type = SR_DEP_REF;
+
+            LY_TREE_FOR(sr_dep->child, sr_instid) {
+                if (!strcmp(sr_instid->schema->name, "xpath")) {
+                    /* copy xpath of the referenced subtree */
+                    str = sr_ly_leaf_value_str(sr_instid);
+                    shm_deps[*dep_i].xpath = sr_shmstrcpy(ext_shm_addr, str, ext_cur);
+                } else if (!strcmp(sr_instid->schema->name, "module")) {
+                    /* copy module name offset */
+                    str = sr_ly_leaf_value_str(sr_instid);
+                    ref_shm_mod = sr_shmmain_find_module(shm_main, ext_shm_addr, str, 0);
+                    SR_CHECK_INT_RET(!ref_shm_mod, err_info);
+                    shm_deps[*dep_i].module = ref_shm_mod->name;
+                }
+            }
         } else if (!strcmp(sr_dep->schema->name, "inst-id")) {
             dep_found = 1;
 
@@ -1353,6 +1501,10 @@ sr_shmmain_add_modules(char *ext_shm_addr, struct lyd_node *first_sr_mod, sr_mod
             } else if (!strcmp(sr_child->schema->name, "replay-support")) {
                 /* set replay-support flag */
                 first_shm_mod->flags |= SR_MOD_REPLAY_SUPPORT;
+            } else if (!strcmp(sr_child->schema->name, "subtree-lock")) {
+                /* copy subtree lock list name */
+                str = sr_ly_leaf_value_str(sr_child);
+                first_shm_mod->subtree_lock = sr_shmstrcpy(ext_shm_addr, str, &ext_cur);
             } else if (!strcmp(sr_child->schema->name, "enabled-feature")) {
                 /* just count features */
                 ++first_shm_mod->feat_count;
@@ -1917,14 +2069,23 @@ sr_shmmain_rpc_subscription_add(sr_shm_t *shm_ext, off_t shm_rpc_off, const char
     off_t xpath_off, subs_off;
     sr_rpc_sub_t *shm_sub;
     size_t new_ext_size;
+    uint16_t new_cap;
 
     assert(xpath);
 
     shm_rpc = (sr_rpc_t *)(shm_ext->addr + shm_rpc_off);
 
-    /* moving all existing subscriptions (if any) and adding a new one */
-    subs_off = shm_ext->size;
-    xpath_off = subs_off + (shm_rpc->sub_count + 1) * sizeof *shm_sub;
+    if (shm_rpc->sub_count < shm_rpc->sub_cap) {
+        /* there is room for the new subscription, only its xpath is appended */
+        subs_off = shm_rpc->subs;
+        new_cap = shm_rpc->sub_cap;
+        xpath_off = shm_ext->size;
+    } else {
+        /* moving all existing subscriptions (if any) into a bigger array and adding a new one */
+        subs_off = shm_ext->size;
+        new_cap = SR_SHM_SUB_CAP_NEXT(shm_rpc->sub_cap);
+        xpath_off = subs_off + new_cap * sizeof *shm_sub;
+    }
     new_ext_size = xpath_off + sr_strshmlen(xpath);
 
     /* remap ext SHM */
@@ -1933,12 +2094,18 @@ sr_shmmain_rpc_subscription_add(sr_shm_t *shm_ext, off_t shm_rpc_off, const char
     }
     shm_rpc = (sr_rpc_t *)(shm_ext->addr + shm_rpc_off);
 
-    /* add wasted memory */
-    *((size_t *)shm_ext->addr) += shm_rpc->sub_count * sizeof *shm_sub;
+    if (subs_off != shm_rpc->subs) {
+        /* add wasted memory, the old array and the unused part of the new one */
+        *((size_t *)shm_ext->addr) += (shm_rpc->sub_cap + new_cap - shm_rpc->sub_count) * sizeof *shm_sub;
+
+        /* move subscriptions */
+        memcpy(shm_ext->addr + subs_off, shm_ext->addr + shm_rpc->subs, shm_rpc->sub_count * sizeof *shm_sub);
+        shm_rpc->subs = subs_off;
+        shm_rpc->sub_cap = new_cap;
+    }
 
-    /* move subscriptions */
-    memcpy(shm_ext->addr + subs_off, shm_ext->addr + shm_rpc->subs, shm_rpc->sub_count * sizeof *shm_sub);
-    shm_rpc->subs = subs_off;
+    /* the new subscription uses one item of the unused (wasted) memory */
+    *((size_t *)shm_ext->addr) -= sizeof *shm_sub;
 
     /* fill new subscription */
     shm_sub = (sr_rpc_sub_t *)(shm_ext->addr + shm_rpc->subs);
@@ -1984,10 +2151,10 @@ sr_shmmain_rpc_subscription_del(char *ext_shm_addr, sr_rpc_t *shm_rpc, const cha
     /* add wasted memory */
     *((size_t *)ext_shm_addr) += sizeof *shm_sub + sr_strshmlen(ext_shm_addr + shm_sub[i].xpath);
 
+    /* the array itself is kept with its capacity for future subscriptions until defragmentation */
     --shm_rpc->sub_count;
     if (!shm_rpc->sub_count) {
         /* the only subscription removed */
-        shm_rpc->subs = 0;
         if (last_removed) {
             *last_removed = 1;
         }
@@ -2007,6 +2174,7 @@ sr_shmmain_rpc_subscription_stop(sr_conn_ctx_t *conn, sr_rpc_t *shm_rpc, const c
     const char *op_path;
     char *mod_name, *path;
     int last_removed;
+    uint32_t slot;
 
     op_path = conn->ext_shm.addr + shm_rpc->op_path;
 
@@ -2024,16 +2192,20 @@ sr_shmmain_rpc_subscription_stop(sr_conn_ctx_t *conn, sr_rpc_t *shm_rpc, const c
             /* get module name */
             mod_name = sr_get_first_ns(op_path);
 
-            /* delete the SHM file itself so that there is no leftover event */
-            err_info = sr_path_sub_shm(mod_name, "rpc", sr_str_hash(op_path), 0, &path);
+            /* delete the SHM files of all the request slots so that there is no leftover event */
+            for (slot = 0; slot < SR_RPC_SLOT_COUNT; ++slot) {
+                if ((err_info = sr_path_sub_shm(mod_name, sr_rpc_slot_suffix(slot), sr_str_hash(op_path), 0, &path))) {
+                    break;
+                }
+                if (shm_unlink(path) == -1) {
+                    SR_LOG_WRN("Failed to unlink SHM \"%s\" (%s).", path, strerror(errno));
+                }
+                free(path);
+            }
             free(mod_name);
             if (err_info) {
                 break;
             }
-            if (shm_unlink(path) == -1) {
-                SR_LOG_WRN("Failed to unlink SHM \"%s\" (%s).", path, strerror(errno));
-            }
-            free(path);
 
             /* delete also RPC */
             if ((err_info = sr_shmmain_del_rpc((sr_main_shm_t *)conn->main_shm.addr, conn->ext_shm.addr, NULL,
@@ -2093,6 +2265,7 @@ sr_shmmain_add_rpc(sr_conn_ctx_t *conn, const char *op_path, sr_rpc_t **shm_rpc_
     shm_rpc->op_path = op_path_off;
     shm_rpc->subs = 0;
     shm_rpc->sub_count = 0;
+    shm_rpc->sub_cap = 0;
 
     ++main_shm->rpc_sub_count;
 
@@ -2153,6 +2326,40 @@ sr_shmmain_update_replay_support(sr_shm_t *shm_main, char *ext_shm_addr, const c
     return NULL;
 }
 
+sr_error_info_t *
+sr_shmmain_update_subtree_lock(sr_conn_ctx_t *conn, const char *mod_name, const char *list_name)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_mod_t *shm_mod;
+    off_t list_name_off;
+
+    shm_mod = sr_shmmain_find_module(&conn->main_shm, conn->ext_shm.addr, mod_name, 0);
+    SR_CHECK_INT_RET(!shm_mod, err_info);
+
+    if (shm_mod->subtree_lock) {
+        if (list_name && !strcmp(conn->ext_shm.addr + shm_mod->subtree_lock, list_name)) {
+            /* nothing to change */
+            return NULL;
+        }
+
+        /* add wasted memory, the previous list name */
+        *((size_t *)conn->ext_shm.addr) += sr_strshmlen(conn->ext_shm.addr + shm_mod->subtree_lock);
+        shm_mod->subtree_lock = 0;
+    }
+
+    if (list_name) {
+        /* remap ext SHM and append the new list name */
+        list_name_off = conn->ext_shm.size;
+        if ((err_info = sr_shm_remap(&conn->ext_shm, list_name_off + sr_strshmlen(list_name)))) {
+            return err_info;
+        }
+        strcpy(conn->ext_shm.addr + list_name_off, list_name);
+        shm_mod->subtree_lock = list_name_off;
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_shmmain_check_data_files(sr_conn_ctx_t *conn)
 {
@@ -47,7 +47,7 @@ sr_shmmod_lock(const char *mod_name, struct sr_mod_lock_s *shm_lock, int timeout
 {
     sr_error_info_t *err_info = NULL;
     struct timespec timeout_ts;
-    int ret;
+    int ret, used, pref;
 
     assert(timeout_ms > 0);
     assert((mode == SR_LOCK_READ) || (mode == SR_LOCK_WRITE));
@@ -55,7 +55,7 @@ sr_shmmod_lock(const char *mod_name, struct sr_mod_lock_s *shm_lock, int timeout
     sr_time_get(&timeout_ts, timeout_ms);
 
     /* MUTEX LOCK */
-    ret = pthread_mutex_timedlock(&shm_lock->lock.mutex, &timeout_ts);
+    ret = sr_rwlock_mutex_lock(&shm_lock->lock, &timeout_ts);
     if (ret) {
         SR_ERRINFO_LOCK(&err_info, __func__, ret);
         return err_info;
@@ -64,12 +64,34 @@ sr_shmmod_lock(const char *mod_name, struct sr_mod_lock_s *shm_lock, int timeout
     if (mode == SR_LOCK_WRITE) {
         /* write lock */
         ret = 0;
-        while (!ret && (shm_lock->lock.readers || ((shm_lock->write_locked || shm_lock->ds_locked) && (shm_lock->sid.sr != sid.sr)))) {
+        pref = 0;
+        while (!ret) {
+            used = shm_lock->subtree_count || ((shm_lock->write_locked || shm_lock->ds_locked) && (shm_lock->sid.sr != sid.sr));
+            if (!used && !shm_lock->lock.readers) {
+                break;
+            }
+
+            /* new readers will wait for us only if we are waiting just for the readers */
+            if (!used && !pref) {
+                pref = sr_rwlock_writer_add(&shm_lock->lock);
+            } else if (used && pref) {
+                sr_rwlock_writer_del(&shm_lock->lock);
+                pref = 0;
+            }
+
             /* COND WAIT */
             ret = pthread_cond_timedwait(&shm_lock->lock.cond, &shm_lock->lock.mutex, &timeout_ts);
         }
+        if (pref) {
+            sr_rwlock_writer_del(&shm_lock->lock);
+        }
 
         if (ret) {
+            if (pref && !shm_lock->lock.writers) {
+                /* let the readers waiting for us continue */
+                pthread_cond_broadcast(&shm_lock->lock.cond);
+            }
+
             /* MUTEX UNLOCK */
             pthread_mutex_unlock(&shm_lock->lock.mutex);
 
@@ -77,6 +99,9 @@ sr_shmmod_lock(const char *mod_name, struct sr_mod_lock_s *shm_lock, int timeout
                 /* timeout */
                 sr_errinfo_new(&err_info, SR_ERR_LOCKED, NULL, "Module \"%s\" is %s by session %u (NC SID %u).",
                         mod_name, shm_lock->ds_locked ? "locked" : "being used", shm_lock->sid.sr, shm_lock->sid.nc);
+            } else if ((ret == ETIMEDOUT) && shm_lock->subtree_count) {
+                /* timeout */
+                sr_errinfo_new(&err_info, SR_ERR_LOCKED, NULL, "Module \"%s\" subtrees are being used.", mod_name);
             } else {
                 /* other error */
                 SR_ERRINFO_COND(&err_info, __func__, ret);
@@ -84,7 +109,8 @@ sr_shmmod_lock(const char *mod_name, struct sr_mod_lock_s *shm_lock, int timeout
             return err_info;
         }
     } else {
-        /* read lock */
+        /* read lock, after waiting writers */
+        sr_rwlock_rdwait(&shm_lock->lock);
         ++shm_lock->lock.readers;
 
         /* MUTEX UNLOCK */
@@ -94,6 +120,142 @@ sr_shmmod_lock(const char *mod_name, struct sr_mod_lock_s *shm_lock, int timeout
     return NULL;
 }
 
+/**
+ * @brief WRITE lock subtrees of a main SHM module and READ lock the module itself.
+ *
+ * @param[in] mod Mod info module with the subtrees to lock.
+ * @param[in] shm_lock Main SHM module lock.
+ * @param[in] timeout_ms Timeout in ms.
+ * @param[in] sid Sysrepo session ID.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmmod_subtree_lock(struct sr_mod_info_mod_s *mod, struct sr_mod_lock_s *shm_lock, int timeout_ms, sr_sid_t sid)
+{
+    sr_error_info_t *err_info = NULL;
+    struct timespec timeout_ts;
+    uint16_t i, j;
+    int ret, conflict;
+
+    assert(timeout_ms > 0);
+    assert(mod->subtree_hash_count && (mod->subtree_hash_count <= SR_MOD_SUBTREE_LOCK_COUNT));
+
+    sr_time_get(&timeout_ts, timeout_ms);
+
+    /* MUTEX LOCK */
+    ret = sr_rwlock_mutex_lock(&shm_lock->lock, &timeout_ts);
+    if (ret) {
+        SR_ERRINFO_LOCK(&err_info, __func__, ret);
+        return err_info;
+    }
+
+    /* the module is READ-locked as well, after waiting writers */
+    sr_rwlock_rdwait(&shm_lock->lock);
+
+    ret = 0;
+    while (1) {
+        /* the whole module must not be used, there must be room for the subtrees, and they must not be locked */
+        conflict = ((shm_lock->write_locked || shm_lock->ds_locked) && (shm_lock->sid.sr != sid.sr))
+                || (shm_lock->subtree_count + mod->subtree_hash_count > SR_MOD_SUBTREE_LOCK_COUNT);
+        for (i = 0; !conflict && (i < shm_lock->subtree_count); ++i) {
+            for (j = 0; j < mod->subtree_hash_count; ++j) {
+                if (shm_lock->subtrees[i].hash == mod->subtree_hashes[j]) {
+                    conflict = 1;
+                    break;
+                }
+            }
+        }
+        if (!conflict || ret) {
+            break;
+        }
+
+        /* COND WAIT */
+        ret = pthread_cond_timedwait(&shm_lock->lock.cond, &shm_lock->lock.mutex, &timeout_ts);
+    }
+
+    if (conflict) {
+        /* MUTEX UNLOCK */
+        pthread_mutex_unlock(&shm_lock->lock.mutex);
+
+        if ((ret == ETIMEDOUT) && (shm_lock->write_locked || shm_lock->ds_locked)) {
+            /* timeout */
+            sr_errinfo_new(&err_info, SR_ERR_LOCKED, NULL, "Module \"%s\" is %s by session %u (NC SID %u).",
+                    mod->ly_mod->name, shm_lock->ds_locked ? "locked" : "being used", shm_lock->sid.sr, shm_lock->sid.nc);
+        } else if (ret == ETIMEDOUT) {
+            /* timeout */
+            sr_errinfo_new(&err_info, SR_ERR_LOCKED, NULL, "Module \"%s\" subtrees are being used.", mod->ly_mod->name);
+        } else {
+            /* other error */
+            SR_ERRINFO_COND(&err_info, __func__, ret);
+        }
+        return err_info;
+    }
+
+    /* write lock the subtrees */
+    for (j = 0; j < mod->subtree_hash_count; ++j) {
+        shm_lock->subtrees[shm_lock->subtree_count].hash = mod->subtree_hashes[j];
+        shm_lock->subtrees[shm_lock->subtree_count].pid = getpid();
+        ++shm_lock->subtree_count;
+    }
+
+    /* read lock the module */
+    ++shm_lock->lock.readers;
+
+    /* MUTEX UNLOCK */
+    pthread_mutex_unlock(&shm_lock->lock.mutex);
+
+    return NULL;
+}
+
+/**
+ * @brief Unlock WRITE-locked subtrees of a main SHM module.
+ *
+ * @param[in] mod Mod info module with the locked subtrees.
+ * @param[in] shm_lock Main SHM module lock.
+ */
+static void
+sr_shmmod_subtree_unlock(struct sr_mod_info_mod_s *mod, struct sr_mod_lock_s *shm_lock)
+{
+    sr_error_info_t *err_info = NULL;
+    struct timespec timeout_ts;
+    uint16_t i, j;
+    pid_t pid;
+    int ret;
+
+    sr_time_get(&timeout_ts, SR_RWLOCK_READ_TIMEOUT);
+    pid = getpid();
+
+    /* MUTEX LOCK */
+    ret = sr_rwlock_mutex_lock(&shm_lock->lock, &timeout_ts);
+    if (ret) {
+        SR_ERRINFO_LOCK(&err_info, __func__, ret);
+        sr_errinfo_free(&err_info);
+    }
+
+    for (j = 0; j < mod->subtree_hash_count; ++j) {
+        for (i = 0; i < shm_lock->subtree_count; ++i) {
+            if ((shm_lock->subtrees[i].hash == mod->subtree_hashes[j]) && (shm_lock->subtrees[i].pid == pid)) {
+                break;
+            }
+        }
+        if (i == shm_lock->subtree_count) {
+            SR_ERRINFO_INT(&err_info);
+            sr_errinfo_free(&err_info);
+            continue;
+        }
+
+        /* unlock the subtree */
+        --shm_lock->subtree_count;
+        shm_lock->subtrees[i] = shm_lock->subtrees[shm_lock->subtree_count];
+    }
+
+    /* broadcast on condition */
+    pthread_cond_broadcast(&shm_lock->lock.cond);
+
+    /* MUTEX UNLOCK */
+    pthread_mutex_unlock(&shm_lock->lock.mutex);
+}
+
 /**
  * @brief Comparator function for qsort of mod info modules.
  *
@@ -425,15 +587,30 @@ sr_shmmod_modinfo_rdlock(struct sr_mod_info_s *mod_info, int upgradable, sr_sid_
         mod = &mod_info->mods[i];
         shm_lock = &mod->shm_mod->data_lock_info[ds];
 
-        /* WRITE-lock data-required modules, READ-lock dependency modules */
+        if (ds == SR_DS_CANDIDATE) {
+            /* candidate data are based on running data, always lock running first */
+            if ((err_info = sr_shmmod_lock(mod->ly_mod->name, &mod->shm_mod->data_lock_info[SR_DS_RUNNING],
+                    SR_MOD_LOCK_TIMEOUT * 1000, SR_LOCK_READ, sid))) {
+                /* MOD RUNNING READ LOCK failed */
+                return err_info;
+            }
+            sr_shmmod_conn_state_lock_update(mod_info->conn, mod->shm_mod, SR_DS_RUNNING, SR_LOCK_READ, 1);
+            mod->state |= MOD_INFO_RUN_RLOCK;
+        }
+
+        /* WRITE-lock data-required modules (or only their subtrees), READ-lock dependency modules */
         mod_lock = upgradable && (mod->state & MOD_INFO_REQ) ? SR_LOCK_WRITE : SR_LOCK_READ;
 
-        /* MOD READ/WRITE LOCK */
-        if ((err_info = sr_shmmod_lock(mod->ly_mod->name, shm_lock, SR_MOD_LOCK_TIMEOUT * 1000, mod_lock, sid))) {
+        if ((mod_lock == SR_LOCK_WRITE) && mod->subtree_hash_count) {
+            /* MOD SUBTREES WRITE LOCK, MOD READ LOCK */
+            if ((err_info = sr_shmmod_subtree_lock(mod, shm_lock, SR_MOD_LOCK_TIMEOUT * 1000, sid))) {
+                return err_info;
+            }
+            mod->state |= MOD_INFO_SUBTREE;
+        } else if ((err_info = sr_shmmod_lock(mod->ly_mod->name, shm_lock, SR_MOD_LOCK_TIMEOUT * 1000, mod_lock, sid))) {
+            /* MOD READ/WRITE LOCK failed */
             return err_info;
-        }
-
-        if (mod_lock == SR_LOCK_WRITE) {
+        } else if (mod_lock == SR_LOCK_WRITE) {
             /* set flag, store SID, and downgrade lock to the required read lock for now */
             assert(!shm_lock->write_locked);
             shm_lock->write_locked = 1;
@@ -461,6 +638,28 @@ sr_shmmod_modinfo_rdlock(struct sr_mod_info_s *mod_info, int upgradable, sr_sid_
     return NULL;
 }
 
+void
+sr_shmmod_modinfo_subtree_rdunlock(struct sr_mod_info_s *mod_info)
+{
+    uint32_t i;
+    struct sr_mod_info_mod_s *mod;
+
+    assert(SR_IS_CONVENTIONAL_DS(mod_info->ds));
+
+    for (i = 0; i < mod_info->mod_count; ++i) {
+        mod = &mod_info->mods[i];
+
+        if ((mod->state & MOD_INFO_SUBTREE) && (mod->state & MOD_INFO_RLOCK)) {
+            /* MOD READ UNLOCK */
+            sr_rwunlock(&mod->shm_mod->data_lock_info[mod_info->ds].lock, SR_LOCK_READ, __func__);
+            mod->state &= ~MOD_INFO_RLOCK;
+
+            /* update this lock in SHM */
+            sr_shmmod_conn_state_lock_update(mod_info->conn, mod->shm_mod, mod_info->ds, SR_LOCK_READ, 0);
+        }
+    }
+}
+
 sr_error_info_t *
 sr_shmmod_modinfo_rdlock_upgrade(struct sr_mod_info_s *mod_info, sr_sid_t sid)
 {
@@ -486,8 +685,21 @@ sr_shmmod_modinfo_rdlock_upgrade(struct sr_mod_info_s *mod_info, sr_sid_t sid)
         mod = &mod_info->mods[i];
         shm_lock = &mod->shm_mod->data_lock_info[ds];
 
-        /* upgrade only required modules */
-        if ((mod->state & MOD_INFO_REQ) && (mod->state & MOD_INFO_RLOCK)) {
+        if (mod->state & MOD_INFO_SUBTREE) {
+            if (mod->state & MOD_INFO_RLOCK) {
+                /* MOD READ UNLOCK */
+                sr_rwunlock(&shm_lock->lock, SR_LOCK_READ, __func__);
+                mod->state &= ~MOD_INFO_RLOCK;
+                sr_shmmod_conn_state_lock_update(mod_info->conn, mod->shm_mod, ds, SR_LOCK_READ, 0);
+            }
+
+            /* MOD WRITE LOCK (the whole module cannot be used by anyone else while its subtrees are locked) */
+            if ((err_info = sr_rwlock(&shm_lock->lock, SR_MOD_LOCK_TIMEOUT * 1000, SR_LOCK_WRITE, __func__))) {
+                return err_info;
+            }
+            mod->state |= MOD_INFO_WLOCK;
+        } else if ((mod->state & MOD_INFO_REQ) && (mod->state & MOD_INFO_RLOCK)) {
+            /* upgrade only required modules */
             assert(shm_lock->write_locked);
             assert(!memcmp(&shm_lock->sid, &sid, sizeof sid));
 
@@ -536,7 +748,8 @@ sr_shmmod_modinfo_unlock(struct sr_mod_info_s *mod_info, int upgradable)
         mod = &mod_info->mods[i];
         shm_lock = &mod->shm_mod->data_lock_info[ds];
 
-        if ((mod->state & MOD_INFO_REQ) && (mod->state & (MOD_INFO_RLOCK | MOD_INFO_WLOCK)) && upgradable) {
+        if ((mod->state & MOD_INFO_REQ) && (mod->state & (MOD_INFO_RLOCK | MOD_INFO_WLOCK)) && upgradable
+                && !(mod->state & MOD_INFO_SUBTREE)) {
             /* this module's lock was upgraded (WRITE-locked), correctly clean everything */
             assert(shm_lock->write_locked);
             shm_lock->write_locked = 0;
@@ -560,6 +773,19 @@ sr_shmmod_modinfo_unlock(struct sr_mod_info_s *mod_info, int upgradable)
             /* update this lock in SHM (always was READ-locked) */
             sr_shmmod_conn_state_lock_update(mod_info->conn, mod->shm_mod, ds, SR_LOCK_READ, 0);
         }
+
+        if (mod->state & MOD_INFO_SUBTREE) {
+            /* MOD SUBTREES UNLOCK */
+            sr_shmmod_subtree_unlock(mod, shm_lock);
+            mod->state &= ~MOD_INFO_SUBTREE;
+        }
+
+        if (mod->state & MOD_INFO_RUN_RLOCK) {
+            /* MOD RUNNING READ UNLOCK */
+            sr_rwunlock(&mod->shm_mod->data_lock_info[SR_DS_RUNNING].lock, SR_LOCK_READ, __func__);
+            sr_shmmod_conn_state_lock_update(mod_info->conn, mod->shm_mod, SR_DS_RUNNING, SR_LOCK_READ, 0);
+            mod->state &= ~MOD_INFO_RUN_RLOCK;
+        }
     }
 }
 
@@ -606,10 +832,19 @@ sr_shmmod_change_subscription_add(sr_shm_t *shm_ext, sr_mod_t *shm_mod, const ch
     off_t xpath_off, change_subs_off;
     sr_mod_change_sub_t *shm_sub;
     uint32_t new_ext_size;
+    uint16_t new_cap;
 
-    /* moving all existing subscriptions (if any) and adding a new one */
-    change_subs_off = shm_ext->size;
-    xpath_off = change_subs_off + (shm_mod->change_sub[ds].sub_count + 1) * sizeof *shm_sub;
+    if (shm_mod->change_sub[ds].sub_count < shm_mod->change_sub[ds].sub_cap) {
+        /* there is room for the new subscription, only its xpath is appended */
+        change_subs_off = shm_mod->change_sub[ds].subs;
+        new_cap = shm_mod->change_sub[ds].sub_cap;
+        xpath_off = shm_ext->size;
+    } else {
+        /* moving all existing subscriptions (if any) into a bigger array and adding a new one */
+        change_subs_off = shm_ext->size;
+        new_cap = SR_SHM_SUB_CAP_NEXT(shm_mod->change_sub[ds].sub_cap);
+        xpath_off = change_subs_off + new_cap * sizeof *shm_sub;
+    }
     new_ext_size = xpath_off + (xpath ? sr_strshmlen(xpath) : 0);
 
     /* remap ext SHM */
@@ -617,13 +852,20 @@ sr_shmmod_change_subscription_add(sr_shm_t *shm_ext, sr_mod_t *shm_mod, const ch
         return err_info;
     }
 
-    /* add wasted memory */
-    *((size_t *)shm_ext->addr) += shm_mod->change_sub[ds].sub_count * sizeof *shm_sub;
+    if (change_subs_off != shm_mod->change_sub[ds].subs) {
+        /* add wasted memory, the old array and the unused part of the new one */
+        *((size_t *)shm_ext->addr) += (shm_mod->change_sub[ds].sub_cap + new_cap - shm_mod->change_sub[ds].sub_count)
+                * sizeof *shm_sub;
+
+        /* move subscriptions */
+        memcpy(shm_ext->addr + change_subs_off, shm_ext->addr + shm_mod->change_sub[ds].subs,
+                shm_mod->change_sub[ds].sub_count * sizeof *shm_sub);
+        shm_mod->change_sub[ds].subs = change_subs_off;
+        shm_mod->change_sub[ds].sub_cap = new_cap;
+    }
 
-    /* move subscriptions */
-    memcpy(shm_ext->addr + change_subs_off, shm_ext->addr + shm_mod->change_sub[ds].subs,
-            shm_mod->change_sub[ds].sub_count * sizeof *shm_sub);
-    shm_mod->change_sub[ds].subs = change_subs_off;
+    /* the new subscription uses one item of the unused (wasted) memory */
+    *((size_t *)shm_ext->addr) -= sizeof *shm_sub;
 
     /* fill new subscription */
     shm_sub = (sr_mod_change_sub_t *)(shm_ext->addr + shm_mod->change_sub[ds].subs);
@@ -676,10 +918,10 @@ sr_shmmod_change_subscription_del(char *ext_shm_addr, sr_mod_t *shm_mod, const c
     /* add wasted memory */
     *((size_t *)ext_shm_addr) += sizeof *shm_sub + (shm_sub[i].xpath ? sr_strshmlen(ext_shm_addr + shm_sub[i].xpath) : 0);
 
+    /* the array itself is kept with its capacity for future subscriptions until defragmentation */
     --shm_mod->change_sub[ds].sub_count;
     if (!shm_mod->change_sub[ds].sub_count) {
         /* the only subscription removed */
-        shm_mod->change_sub[ds].subs = 0;
         if (last_removed) {
             *last_removed = 1;
         }
@@ -743,7 +985,7 @@ sr_shmmod_oper_subscription_add(sr_shm_t *shm_ext, sr_mod_t *shm_mod, const char
     off_t xpath_off, oper_subs_off;
     sr_mod_oper_sub_t *shm_sub;
     size_t new_ext_size, new_len, cur_len;
-    uint16_t i;
+    uint16_t i, new_cap;
 
     assert(xpath && sub_type);
 
@@ -764,9 +1006,17 @@ sr_shmmod_oper_subscription_add(sr_shm_t *shm_ext, sr_mod_t *shm_mod, const char
         }
     }
 
-    /* get new offsets and SHM size */
-    oper_subs_off = shm_ext->size;
-    xpath_off = oper_subs_off + (shm_mod->oper_sub_count + 1) * sizeof *shm_sub;
+    if (shm_mod->oper_sub_count < shm_mod->oper_sub_cap) {
+        /* there is room for the new subscription, only its xpath is appended */
+        oper_subs_off = shm_mod->oper_subs;
+        new_cap = shm_mod->oper_sub_cap;
+        xpath_off = shm_ext->size;
+    } else {
+        /* moving all existing subscriptions (if any) into a bigger array */
+        oper_subs_off = shm_ext->size;
+        new_cap = SR_SHM_SUB_CAP_NEXT(shm_mod->oper_sub_cap);
+        xpath_off = oper_subs_off + new_cap * sizeof *shm_sub;
+    }
     new_ext_size = xpath_off + (xpath ? sr_strshmlen(xpath) : 0);
 
     /* remap ext SHM */
@@ -774,19 +1024,31 @@ sr_shmmod_oper_subscription_add(sr_shm_t *shm_ext, sr_mod_t *shm_mod, const char
         return err_info;
     }
 
-    /* add wasted memory */
-    *((size_t *)shm_ext->addr) += shm_mod->oper_sub_count * sizeof *shm_sub;
+    if (oper_subs_off == shm_mod->oper_subs) {
+        /* move succeeding subscriptions leaving place for the new one */
+        if (i < shm_mod->oper_sub_count) {
+            memmove(shm_ext->addr + oper_subs_off + (i + 1) * sizeof *shm_sub,
+                    shm_ext->addr + oper_subs_off + i * sizeof *shm_sub, (shm_mod->oper_sub_count - i) * sizeof *shm_sub);
+        }
+    } else {
+        /* add wasted memory, the old array and the unused part of the new one */
+        *((size_t *)shm_ext->addr) += (shm_mod->oper_sub_cap + new_cap - shm_mod->oper_sub_count) * sizeof *shm_sub;
 
-    /* move preceding and succeeding subscriptions leaving place for the new one */
-    if (i) {
-        memcpy(shm_ext->addr + oper_subs_off, shm_ext->addr + shm_mod->oper_subs,
-                i * sizeof *shm_sub);
-    }
-    if (i < shm_mod->oper_sub_count) {
-        memcpy(shm_ext->addr + oper_subs_off + (i + 1) * sizeof *shm_sub,
-                shm_ext->addr + shm_mod->oper_subs + i * sizeof *shm_sub, (shm_mod->oper_sub_count - i) * sizeof *shm_sub);
+        /* move preceding and succeeding subscriptions leaving place for the new one */
+        if (i) {
+            memcpy(shm_ext->addr + oper_subs_off, shm_ext->addr + shm_mod->oper_subs,
+                    i * sizeof *shm_sub);
+        }
+        if (i < shm_mod->oper_sub_count) {
+            memcpy(shm_ext->addr + oper_subs_off + (i + 1) * sizeof *shm_sub,
+                    shm_ext->addr + shm_mod->oper_subs + i * sizeof *shm_sub, (shm_mod->oper_sub_count - i) * sizeof *shm_sub);
+        }
+        shm_mod->oper_subs = oper_subs_off;
+        shm_mod->oper_sub_cap = new_cap;
     }
-    shm_mod->oper_subs = oper_subs_off;
+
+    /* the new subscription uses one item of the unused (wasted) memory */
+    *((size_t *)shm_ext->addr) -= sizeof *shm_sub;
 
     /* fill new subscription */
     shm_sub = (sr_mod_oper_sub_t *)(shm_ext->addr + shm_mod->oper_subs);
@@ -801,6 +1063,7 @@ sr_shmmod_oper_subscription_add(sr_shm_t *shm_ext, sr_mod_t *shm_mod, const char
     shm_sub->evpipe_num = evpipe_num;
 
     ++shm_mod->oper_sub_count;
+    ++shm_mod->oper_sub_gen;
 
     return NULL;
 }
@@ -835,15 +1098,12 @@ sr_shmmod_oper_subscription_del(char *ext_shm_addr, sr_mod_t *shm_mod, const cha
     /* add wasted memory */
     *((size_t *)ext_shm_addr) += sizeof *shm_sub + sr_strshmlen(ext_shm_addr + shm_sub[i].xpath);
 
+    /* the array itself is kept with its capacity for future subscriptions until defragmentation */
     --shm_mod->oper_sub_count;
-    if (!shm_mod->oper_sub_count) {
-        /* the only subscription removed */
-        shm_mod->oper_subs = 0;
-    } else {
+    ++shm_mod->oper_sub_gen;
+    if (i < shm_mod->oper_sub_count) {
         /* move all following subscriptions */
-        if (i < shm_mod->oper_sub_count) {
-            memmove(&shm_sub[i], &shm_sub[i + 1], (shm_mod->oper_sub_count - i) * sizeof *shm_sub);
-        }
+        memmove(&shm_sub[i], &shm_sub[i + 1], (shm_mod->oper_sub_count - i) * sizeof *shm_sub);
     }
 
     return 0;
@@ -888,23 +1148,31 @@ sr_shmmod_notif_subscription_add(sr_shm_t *shm_ext, sr_mod_t *shm_mod, uint32_t
     off_t notif_subs_off;
     sr_mod_notif_sub_t *shm_sub;
     size_t new_ext_size;
+    uint16_t new_cap;
 
-    /* moving all existing subscriptions (if any) and adding a new one */
-    notif_subs_off = shm_ext->size;
-    new_ext_size = notif_subs_off + (shm_mod->notif_sub_count + 1) * sizeof *shm_sub;
+    if (shm_mod->notif_sub_count == shm_mod->notif_sub_cap) {
+        /* no room for the new subscription, moving all existing subscriptions (if any) into a bigger array */
+        notif_subs_off = shm_ext->size;
+        new_cap = SR_SHM_SUB_CAP_NEXT(shm_mod->notif_sub_cap);
+        new_ext_size = notif_subs_off + new_cap * sizeof *shm_sub;
 
-    /* remap ext SHM */
-    if ((err_info = sr_shm_remap(shm_ext, new_ext_size))) {
-        return err_info;
-    }
+        /* remap ext SHM */
+        if ((err_info = sr_shm_remap(shm_ext, new_ext_size))) {
+            return err_info;
+        }
 
-    /* add wasted memory */
-    *((size_t *)shm_ext->addr) += shm_mod->notif_sub_count * sizeof *shm_sub;
+        /* add wasted memory, the old array and the unused part of the new one */
+        *((size_t *)shm_ext->addr) += (shm_mod->notif_sub_cap + new_cap - shm_mod->notif_sub_count) * sizeof *shm_sub;
+
+        /* move subscriptions */
+        memcpy(shm_ext->addr + notif_subs_off, shm_ext->addr + shm_mod->notif_subs,
+                shm_mod->notif_sub_count * sizeof *shm_sub);
+        shm_mod->notif_subs = notif_subs_off;
+        shm_mod->notif_sub_cap = new_cap;
+    }
 
-    /* move subscriptions */
-    memcpy(shm_ext->addr + notif_subs_off, shm_ext->addr + shm_mod->notif_subs,
-            shm_mod->notif_sub_count * sizeof *shm_sub);
-    shm_mod->notif_subs = notif_subs_off;
+    /* the new subscription uses one item of the unused (wasted) memory */
+    *((size_t *)shm_ext->addr) -= sizeof *shm_sub;
 
     /* fill new subscription */
     shm_sub = (sr_mod_notif_sub_t *)(shm_ext->addr + shm_mod->notif_subs);
@@ -941,10 +1209,10 @@ sr_shmmod_notif_subscription_del(char *ext_shm_addr, sr_mod_t *shm_mod, uint32_t
     /* add wasted memory */
     *((size_t *)ext_shm_addr) += sizeof *shm_sub;
 
+    /* the array itself is kept with its capacity for future subscriptions until defragmentation */
     --shm_mod->notif_sub_count;
     if (!shm_mod->notif_sub_count) {
         /* the only subscription removed */
-        shm_mod->notif_subs = 0;
         if (last_removed) {
             *last_removed = 1;
         }
@@ -22,6 +22,7 @@
 #include "common.h"
 
 #include <sys/select.h>
+#include <sys/epoll.h>
 #include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -71,7 +72,7 @@ sr_shmsub_open_map(const char *name, const char *suffix1, int64_t suffix2, sr_sh
 
     if (created) {
         /* truncate and map for initialization */
-        if ((err_info = sr_shm_remap(shm, shm_struct_size))) {
+        if ((err_info = sr_shm_remap_hwm(shm, shm_struct_size))) {
             goto error;
         }
 
@@ -146,16 +147,17 @@ sr_shmsub_notify_new_wrlock(sr_sub_shm_t *sub_shm, const char *shm_name, sr_sub_
 }
 
 /**
- * @brief Having WRITE lock, wait for subscribers to handle a generated event.
+ * @brief Having WRITE lock, wait for subscribers to handle a generated event and keep the lock.
+ * On success, the event is left set to ::SR_SUB_EV_SUCCESS.
  *
- * @param[in] sub_shm Subscription SHM to unlock.
+ * @param[in] sub_shm Subscription SHM.
  * @param[in] shm_struct_size Size of the shared subscription structure.
  * @param[in] timeout_ms Timeout in milliseconds.
  * @param[out] cb_err_info Callback error information generated by a subscriber, if any.
  * @return err_info, NULL on success.
  */
 static sr_error_info_t *
-sr_shmsub_notify_finish_wrunlock(sr_sub_shm_t *sub_shm, size_t shm_struct_size, uint32_t timeout_ms,
+sr_shmsub_notify_finish_wait(sr_sub_shm_t *sub_shm, size_t shm_struct_size, uint32_t timeout_ms,
         sr_error_info_t **cb_err_info)
 {
     sr_error_info_t *err_info = NULL;
@@ -195,7 +197,28 @@ sr_shmsub_notify_finish_wrunlock(sr_sub_shm_t *sub_shm, size_t shm_struct_size,
         err_xpath = ptr;
 
         sr_errinfo_new(cb_err_info, err_code, err_xpath[0] ? err_xpath : NULL, err_msg[0] ? err_msg : sr_strerror(err_code));
-    } else if (sub_shm->event == SR_SUB_EV_SUCCESS) {
+    }
+
+    return err_info;
+}
+
+/**
+ * @brief Having WRITE lock, wait for subscribers to handle a generated event.
+ *
+ * @param[in] sub_shm Subscription SHM to unlock.
+ * @param[in] shm_struct_size Size of the shared subscription structure.
+ * @param[in] timeout_ms Timeout in milliseconds.
+ * @param[out] cb_err_info Callback error information generated by a subscriber, if any.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmsub_notify_finish_wrunlock(sr_sub_shm_t *sub_shm, size_t shm_struct_size, uint32_t timeout_ms,
+        sr_error_info_t **cb_err_info)
+{
+    sr_error_info_t *err_info;
+
+    err_info = sr_shmsub_notify_finish_wait(sub_shm, shm_struct_size, timeout_ms, cb_err_info);
+    if (sub_shm->event == SR_SUB_EV_SUCCESS) {
         /* we were notified about the success and can clear it now */
         sub_shm->event = SR_SUB_EV_NONE;
     }
@@ -330,24 +353,21 @@ sr_shmsub_change_is_valid(sr_sub_event_t ev, sr_subscr_options_t sub_opts)
 /**
  * @brief Learn whether there is a subscription for a change event.
  *
- * @param[in] ext_shm_addr Main SHM mapping address.
- * @param[in] mod Mod info module to use.
- * @param[in] ds Datastore.
+ * @param[in] shm_msub Change subscriptions of a module, in ext SHM or a snapshot.
+ * @param[in] sub_count Change subscription count.
  * @param[in] ev Event.
  * @param[out] max_priority_p Highest priority among the valid subscribers.
  * @return 0 if not, non-zero if there is.
  */
 static int
-sr_shmsub_change_notify_has_subscription(char *ext_shm_addr, struct sr_mod_info_mod_s *mod, sr_datastore_t ds,
-        sr_sub_event_t ev, uint32_t *max_priority_p)
+sr_shmsub_change_notify_has_subscription(sr_mod_change_sub_t *shm_msub, uint32_t sub_count, sr_sub_event_t ev,
+        uint32_t *max_priority_p)
 {
     int has_sub = 0;
     uint32_t i;
-    sr_mod_change_sub_t *shm_msub;
 
-    shm_msub = (sr_mod_change_sub_t *)(ext_shm_addr + mod->shm_mod->change_sub[ds].subs);
     *max_priority_p = 0;
-    for (i = 0; i < mod->shm_mod->change_sub[ds].sub_count; ++i) {
+    for (i = 0; i < sub_count; ++i) {
         if (!sr_shmsub_change_is_valid(ev, shm_msub[i].opts)) {
             continue;
         }
@@ -362,12 +382,25 @@ sr_shmsub_change_notify_has_subscription(char *ext_shm_addr, struct sr_mod_info_
     return has_sub;
 }
 
+int
+sr_shmsub_change_has_subscription(sr_conn_ctx_t *conn, sr_mod_t *shm_mod, sr_datastore_t ds)
+{
+    sr_mod_change_sub_t *shm_msub;
+    uint32_t max_priority, sub_count;
+
+    shm_msub = (sr_mod_change_sub_t *)(conn->ext_shm.addr + shm_mod->change_sub[ds].subs);
+    sub_count = shm_mod->change_sub[ds].sub_count;
+
+    /* "abort" and "done" subscribers of DONE_ONLY subscriptions are covered by these */
+    return sr_shmsub_change_notify_has_subscription(shm_msub, sub_count, SR_SUB_EV_CHANGE, &max_priority)
+            || sr_shmsub_change_notify_has_subscription(shm_msub, sub_count, SR_SUB_EV_DONE, &max_priority);
+}
+
 /**
  * @brief Learn the priority of the next valid subscriber for a change event.
  *
- * @param[in] ext_shm_addr Main SHM mapping address.
- * @param[in] mod Mod info module to use.
- * @param[in] ds Datastore.
+ * @param[in] shm_msub Change subscriptions of a module, in ext SHM or a snapshot.
+ * @param[in] sub_count Change subscription count.
  * @param[in] ev Change event.
  * @param[in] last_priority Last priorty of a subscriber.
  * @param[out] next_priorty_p Next priorty of a subsciber(s).
@@ -375,16 +408,14 @@ sr_shmsub_change_notify_has_subscription(char *ext_shm_addr, struct sr_mod_info_
  * @param[out] opts_p Optional options of all subscribers with this priority.
  */
 static void
-sr_shmsub_change_notify_next_subscription(char *ext_shm_addr, struct sr_mod_info_mod_s *mod, sr_datastore_t ds,
-        sr_sub_event_t ev, uint32_t last_priority, uint32_t *next_priority_p, uint32_t *sub_count_p, int *opts_p)
+sr_shmsub_change_notify_next_subscription(sr_mod_change_sub_t *shm_msub, uint32_t sub_count, sr_sub_event_t ev,
+        uint32_t last_priority, uint32_t *next_priority_p, uint32_t *sub_count_p, int *opts_p)
 {
     uint32_t i;
-    sr_mod_change_sub_t *shm_msub;
     int opts = 0;
 
-    shm_msub = (sr_mod_change_sub_t *)(ext_shm_addr + mod->shm_mod->change_sub[ds].subs);
     *sub_count_p = 0;
-    for (i = 0; i < mod->shm_mod->change_sub[ds].sub_count; ++i) {
+    for (i = 0; i < sub_count; ++i) {
         if (!sr_shmsub_change_is_valid(ev, shm_msub[i].opts)) {
             continue;
         }
@@ -456,23 +487,19 @@ cleanup:
 /**
  * @brief Write into change subscribers event pipe to notify them there is a new event.
  *
- * @param[in] ext_shm_addr Ext SHM address.
- * @param[in] mod Mod info module to use.
- * @param[in] ds Datastore.
+ * @param[in] shm_msub Change subscriptions of a module, in ext SHM or a snapshot.
+ * @param[in] sub_count Change subscription count.
  * @param[in] ev Change event.
  * @param[in] priority Priority of the subscribers with new event.
  * @return err_info, NULL on success.
  */
 static sr_error_info_t *
-sr_shmsub_change_notify_evpipe(char *ext_shm_addr, struct sr_mod_info_mod_s *mod, sr_datastore_t ds, sr_sub_event_t ev,
-        uint32_t priority)
+sr_shmsub_change_notify_evpipe(sr_mod_change_sub_t *shm_msub, uint32_t sub_count, sr_sub_event_t ev, uint32_t priority)
 {
     sr_error_info_t *err_info = NULL;
     uint32_t i;
-    sr_mod_change_sub_t *shm_msub;
 
-    shm_msub = (sr_mod_change_sub_t *)(ext_shm_addr + mod->shm_mod->change_sub[ds].subs);
-    for (i = 0; i < mod->shm_mod->change_sub[ds].sub_count; ++i) {
+    for (i = 0; i < sub_count; ++i) {
         if (!sr_shmsub_change_is_valid(ev, shm_msub[i].opts)) {
             continue;
         }
@@ -496,7 +523,8 @@ sr_shmsub_change_notify_update(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
     sr_multi_sub_shm_t *multi_sub_shm;
     struct sr_mod_info_mod_s *mod = NULL;
     struct lyd_node *edit;
-    uint32_t cur_priority, subscriber_count, diff_lyb_len;
+    uint32_t cur_priority, subscriber_count, diff_lyb_len, msub_count;
+    sr_mod_change_sub_t *shm_msub;
     char *diff_lyb = NULL;
     struct ly_ctx *ly_ctx;
     sr_shm_t shm_sub = SR_SHM_INITIALIZER;
@@ -506,9 +534,12 @@ sr_shmsub_change_notify_update(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
     ly_ctx = lyd_node_module(mod_info->diff)->ctx;
 
     while ((mod = sr_modinfo_next_mod(mod, mod_info, mod_info->diff))) {
+        /* change subscriptions of the module */
+        shm_msub = (sr_mod_change_sub_t *)(mod_info->conn->ext_shm.addr + mod->shm_mod->change_sub[mod_info->ds].subs);
+        msub_count = mod->shm_mod->change_sub[mod_info->ds].sub_count;
+
         /* just find out whether there are any subscriptions and if so, what is the highest priority */
-        if (!sr_shmsub_change_notify_has_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_UPDATE,
-                &cur_priority)) {
+        if (!sr_shmsub_change_notify_has_subscription(shm_msub, msub_count, SR_SUB_EV_UPDATE, &cur_priority)) {
             continue;
         }
 
@@ -527,7 +558,7 @@ sr_shmsub_change_notify_update(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
         /* correctly start the loop, with fake last priority 1 higher than the actual highest */
-        sr_shmsub_change_notify_next_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_UPDATE,
+        sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, SR_SUB_EV_UPDATE,
                 cur_priority + 1, &cur_priority, &subscriber_count, NULL);
 
         do {
@@ -537,7 +568,7 @@ sr_shmsub_change_notify_update(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
             }
 
             /* remap sub SHM once we have the lock, it will do anything only on the first call */
-            err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len);
+            err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len);
             if (err_info) {
                 goto cleanup;
             }
@@ -551,8 +582,7 @@ sr_shmsub_change_notify_update(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
                     subscriber_count, 0, diff_lyb, diff_lyb_len);
 
             /* notify using event pipe and wait until all the subscribers have processed the event */
-            if ((err_info = sr_shmsub_change_notify_evpipe(mod_info->conn->ext_shm.addr, mod, mod_info->ds,
-                    SR_SUB_EV_UPDATE, cur_priority))) {
+            if ((err_info = sr_shmsub_change_notify_evpipe(shm_msub, msub_count, SR_SUB_EV_UPDATE, cur_priority))) {
                 goto cleanup;
             }
 
@@ -606,7 +636,7 @@ sr_shmsub_change_notify_update(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
             }
 
             /* find out what is the next priority and how many subscribers have it */
-            sr_shmsub_change_notify_next_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_UPDATE,
+            sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, SR_SUB_EV_UPDATE,
                     cur_priority, &cur_priority, &subscriber_count, NULL);
         } while (subscriber_count);
 
@@ -631,10 +661,15 @@ sr_shmsub_change_notify_clear(struct sr_mod_info_s *mod_info, sr_sub_event_t ev)
     sr_error_info_t *err_info = NULL;
     sr_multi_sub_shm_t *multi_sub_shm;
     struct sr_mod_info_mod_s *mod = NULL;
-    uint32_t cur_priority, subscriber_count;
+    uint32_t cur_priority, subscriber_count, msub_count;
+    sr_mod_change_sub_t *shm_msub;
     sr_shm_t shm_sub = SR_SHM_INITIALIZER;
 
     while ((mod = sr_modinfo_next_mod(mod, mod_info, mod_info->diff))) {
+        /* change subscriptions of the module */
+        shm_msub = (sr_mod_change_sub_t *)(mod_info->conn->ext_shm.addr + mod->shm_mod->change_sub[mod_info->ds].subs);
+        msub_count = mod->shm_mod->change_sub[mod_info->ds].sub_count;
+
         /* open sub SHM and map it */
         if ((err_info = sr_shmsub_open_map(mod->ly_mod->name, sr_ds2str(mod_info->ds), -1, &shm_sub, sizeof *multi_sub_shm))) {
             goto cleanup;
@@ -642,7 +677,7 @@ sr_shmsub_change_notify_clear(struct sr_mod_info_s *mod_info, sr_sub_event_t ev)
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
         /* just find out whether there are any subscriptions and if so, what is the highest priority */
-        if (!sr_shmsub_change_notify_has_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, ev, &cur_priority)) {
+        if (!sr_shmsub_change_notify_has_subscription(shm_msub, msub_count, ev, &cur_priority)) {
             /* it is still possible that the subscription unsubscribed already */
 
             /* SUB WRITE LOCK */
@@ -667,7 +702,7 @@ sr_shmsub_change_notify_clear(struct sr_mod_info_s *mod_info, sr_sub_event_t ev)
         }
 
         /* correctly start the loop, with fake last priority 1 higher than the actual highest */
-        sr_shmsub_change_notify_next_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, ev,
+        sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, ev,
                 cur_priority + 1, &cur_priority, &subscriber_count, NULL);
 
         do {
@@ -683,8 +718,8 @@ clear_event:
                 /* clear it */
                 sr_shmsub_multi_notify_write_event(multi_sub_shm, mod->request_id, cur_priority, 0, NULL, 0, 0, NULL, 0);
 
-                /* remap sub SHM to make it smaller */
-                if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm))) {
+                /* remap sub SHM, it is shrunk only if it grew too large */
+                if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm))) {
                     /* SUB WRITE UNLOCK */
                     sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_WRITE, __func__);
                     goto cleanup;
@@ -702,7 +737,7 @@ clear_event:
             sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_WRITE, __func__);
 
             /* find out what is the next priority and how many subscribers have it */
-            sr_shmsub_change_notify_next_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, ev,
+            sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, ev,
                     cur_priority, &cur_priority, &subscriber_count, NULL);
         } while (subscriber_count);
 
@@ -725,20 +760,20 @@ sr_shmsub_change_notify_change(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
     sr_error_info_t *err_info = NULL;
     sr_multi_sub_shm_t *multi_sub_shm;
     struct sr_mod_info_mod_s *mod = NULL;
-    uint32_t cur_priority, subscriber_count, diff_lyb_len;
-    char *diff_lyb = NULL, *ext_shm_addr, *ext_shm_buf = NULL;
+    uint32_t cur_priority, subscriber_count, diff_lyb_len, msub_count;
+    sr_mod_change_sub_t *shm_msub, *msub_snap = NULL;
+    char *diff_lyb = NULL;
     sr_shm_t shm_sub = SR_SHM_INITIALIZER;
     int opts;
 
-    /* use our ext SHM mapping by default */
-    ext_shm_addr = mod_info->conn->ext_shm.addr;
-
     while ((mod = sr_modinfo_next_mod(mod, mod_info, mod_info->diff))) {
+        /* change subscriptions of the module */
+        shm_msub = (sr_mod_change_sub_t *)(mod_info->conn->ext_shm.addr + mod->shm_mod->change_sub[mod_info->ds].subs);
+        msub_count = mod->shm_mod->change_sub[mod_info->ds].sub_count;
+
         /* just find out whether there are any subscriptions and if so, what is the highest priority */
-        if (!sr_shmsub_change_notify_has_subscription(ext_shm_addr, mod, mod_info->ds, SR_SUB_EV_CHANGE,
-                    &cur_priority)) {
-            if (!sr_shmsub_change_notify_has_subscription(ext_shm_addr, mod, mod_info->ds, SR_SUB_EV_DONE,
-                    &cur_priority)) {
+        if (!sr_shmsub_change_notify_has_subscription(shm_msub, msub_count, SR_SUB_EV_CHANGE, &cur_priority)) {
+            if (!sr_shmsub_change_notify_has_subscription(shm_msub, msub_count, SR_SUB_EV_DONE, &cur_priority)) {
                 if (mod_info->ds == SR_DS_RUNNING) {
                     SR_LOG_INF("There are no subscribers for changes of the module \"%s\" in %s DS.",
                             mod->ly_mod->name, sr_ds2str(mod_info->ds));
@@ -764,18 +799,19 @@ sr_shmsub_change_notify_change(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
         /* correctly start the loop, with fake last priority 1 higher than the actual highest */
-        sr_shmsub_change_notify_next_subscription(ext_shm_addr, mod, mod_info->ds, SR_SUB_EV_CHANGE,
+        sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, SR_SUB_EV_CHANGE,
                 cur_priority + 1, &cur_priority, &subscriber_count, &opts);
 
         do {
-            if ((opts & SR_SUBSCR_UNLOCKED) && !ext_shm_buf) {
-                /* subscriber wants subscriptions (main/ext SHM) unlocked, so make a copy and unlock it */
-                ext_shm_buf = malloc(mod_info->conn->ext_shm.size);
-                SR_CHECK_MEM_GOTO(!ext_shm_buf, err_info, cleanup);
-                memcpy(ext_shm_buf, mod_info->conn->ext_shm.addr, mod_info->conn->ext_shm.size);
+            if ((opts & SR_SUBSCR_UNLOCKED) && !msub_snap) {
+                /* subscriber wants subscriptions (main/ext SHM) unlocked, so make a snapshot of only
+                 * the change subscriptions of this module and unlock it */
+                msub_snap = malloc(msub_count * sizeof *msub_snap);
+                SR_CHECK_MEM_GOTO(!msub_snap, err_info, cleanup);
+                memcpy(msub_snap, shm_msub, msub_count * sizeof *msub_snap);
 
                 /* update pointers */
-                ext_shm_addr = ext_shm_buf;
+                shm_msub = msub_snap;
 
                 /* SHM UNLOCK */
                 sr_shmmain_unlock(mod_info->conn, SR_LOCK_READ, 0, 0);
@@ -787,7 +823,7 @@ sr_shmsub_change_notify_change(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
             }
 
             /* remap sub SHM once we have the lock, it will do anything only on the first call */
-            if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len))) {
+            if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len))) {
                 goto cleanup;
             }
             multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
@@ -800,8 +836,7 @@ sr_shmsub_change_notify_change(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
                     subscriber_count, 0, diff_lyb, diff_lyb_len);
 
             /* notify using event pipe and wait until all the subscribers have processed the event */
-            if ((err_info = sr_shmsub_change_notify_evpipe(ext_shm_addr, mod, mod_info->ds,
-                    SR_SUB_EV_CHANGE, cur_priority))) {
+            if ((err_info = sr_shmsub_change_notify_evpipe(shm_msub, msub_count, SR_SUB_EV_CHANGE, cur_priority))) {
                 goto cleanup;
             }
 
@@ -822,17 +857,16 @@ sr_shmsub_change_notify_change(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
             }
 
             /* find out what is the next priority and how many subscribers have it */
-            sr_shmsub_change_notify_next_subscription(ext_shm_addr, mod, mod_info->ds, SR_SUB_EV_CHANGE,
+            sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, SR_SUB_EV_CHANGE,
                     cur_priority, &cur_priority, &subscriber_count, &opts);
         } while (subscriber_count);
 
         /* next module */
         sr_shm_clear(&shm_sub);
-        if (ext_shm_buf) {
+        if (msub_snap) {
             /* the unlocked callback was called, lock again */
-            free(ext_shm_buf);
-            ext_shm_buf = NULL;
-            ext_shm_addr = mod_info->conn->ext_shm.addr;
+            free(msub_snap);
+            msub_snap = NULL;
             /* SHM LOCK */
             err_info = sr_shmmain_lock_remap(mod_info->conn, SR_LOCK_READ, 0, 0);
         }
@@ -843,8 +877,8 @@ sr_shmsub_change_notify_change(struct sr_mod_info_s *mod_info, sr_sid_t sid, uin
 cleanup:
     free(diff_lyb);
     sr_shm_clear(&shm_sub);
-    if (ext_shm_buf) {
-        free(ext_shm_buf);
+    if (msub_snap) {
+        free(msub_snap);
         /* SHM LOCK */
         err_info = sr_shmmain_lock_remap(mod_info->conn, SR_LOCK_READ, 0, 0);
     }
@@ -857,13 +891,17 @@ sr_shmsub_change_notify_change_done(struct sr_mod_info_s *mod_info, sr_sid_t sid
     sr_error_info_t *err_info = NULL;
     sr_multi_sub_shm_t *multi_sub_shm;
     struct sr_mod_info_mod_s *mod = NULL;
-    uint32_t cur_priority, subscriber_count, diff_lyb_len;
+    uint32_t cur_priority, subscriber_count, diff_lyb_len, msub_count;
+    sr_mod_change_sub_t *shm_msub;
     char *diff_lyb = NULL;
     sr_shm_t shm_sub = SR_SHM_INITIALIZER;
 
     while ((mod = sr_modinfo_next_mod(mod, mod_info, mod_info->diff))) {
-        if (!sr_shmsub_change_notify_has_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_DONE,
-                &cur_priority)) {
+        /* change subscriptions of the module */
+        shm_msub = (sr_mod_change_sub_t *)(mod_info->conn->ext_shm.addr + mod->shm_mod->change_sub[mod_info->ds].subs);
+        msub_count = mod->shm_mod->change_sub[mod_info->ds].sub_count;
+
+        if (!sr_shmsub_change_notify_has_subscription(shm_msub, msub_count, SR_SUB_EV_DONE, &cur_priority)) {
             /* no subscriptions interested in this event */
             continue;
         }
@@ -885,7 +923,7 @@ sr_shmsub_change_notify_change_done(struct sr_mod_info_s *mod_info, sr_sid_t sid
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
         /* correctly start the loop, with fake last priority 1 higher than the actual highest */
-        sr_shmsub_change_notify_next_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_DONE,
+        sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, SR_SUB_EV_DONE,
                 cur_priority + 1, &cur_priority, &subscriber_count, NULL);
 
         do {
@@ -895,7 +933,7 @@ sr_shmsub_change_notify_change_done(struct sr_mod_info_s *mod_info, sr_sid_t sid
             }
 
             /* remap sub SHM once we have the lock, it will do anything only on the first call */
-            if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len))) {
+            if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len))) {
                 goto cleanup;
             }
             multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
@@ -908,8 +946,7 @@ sr_shmsub_change_notify_change_done(struct sr_mod_info_s *mod_info, sr_sid_t sid
                     subscriber_count, 0, diff_lyb, diff_lyb_len);
 
             /* notify using event pipe and do not wait for subscribers */
-            if ((err_info = sr_shmsub_change_notify_evpipe(mod_info->conn->ext_shm.addr, mod, mod_info->ds,
-                    SR_SUB_EV_DONE, cur_priority))) {
+            if ((err_info = sr_shmsub_change_notify_evpipe(shm_msub, msub_count, SR_SUB_EV_DONE, cur_priority))) {
                 goto cleanup;
             }
 
@@ -917,7 +954,7 @@ sr_shmsub_change_notify_change_done(struct sr_mod_info_s *mod_info, sr_sid_t sid
             sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_WRITE, __func__);
 
             /* find out what is the next priority and how many subscribers have it */
-            sr_shmsub_change_notify_next_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_DONE,
+            sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, SR_SUB_EV_DONE,
                     cur_priority, &cur_priority, &subscriber_count, NULL);
         } while (subscriber_count);
 
@@ -937,20 +974,24 @@ sr_shmsub_change_notify_change_abort(struct sr_mod_info_s *mod_info, sr_sid_t si
     sr_multi_sub_shm_t *multi_sub_shm;
     struct lyd_node *abort_diff;
     struct sr_mod_info_mod_s *mod = NULL;
-    uint32_t cur_priority, err_priority, subscriber_count, err_subscriber_count, diff_lyb_len;
+    uint32_t cur_priority, err_priority, subscriber_count, err_subscriber_count, diff_lyb_len, msub_count;
+    sr_mod_change_sub_t *shm_msub;
     char *diff_lyb = NULL;
     sr_shm_t shm_sub = SR_SHM_INITIALIZER;
     int first_iter, last_subscr = 0;
 
     while ((mod = sr_modinfo_next_mod(mod, mod_info, mod_info->diff))) {
+        /* change subscriptions of the module */
+        shm_msub = (sr_mod_change_sub_t *)(mod_info->conn->ext_shm.addr + mod->shm_mod->change_sub[mod_info->ds].subs);
+        msub_count = mod->shm_mod->change_sub[mod_info->ds].sub_count;
+
         /* open sub SHM and map it */
         if ((err_info = sr_shmsub_open_map(mod->ly_mod->name, sr_ds2str(mod_info->ds), -1, &shm_sub, sizeof *multi_sub_shm))) {
             goto cleanup;
         }
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
-        if (!sr_shmsub_change_notify_has_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_ABORT,
-                &cur_priority)) {
+        if (!sr_shmsub_change_notify_has_subscription(shm_msub, msub_count, SR_SUB_EV_ABORT, &cur_priority)) {
             /* no subscriptions interested in this event, but we still want to clear the event */
 clear_shm:
             /* SUB WRITE LOCK */
@@ -959,10 +1000,10 @@ clear_shm:
             }
 
             if (multi_sub_shm->event == SR_SUB_EV_ERROR) {
-                /* this must be the right subscription SHM, we still have apply-changes locks, clear and shrink it */
+                /* this must be the right subscription SHM, we still have apply-changes locks, clear it */
                 assert(multi_sub_shm->request_id == mod->request_id);
                 sr_shmsub_multi_notify_write_event(multi_sub_shm, mod->request_id, cur_priority, 0, NULL, 0, 0, NULL, 0);
-                if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm))) {
+                if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm))) {
                     goto cleanup_wrunlock;
                 }
                 multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
@@ -1008,7 +1049,7 @@ clear_shm:
         /* correctly start the loop, with fake last priority 1 higher than the actual highest */
         ++cur_priority;
         do {
-            sr_shmsub_change_notify_next_subscription(mod_info->conn->ext_shm.addr, mod, mod_info->ds, SR_SUB_EV_ABORT,
+            sr_shmsub_change_notify_next_subscription(shm_msub, msub_count, SR_SUB_EV_ABORT,
                     cur_priority, &cur_priority, &subscriber_count, NULL);
             if (last_subscr && (err_priority == cur_priority)) {
                 /* do not notify subscribers that did not process the previous event */
@@ -1029,7 +1070,7 @@ clear_shm:
             }
 
             /* remap sub SHM once we have the lock, it will do anything only on the first call */
-            if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len))) {
+            if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm + diff_lyb_len))) {
                 goto cleanup_wrunlock;
             }
             multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
@@ -1039,8 +1080,7 @@ clear_shm:
                     subscriber_count, 0, diff_lyb, diff_lyb_len);
 
             /* notify using event pipe and do not wait for subscribers */
-            if ((err_info = sr_shmsub_change_notify_evpipe(mod_info->conn->ext_shm.addr, mod, mod_info->ds,
-                    SR_SUB_EV_ABORT, cur_priority))) {
+            if ((err_info = sr_shmsub_change_notify_evpipe(shm_msub, msub_count, SR_SUB_EV_ABORT, cur_priority))) {
                 goto cleanup_wrunlock;
             }
 
@@ -1056,9 +1096,8 @@ clear_shm:
         sr_shm_clear(&shm_sub);
     }
 
-    /* unreachable unless the failed subscription was not found */
-    SR_ERRINFO_INT(&err_info);
-    return err_info;
+    /* no callback failed, all the subscribers accepted the changes and were notified */
+    return NULL;
 
 cleanup_wrunlock:
     /* SUB WRITE UNLOCK */
@@ -1103,7 +1142,7 @@ sr_shmsub_oper_notify(const struct lys_module *ly_mod, const char *xpath, const
     }
 
     /* remap to make space for additional data (parent) */
-    if ((err_info = sr_shm_remap(&shm_sub, sizeof *sub_shm + parent_lyb_len))) {
+    if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *sub_shm + parent_lyb_len))) {
         goto cleanup_wrunlock;
     }
     sub_shm = (sr_sub_shm_t *)shm_sub.addr;
@@ -1311,16 +1350,121 @@ cleanup:
     }
 }
 
+/**
+ * @brief Make a private snapshot of RPC subscriptions so that they can be used with main SHM unlocked.
+ * The snapshot has the same layout as ext SHM, starting with the RPC structure itself.
+ *
+ * @param[in] ext_shm_addr Ext SHM mapping address.
+ * @param[in] shm_rpc SHM RPC structure to make a snapshot of.
+ * @param[out] snap Snapshot to be used instead of the ext SHM address.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmsub_rpc_subs_snapshot(char *ext_shm_addr, sr_rpc_t *shm_rpc, char **snap)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_rpc_t *snap_rpc;
+    sr_rpc_sub_t *shm_subs, *snap_subs;
+    size_t size;
+    char *snap_end;
+    uint16_t i;
+
+    shm_subs = (sr_rpc_sub_t *)(ext_shm_addr + shm_rpc->subs);
+
+    /* learn the size */
+    size = sizeof *snap_rpc + shm_rpc->sub_count * sizeof *shm_subs;
+    for (i = 0; i < shm_rpc->sub_count; ++i) {
+        size += sr_strshmlen(ext_shm_addr + shm_subs[i].xpath);
+    }
+
+    *snap = malloc(size);
+    SR_CHECK_MEM_RET(!*snap, err_info);
+    snap_end = *snap;
+
+    /* copy the RPC with its subscriptions, op_path is not needed */
+    snap_rpc = (sr_rpc_t *)(*snap + sr_shmcpy(*snap, shm_rpc, sizeof *snap_rpc, &snap_end));
+    snap_rpc->op_path = 0;
+    snap_rpc->subs = sr_shmcpy(*snap, shm_subs, shm_rpc->sub_count * sizeof *shm_subs, &snap_end);
+    snap_rpc->sub_cap = snap_rpc->sub_count;
+
+    /* copy xpaths */
+    snap_subs = (sr_rpc_sub_t *)(*snap + snap_rpc->subs);
+    for (i = 0; i < shm_rpc->sub_count; ++i) {
+        snap_subs[i].xpath = sr_shmstrcpy(*snap, ext_shm_addr + shm_subs[i].xpath, &snap_end);
+    }
+
+    assert((size_t)(snap_end - *snap) == size);
+    return NULL;
+}
+
+/** counter used for spreading RPC/action requests of this process among the request slots */
+static ATOMIC_T sr_rpc_slot_next;
+
+/**
+ * @brief Open and map subscription SHM of a free RPC/action request slot and keep its WRITE lock.
+ * If all the slots are busy, wait for one of them.
+ *
+ * @param[in] mod_name Module name of the RPC/action.
+ * @param[in] op_path Operation path.
+ * @param[out] shm_sub Mapped subscription SHM of the slot.
+ * @param[out] slot Locked request slot.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmsub_rpc_notify_slot_wrlock(const char *mod_name, const char *op_path, sr_shm_t *shm_sub, uint32_t *slot)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_sub_shm_t *sub_shm;
+    uint32_t i, start;
+
+    /* start with a different slot every time so that concurrent requests do not compete for the same one */
+    start = ATOMIC_INC_RELAXED(sr_rpc_slot_next) % SR_RPC_SLOT_COUNT;
+
+    for (i = 0; i < SR_RPC_SLOT_COUNT; ++i) {
+        *slot = (start + i) % SR_RPC_SLOT_COUNT;
+        if ((err_info = sr_shmsub_open_map(mod_name, sr_rpc_slot_suffix(*slot), sr_str_hash(op_path), shm_sub,
+                sizeof(sr_multi_sub_shm_t)))) {
+            return err_info;
+        }
+        sub_shm = (sr_sub_shm_t *)shm_sub->addr;
+
+        /* MUTEX LOCK, do not wait for the slot */
+        if (!pthread_mutex_trylock(&sub_shm->lock.mutex)) {
+            if (!sub_shm->lock.readers && !sub_shm->event) {
+                /* free slot found, keep it locked */
+                return NULL;
+            }
+
+            /* MUTEX UNLOCK */
+            pthread_mutex_unlock(&sub_shm->lock.mutex);
+        }
+        sr_shm_clear(shm_sub);
+    }
+
+    /* all the slots are busy, wait for the first one */
+    *slot = start;
+    if ((err_info = sr_shmsub_open_map(mod_name, sr_rpc_slot_suffix(*slot), sr_str_hash(op_path), shm_sub,
+            sizeof(sr_multi_sub_shm_t)))) {
+        return err_info;
+    }
+    if ((err_info = sr_shmsub_notify_new_wrlock((sr_sub_shm_t *)shm_sub->addr, op_path, 0))) {
+        sr_shm_clear(shm_sub);
+        return err_info;
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_shmsub_rpc_notify(sr_conn_ctx_t *conn, const char *op_path, const struct lyd_node *input, sr_sid_t sid,
         uint32_t timeout_ms, uint32_t *request_id, struct lyd_node **output, sr_error_info_t **cb_err_info)
 {
     sr_error_info_t *err_info = NULL;
     sr_rpc_t *shm_rpc;
-    char *input_lyb = NULL, *ext_shm_addr, *ext_shm_buf = NULL;
-    uint32_t i, input_lyb_len, cur_priority, subscriber_count, *evpipes = NULL;
+    char *input_lyb = NULL, *ext_shm_addr, *rpc_snap = NULL;
+    uint32_t i, slot = 0, input_lyb_len, cur_priority, subscriber_count, *evpipes = NULL;
     int opts;
-    sr_multi_sub_shm_t *multi_sub_shm;
+    sr_multi_sub_shm_t *multi_sub_shm = NULL;
     sr_shm_t shm_sub = SR_SHM_INITIALIZER;
 
     assert(!input->parent);
@@ -1345,46 +1489,48 @@ sr_shmsub_rpc_notify(sr_conn_ctx_t *conn, const char *op_path, const struct lyd_
     }
     input_lyb_len = lyd_lyb_data_length(input_lyb);
 
-    /* open sub SHM and map it */
-    if ((err_info = sr_shmsub_open_map(lyd_node_module(input)->name, "rpc", sr_str_hash(op_path), &shm_sub, sizeof *multi_sub_shm))) {
-        goto cleanup;
-    }
-    multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
-
     /* correctly start the loop, with fake last priority 1 higher than the actual highest */
     sr_shmsub_rpc_notify_next_subscription(ext_shm_addr, shm_rpc, input, cur_priority + 1, &cur_priority,
             &evpipes, &subscriber_count, &opts);
 
     do {
-        if ((opts & SR_SUBSCR_UNLOCKED) && !ext_shm_buf) {
-            /* subscriber wants subscriptions (main/ext SHM) unlocked, so make a copy and unlock it */
-            ext_shm_buf = malloc(conn->ext_shm.size);
-            SR_CHECK_MEM_GOTO(!ext_shm_buf, err_info, cleanup);
-            memcpy(ext_shm_buf, conn->ext_shm.addr, conn->ext_shm.size);
+        if ((opts & SR_SUBSCR_UNLOCKED) && !rpc_snap) {
+            /* subscriber wants subscriptions (main/ext SHM) unlocked, so make a snapshot of only
+             * the subscriptions of this RPC and unlock it */
+            if ((err_info = sr_shmsub_rpc_subs_snapshot(ext_shm_addr, shm_rpc, &rpc_snap))) {
+                goto cleanup;
+            }
 
             /* update pointers */
-            ext_shm_addr = ext_shm_buf;
-            shm_rpc = sr_shmmain_find_rpc((sr_main_shm_t *)conn->main_shm.addr, ext_shm_addr, op_path, 0);
-            assert(shm_rpc);
+            ext_shm_addr = rpc_snap;
+            shm_rpc = (sr_rpc_t *)rpc_snap;
 
             /* SHM UNLOCK */
             sr_shmmain_unlock(conn, SR_LOCK_READ, 0, 0);
         }
 
-        /* SUB WRITE LOCK */
-        if ((err_info = sr_shmsub_notify_new_wrlock((sr_sub_shm_t *)multi_sub_shm, op_path, 0))) {
-            goto cleanup;
+        if (!shm_sub.addr) {
+            /* SUB WRITE LOCK, first priority uses any free request slot and keeps it locked for all the priorities
+             * until the output is parsed so that no other request can use it meanwhile */
+            if ((err_info = sr_shmsub_rpc_notify_slot_wrlock(lyd_node_module(input)->name, op_path, &shm_sub, &slot))) {
+                goto cleanup;
+            }
+            multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
         }
 
         /* remap sub SHM once we have the lock, it will do anything only on the first call */
-        if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm + input_lyb_len))) {
+        if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm + input_lyb_len))) {
             goto cleanup_wrunlock;
         }
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
-        /* write the event */
+        /* write the event, request IDs are unique among all the slots and define the slot */
         if (!*request_id) {
-            *request_id = ++multi_sub_shm->request_id;
+            if (multi_sub_shm->request_id) {
+                *request_id = multi_sub_shm->request_id + SR_RPC_SLOT_COUNT;
+            } else {
+                *request_id = slot + 1;
+            }
         }
         sr_shmsub_multi_notify_write_event(multi_sub_shm, *request_id, cur_priority, SR_SUB_EV_RPC, &sid,
                 subscriber_count, 0, input_lyb, input_lyb_len);
@@ -1396,17 +1542,17 @@ sr_shmsub_rpc_notify(sr_conn_ctx_t *conn, const char *op_path, const struct lyd_
             }
         }
 
-        /* SUB WRITE UNLOCK */
-        if ((err_info = sr_shmsub_notify_finish_wrunlock((sr_sub_shm_t *)multi_sub_shm, sizeof *multi_sub_shm,
+        /* wait for the subscribers, keep the lock */
+        if ((err_info = sr_shmsub_notify_finish_wait((sr_sub_shm_t *)multi_sub_shm, sizeof *multi_sub_shm,
                 timeout_ms, cb_err_info))) {
-            goto cleanup;
+            goto cleanup_unlock;
         }
 
         if (*cb_err_info) {
-            /* failed callback or timeout */
+            /* failed callback or timeout, the error event is left for the abort */
             SR_LOG_WRN("Event \"%s\" with ID %u priority %u failed (%s).", sr_ev2str(SR_SUB_EV_RPC),
                     *request_id, cur_priority, sr_strerror((*cb_err_info)->err_code));
-            goto cleanup;
+            goto cleanup_unlock;
         } else {
             SR_LOG_INF("Event \"%s\" with ID %u priority %u succeeded.", sr_ev2str(SR_SUB_EV_RPC),
                     *request_id, cur_priority);
@@ -1418,14 +1564,9 @@ sr_shmsub_rpc_notify(sr_conn_ctx_t *conn, const char *op_path, const struct lyd_
                 &evpipes, &subscriber_count, &opts);
     } while (subscriber_count);
 
-    /* SUB READ LOCK */
-    if ((err_info = sr_rwlock(&multi_sub_shm->lock, SR_MAIN_LOCK_TIMEOUT * 1000, SR_LOCK_READ, __func__))) {
-        goto cleanup;
-    }
-
-    /* remap sub SHM */
+    /* remap sub SHM, the output could have been larger */
     if ((err_info = sr_shm_remap(&shm_sub, 0))) {
-        goto cleanup_rdunlock;
+        goto cleanup_wrunlock;
     }
     multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
@@ -1436,25 +1577,28 @@ sr_shmsub_rpc_notify(sr_conn_ctx_t *conn, const char *op_path, const struct lyd_
     if (ly_errno) {
         sr_errinfo_new_ly(&err_info, lyd_node_module(input)->ctx);
         sr_errinfo_new(&err_info, SR_ERR_VALIDATION_FAILED, NULL, "Failed to parse returned \"RPC\" data.");
-        goto cleanup_rdunlock;
+        goto cleanup_wrunlock;
     }
 
     /* success */
 
-cleanup_rdunlock:
-    /* SUB READ UNLOCK */
-    sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
-    goto cleanup;
-
 cleanup_wrunlock:
+    /* the slot is free for other requests */
+    multi_sub_shm->event = SR_SUB_EV_NONE;
+
     /* SUB WRITE UNLOCK */
     sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_WRITE, __func__);
+    goto cleanup;
+
+cleanup_unlock:
+    /* MUTEX UNLOCK, there may still be readers on timeout */
+    pthread_mutex_unlock(&multi_sub_shm->lock.mutex);
 cleanup:
     sr_shm_clear(&shm_sub);
     free(input_lyb);
     free(evpipes);
-    if (ext_shm_buf) {
-        free(ext_shm_buf);
+    if (rpc_snap) {
+        free(rpc_snap);
         /* SHM LOCK */
         err_info = sr_shmmain_lock_remap(conn, SR_LOCK_READ, 0, 0);
     }
@@ -1475,8 +1619,9 @@ sr_shmsub_rpc_notify_abort(sr_conn_ctx_t *conn, const char *op_path, const struc
 
     assert(request_id);
 
-    /* open sub SHM and map it */
-    if ((err_info = sr_shmsub_open_map(lyd_node_module(input)->name, "rpc", sr_str_hash(op_path), &shm_sub, sizeof *multi_sub_shm))) {
+    /* open sub SHM of the request slot and map it */
+    if ((err_info = sr_shmsub_open_map(lyd_node_module(input)->name, sr_rpc_slot_suffix((request_id - 1) % SR_RPC_SLOT_COUNT),
+            sr_str_hash(op_path), &shm_sub, sizeof *multi_sub_shm))) {
         goto cleanup;
     }
     multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
@@ -1491,10 +1636,10 @@ clear_shm:
             goto cleanup;
         }
 
-        /* clear and shrink the SHM */
+        /* clear the SHM, it is shrunk only if it grew too large */
         assert(multi_sub_shm->event == SR_SUB_EV_ERROR);
         sr_shmsub_multi_notify_write_event(multi_sub_shm, request_id, cur_priority, 0, NULL, 0, 0, NULL, 0);
-        if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm))) {
+        if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm))) {
             goto cleanup_wrunlock;
         }
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
@@ -1543,7 +1688,7 @@ clear_shm:
         }
 
         /* remap sub SHM once we have the lock, it will do anything only on the first call */
-        if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm + input_lyb_len))) {
+        if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm + input_lyb_len))) {
             goto cleanup_wrunlock;
         }
         multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
@@ -1583,26 +1728,23 @@ cleanup:
 }
 
 sr_error_info_t *
-sr_shmsub_notif_notify(const struct lyd_node *notif, time_t notif_ts, sr_sid_t sid, uint32_t *notif_sub_evpipe_nums,
-        uint32_t notif_sub_count)
+sr_shmsub_notif_notify(const struct lys_module *ly_mod, char * const *notif_lybs, uint32_t notif_count,
+        time_t notif_ts, sr_sid_t sid, uint32_t *notif_sub_evpipe_nums, uint32_t notif_sub_count)
 {
     sr_error_info_t *err_info = NULL;
-    struct lys_module *ly_mod;
-    char *notif_lyb = NULL;
+    char *ptr;
     uint32_t notif_lyb_len, request_id, i;
+    size_t data_len;
     sr_multi_sub_shm_t *multi_sub_shm;
     sr_shm_t shm_sub = SR_SHM_INITIALIZER;
 
-    assert(!notif->parent);
+    assert(notif_count);
 
-    ly_mod = lyd_node_module(notif);
-
-    /* print the notification into LYB */
-    if (lyd_print_mem(&notif_lyb, notif, LYD_LYB, 0)) {
-        sr_errinfo_new_ly(&err_info, ly_mod->ctx);
-        goto cleanup;
+    /* the notifications are already printed, learn the size of them all */
+    data_len = sizeof notif_ts + sizeof notif_count;
+    for (i = 0; i < notif_count; ++i) {
+        data_len += lyd_lyb_data_length(notif_lybs[i]);
     }
-    notif_lyb_len = lyd_lyb_data_length(notif_lyb);
 
     /* open sub SHM and map it */
     if ((err_info = sr_shmsub_open_map(ly_mod->name, "notif", -1, &shm_sub, sizeof *multi_sub_shm))) {
@@ -1616,15 +1758,25 @@ sr_shmsub_notif_notify(const struct lyd_node *notif, time_t notif_ts, sr_sid_t s
     }
 
     /* remap to make space for additional data */
-    if ((err_info = sr_shm_remap(&shm_sub, sizeof *multi_sub_shm + sizeof notif_ts + notif_lyb_len))) {
+    if ((err_info = sr_shm_remap_hwm(&shm_sub, sizeof *multi_sub_shm + data_len))) {
         goto cleanup_wrunlock;
     }
     multi_sub_shm = (sr_multi_sub_shm_t *)shm_sub.addr;
 
-    /* write the notification, we do not wait for any reply */
+    /* write the event with the timestamp */
     request_id = multi_sub_shm->request_id + 1;
     sr_shmsub_multi_notify_write_event(multi_sub_shm, request_id, 0, SR_SUB_EV_NOTIF, &sid, notif_sub_count,
-            notif_ts, notif_lyb, notif_lyb_len);
+            notif_ts, NULL, 0);
+
+    /* write the notifications directly after it, we do not wait for any reply */
+    ptr = shm_sub.addr + sizeof *multi_sub_shm + sizeof notif_ts;
+    memcpy(ptr, &notif_count, sizeof notif_count);
+    ptr += sizeof notif_count;
+    for (i = 0; i < notif_count; ++i) {
+        notif_lyb_len = lyd_lyb_data_length(notif_lybs[i]);
+        memcpy(ptr, notif_lybs[i], notif_lyb_len);
+        ptr += notif_lyb_len;
+    }
 
     /* notify all subscribers using event pipe and do not wait for them */
     for (i = 0; i < notif_sub_count; ++i) {
@@ -1640,7 +1792,6 @@ cleanup_wrunlock:
     sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_WRITE, __func__);
 cleanup:
     sr_shm_clear(&shm_sub);
-    free(notif_lyb);
     return err_info;
 }
 
@@ -1649,39 +1800,50 @@ cleanup:
  */
 
 /**
- * @brief Prepare temporary callback session for a change event callback.
+ * @brief Prepare callback session for a change event callback. The event diff is shared, only the subtrees
+ * selected by the subscription XPath are made visible.
  *
  * @param[in] change_subs Module change subscriptions.
  * @param[in] change_sub Change subscription.
- * @param[in] conn Connection to use.
  * @param[in] diff Diff from the event.
- * @param[in,out] tmp_sess Temporary callback session.
+ * @param[in,out] cb_sess Callback session.
  * @return err_info, NULL on success.
  */
 static sr_error_info_t *
 sr_shmsub_change_listen_prepare_sess(struct modsub_change_s *change_subs, struct modsub_changesub_s *change_sub,
-        sr_conn_ctx_t *conn, struct lyd_node *diff, sr_session_ctx_t *tmp_sess)
+        struct lyd_node *diff, sr_session_ctx_t *cb_sess)
 {
     sr_error_info_t *err_info = NULL;
+    sr_datastore_t ds = change_subs->ds;
 
     assert(diff);
 
-    tmp_sess->conn = conn;
-    tmp_sess->ds = change_subs->ds;
-    tmp_sess->ev = ((sr_multi_sub_shm_t *)change_subs->sub_shm.addr)->event;
-    tmp_sess->sid = ((sr_multi_sub_shm_t *)change_subs->sub_shm.addr)->sid;
-    lyd_free_withsiblings(tmp_sess->dt[tmp_sess->ds].diff);
+    cb_sess->ds = ds;
+    cb_sess->ev = ((sr_multi_sub_shm_t *)change_subs->sub_shm.addr)->event;
+    cb_sess->sid = ((sr_multi_sub_shm_t *)change_subs->sub_shm.addr)->sid;
+
+    /* forget the previous diff, keep the index set */
+    if (!cb_sess->dt[ds].diff_shared) {
+        lyd_free_withsiblings(cb_sess->dt[ds].diff);
+    }
+    sr_diff_view_free(cb_sess->dt[ds].diff_view);
+    cb_sess->dt[ds].diff_view = NULL;
+    if (cb_sess->dt[ds].diff_idx) {
+        cb_sess->dt[ds].diff_idx->indexed = 0;
+    }
+
+    /* use the event diff directly */
+    cb_sess->dt[ds].diff = diff;
+    cb_sess->dt[ds].diff_shared = 1;
 
-    /* duplicate (filtered) diff */
     if (change_sub->xpath) {
-        if ((err_info = sr_lyd_xpath_dup(diff, &change_sub->xpath, 1, NULL, &tmp_sess->dt[tmp_sess->ds].diff))) {
+        /* only the selected subtrees (with their parents) are visible */
+        if ((err_info = sr_diff_view_new(diff, change_sub->xpath, &cb_sess->dt[ds].diff_view))) {
             return err_info;
         }
-    } else {
-        tmp_sess->dt[tmp_sess->ds].diff = lyd_dup_withsiblings(diff, 0);
-        if (!tmp_sess->dt[tmp_sess->ds].diff) {
-            sr_errinfo_new_ly(&err_info, conn->ly_ctx);
-            return err_info;
+        if (!cb_sess->dt[ds].diff_view->count) {
+            /* whole diff filtered out */
+            cb_sess->dt[ds].diff = NULL;
         }
     }
 
@@ -1726,6 +1888,72 @@ sr_shmsub_change_listen_is_new_event(sr_multi_sub_shm_t *multi_sub_shm, struct m
     return 1;
 }
 
+/**
+ * @brief Argument of ::sr_shmsub_print_clb.
+ */
+struct sr_shmsub_print_arg_s {
+    sr_shm_t *shm;              /**< SHM to print into. */
+    size_t offset;              /**< Offset where to print next. */
+    sr_error_info_t *err_info;  /**< Error if printing failed. */
+};
+
+/**
+ * @brief libyang printer callback writing directly into a subscription SHM, growing it if needed.
+ */
+static ssize_t
+sr_shmsub_print_clb(void *arg, const void *buf, size_t count)
+{
+    struct sr_shmsub_print_arg_s *print_arg = arg;
+    size_t size;
+
+    if (print_arg->offset + count > print_arg->shm->size) {
+        /* at least double the size to avoid remapping too often */
+        size = print_arg->shm->size * 2;
+        if (size < print_arg->offset + count) {
+            size = print_arg->offset + count;
+        }
+        if ((print_arg->err_info = sr_shm_remap_hwm(print_arg->shm, size))) {
+            return -1;
+        }
+    }
+
+    memcpy(print_arg->shm->addr + print_arg->offset, buf, count);
+    print_arg->offset += count;
+    return count;
+}
+
+/**
+ * @brief Print data in LYB format directly into a subscription SHM, without an intermediate buffer.
+ * Needs WRITE lock, the SHM may be remapped.
+ *
+ * @param[in] shm SHM to print into.
+ * @param[in] offset Offset in the SHM where to print the data.
+ * @param[in] data Data to print.
+ * @param[in] options libyang printer options.
+ * @param[in] ly_ctx libyang context for errors.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmsub_print_lyb(sr_shm_t *shm, size_t offset, const struct lyd_node *data, int options, struct ly_ctx *ly_ctx)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_shmsub_print_arg_s print_arg;
+
+    print_arg.shm = shm;
+    print_arg.offset = offset;
+    print_arg.err_info = NULL;
+
+    if (lyd_print_clb(sr_shmsub_print_clb, &print_arg, data, LYD_LYB, options)) {
+        if (print_arg.err_info) {
+            err_info = print_arg.err_info;
+        } else {
+            sr_errinfo_new_ly(&err_info, ly_ctx);
+        }
+    }
+
+    return err_info;
+}
+
 /**
  * @brief Write the result of having processed a multi-subscriber event.
  *
@@ -1838,78 +2066,255 @@ sr_shmsub_prepare_error(sr_error_t err_code, sr_session_ctx_t *tmp_sess, char **
     return NULL;
 }
 
-sr_error_info_t *
-sr_shmsub_change_listen_process_module_events(struct modsub_change_s *change_subs, sr_conn_ctx_t *conn)
+/**
+ * @brief Change event callback task executed by a worker pool.
+ */
+struct sr_shmsub_change_task_s {
+    struct modsub_change_s *change_subs;    /**< Module change subscriptions. */
+    struct modsub_changesub_s *change_sub;  /**< Change subscription of this task. */
+    struct lyd_node *diff;                  /**< Diff from the event, shared by all the tasks. */
+    sr_sub_event_t event;                   /**< Event. */
+    uint32_t request_id;                    /**< Request ID. */
+
+    sr_session_ctx_t *cb_sess;              /**< Callback session of this task. */
+    int ret;                                /**< Callback return value. */
+    sr_error_info_t *err_info;              /**< Internal error, if any. */
+};
+
+/**
+ * @brief Call a change subscription callback, executed by a worker pool.
+ *
+ * @param[in] arg Array of change tasks.
+ * @param[in] idx Index of the task to execute.
+ */
+static void
+sr_shmsub_change_listen_task(void *arg, uint32_t idx)
+{
+    struct sr_shmsub_change_task_s *task = &((struct sr_shmsub_change_task_s *)arg)[idx];
+
+    /* prepare callback session */
+    if ((task->err_info = sr_shmsub_change_listen_prepare_sess(task->change_subs, task->change_sub, task->diff,
+            task->cb_sess))) {
+        return;
+    }
+
+    task->ret = 0;
+    /* whole diff may have been filtered out */
+    if (task->cb_sess->dt[task->cb_sess->ds].diff) {
+        task->ret = task->change_sub->cb(task->cb_sess, task->change_subs->module_name, task->change_sub->xpath,
+                sr_ev2api(task->event), task->request_id, task->change_sub->private_data);
+    }
+}
+
+/**
+ * @brief Process a change event by all the valid subscriptions in parallel. Needs SUB READ lock,
+ * which is kept on success and released on error.
+ *
+ * Results are evaluated in the order of subscriptions so the first failed callback decides the error.
+ * Unlike with sequential processing, all the callbacks are always called so all the successful ones
+ * will also get the "abort" event.
+ *
+ * @param[in] change_subs Module change subscriptions.
+ * @param[in] first_sub Index of the first valid subscription.
+ * @param[in] subscription Subscription structure with the worker pool and callback sessions to use.
+ * @param[in] diff Diff from the event.
+ * @param[out] valid_subscr_count Number of subscriptions that processed the event.
+ * @param[out] err_code Error code of the first failed callback.
+ * @param[in,out] tmp_sess Callback session of the event, error of the first failed callback is moved into it.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmsub_change_listen_process_parallel(struct modsub_change_s *change_subs, uint32_t first_sub,
+        sr_subscription_ctx_t *subscription, struct lyd_node *diff, uint32_t *valid_subscr_count, sr_error_t *err_code,
+        sr_session_ctx_t *tmp_sess)
 {
     sr_error_info_t *err_info = NULL;
-    uint32_t i, data_len = 0, valid_subscr_count, request_id;
-    char *data = NULL;
-    int ret;
-    struct lyd_node *diff = NULL;
-    sr_error_t err_code = SR_ERR_OK;
+    struct sr_shmsub_change_task_s *tasks;
     struct modsub_changesub_s *change_sub;
     sr_multi_sub_shm_t *multi_sub_shm;
-    sr_session_ctx_t tmp_sess;
-    sr_sub_event_t event;
+    sr_session_ctx_t **cb_sess;
+    uint32_t i, task_count = 0;
 
-    memset(&tmp_sess, 0, sizeof tmp_sess);
     multi_sub_shm = (sr_multi_sub_shm_t *)change_subs->sub_shm.addr;
 
-    /* SUB READ LOCK */
-    if ((err_info = sr_rwlock(&multi_sub_shm->lock, SR_MAIN_LOCK_TIMEOUT * 1000, SR_LOCK_READ, __func__))) {
-        goto cleanup;
+    /* collect all the subscriptions with a new event */
+    tasks = calloc(change_subs->sub_count - first_sub, sizeof *tasks);
+    if (!tasks) {
+        /* SUB READ UNLOCK */
+        sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
+        SR_ERRINFO_MEM(&err_info);
+        return err_info;
     }
-
-    for (i = 0; i < change_subs->sub_count; ++i) {
-        if (sr_shmsub_change_listen_is_new_event(multi_sub_shm, &change_subs->subs[i])) {
-            break;
+    for (i = first_sub; i < change_subs->sub_count; ++i) {
+        if (!sr_shmsub_change_listen_is_new_event(multi_sub_shm, &change_subs->subs[i])) {
+            continue;
         }
-    }
-    /* no new module event */
-    if (i == change_subs->sub_count) {
-        goto cleanup_rdunlock;
+
+        tasks[task_count].change_subs = change_subs;
+        tasks[task_count].change_sub = &change_subs->subs[i];
+        tasks[task_count].diff = diff;
+        tasks[task_count].event = multi_sub_shm->event;
+        tasks[task_count].request_id = multi_sub_shm->request_id;
+        ++task_count;
     }
 
-    change_sub = &change_subs->subs[i];
+    /* SUB READ UNLOCK */
+    sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
 
-    /* remap SHM */
-    if ((err_info = sr_shm_remap(&change_subs->sub_shm, 0))) {
-        goto cleanup_rdunlock;
+    /* every task needs its own callback session, the first one is used by the caller */
+    if ((err_info = sr_subs_cb_sess_get(subscription, task_count + 1, &cb_sess))) {
+        goto cleanup;
+    }
+    for (i = 0; i < task_count; ++i) {
+        tasks[i].cb_sess = cb_sess[i + 1];
     }
-    multi_sub_shm = (sr_multi_sub_shm_t *)change_subs->sub_shm.addr;
 
-    /* parse event diff */
-    diff = lyd_parse_mem(conn->ly_ctx, change_subs->sub_shm.addr + sizeof *multi_sub_shm, LYD_LYB, LYD_OPT_EDIT | LYD_OPT_STRICT);
-    SR_CHECK_INT_GOTO(!diff, err_info, cleanup_rdunlock);
+    /* call all the callbacks */
+    sr_workers_run(subscription->workers, sr_shmsub_change_listen_task, tasks, task_count);
 
-    /* process event */
-    SR_LOG_INF("Processing \"%s\" \"%s\" event with ID %u priority %u (remaining %u subscribers).", change_subs->module_name,
-            sr_ev2str(multi_sub_shm->event), multi_sub_shm->request_id, multi_sub_shm->priority, multi_sub_shm->subscriber_count);
-    event = multi_sub_shm->event;
-    request_id = multi_sub_shm->request_id;
+    /* SUB READ LOCK */
+    if ((err_info = sr_rwlock(&multi_sub_shm->lock, SR_MAIN_LOCK_TIMEOUT * 1000, SR_LOCK_READ, __func__))) {
+        goto cleanup;
+    }
+    assert(!task_count || (tasks[0].request_id == multi_sub_shm->request_id));
 
-    /* process individual subscriptions (starting at the last found subscription, it was valid) */
-    valid_subscr_count = 0;
-    goto process_event;
-    for (; i < change_subs->sub_count; ++i) {
-        change_sub = &change_subs->subs[i];
-        if (!sr_shmsub_change_listen_is_new_event(multi_sub_shm, change_sub)) {
-            continue;
+    for (i = 0; i < task_count; ++i) {
+        if (tasks[i].err_info) {
+            sr_errinfo_merge(&err_info, tasks[i].err_info);
+            tasks[i].err_info = NULL;
         }
-
-process_event:
+    }
+    if (err_info) {
         /* SUB READ UNLOCK */
         sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
-
+        goto cleanup;
+    }
+
+    /* evaluate the results in the subscription order */
+    for (i = 0; i < task_count; ++i) {
+        change_sub = tasks[i].change_sub;
+
+        if (tasks[i].event == SR_SUB_EV_CHANGE) {
+            if (tasks[i].ret == SR_ERR_CALLBACK_SHELVE) {
+                /* this subscription did not process the event yet, skip it */
+                SR_LOG_INF("Shelved processing \"%s\" event with ID %u priority %u.", sr_ev2str(multi_sub_shm->event),
+                        multi_sub_shm->request_id, multi_sub_shm->priority);
+                continue;
+            } else if (tasks[i].ret != SR_ERR_OK) {
+                if (*err_code == SR_ERR_OK) {
+                    /* whole event failed */
+                    *err_code = tasks[i].ret;
+                    tmp_sess->err_info = tasks[i].cb_sess->err_info;
+                    tasks[i].cb_sess->err_info = NULL;
+                }
+
+                /* remember request ID and "abort" event so that we do not process it */
+                change_sub->request_id = multi_sub_shm->request_id;
+                change_sub->event = SR_SUB_EV_ABORT;
+                continue;
+            }
+        }
+
+        /* subscription processed this event */
+        ++(*valid_subscr_count);
+
+        /* remember request ID and event so that we do not process it again */
+        change_sub->request_id = multi_sub_shm->request_id;
+        change_sub->event = multi_sub_shm->event;
+    }
+
+cleanup:
+    free(tasks);
+    return err_info;
+}
+
+sr_error_info_t *
+sr_shmsub_change_listen_process_module_events(struct modsub_change_s *change_subs, sr_subscription_ctx_t *subscription)
+{
+    sr_error_info_t *err_info = NULL;
+    uint32_t i, data_len = 0, valid_subscr_count, request_id;
+    char *data = NULL;
+    int ret;
+    struct lyd_node *diff = NULL;
+    sr_error_t err_code = SR_ERR_OK;
+    struct modsub_changesub_s *change_sub;
+    sr_multi_sub_shm_t *multi_sub_shm;
+    sr_conn_ctx_t *conn = subscription->conn;
+    sr_session_ctx_t **cb_sess, *tmp_sess;
+    sr_sub_event_t event;
+
+    /* get reused callback session */
+    if ((err_info = sr_subs_cb_sess_get(subscription, 1, &cb_sess))) {
+        return err_info;
+    }
+    tmp_sess = cb_sess[0];
+
+    multi_sub_shm = (sr_multi_sub_shm_t *)change_subs->sub_shm.addr;
+
+    /* SUB READ LOCK */
+    if ((err_info = sr_rwlock(&multi_sub_shm->lock, SR_MAIN_LOCK_TIMEOUT * 1000, SR_LOCK_READ, __func__))) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < change_subs->sub_count; ++i) {
+        if (sr_shmsub_change_listen_is_new_event(multi_sub_shm, &change_subs->subs[i])) {
+            break;
+        }
+    }
+    /* no new module event */
+    if (i == change_subs->sub_count) {
+        goto cleanup_rdunlock;
+    }
+
+    change_sub = &change_subs->subs[i];
+
+    /* remap SHM */
+    if ((err_info = sr_shm_remap(&change_subs->sub_shm, 0))) {
+        goto cleanup_rdunlock;
+    }
+    multi_sub_shm = (sr_multi_sub_shm_t *)change_subs->sub_shm.addr;
+
+    /* parse event diff */
+    diff = lyd_parse_mem(conn->ly_ctx, change_subs->sub_shm.addr + sizeof *multi_sub_shm, LYD_LYB, LYD_OPT_EDIT | LYD_OPT_STRICT);
+    SR_CHECK_INT_GOTO(!diff, err_info, cleanup_rdunlock);
+
+    /* process event */
+    SR_LOG_INF("Processing \"%s\" \"%s\" event with ID %u priority %u (remaining %u subscribers).", change_subs->module_name,
+            sr_ev2str(multi_sub_shm->event), multi_sub_shm->request_id, multi_sub_shm->priority, multi_sub_shm->subscriber_count);
+    event = multi_sub_shm->event;
+    request_id = multi_sub_shm->request_id;
+
+    valid_subscr_count = 0;
+    if (subscription->workers && (event != SR_SUB_EV_UPDATE)) {
+        /* process all the subscriptions in parallel, "update" callbacks share the edit so they never are */
+        if ((err_info = sr_shmsub_change_listen_process_parallel(change_subs, i, subscription, diff,
+                &valid_subscr_count, &err_code, tmp_sess))) {
+            goto cleanup;
+        }
+        goto event_processed;
+    }
+
+    /* process individual subscriptions (starting at the last found subscription, it was valid) */
+    goto process_event;
+    for (; i < change_subs->sub_count; ++i) {
+        change_sub = &change_subs->subs[i];
+        if (!sr_shmsub_change_listen_is_new_event(multi_sub_shm, change_sub)) {
+            continue;
+        }
+
+process_event:
+        /* SUB READ UNLOCK */
+        sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
+
         /* prepare callback session */
-        if ((err_info = sr_shmsub_change_listen_prepare_sess(change_subs, change_sub, conn, diff, &tmp_sess))) {
+        if ((err_info = sr_shmsub_change_listen_prepare_sess(change_subs, change_sub, diff, tmp_sess))) {
             goto cleanup;
         }
 
         ret = 0;
         /* whole diff may have been filtered out */
-        if (tmp_sess.dt[tmp_sess.ds].diff) {
-            ret = change_sub->cb(&tmp_sess, change_subs->module_name, change_sub->xpath, sr_ev2api(event), request_id,
+        if (tmp_sess->dt[tmp_sess->ds].diff) {
+            ret = change_sub->cb(tmp_sess, change_subs->module_name, change_sub->xpath, sr_ev2api(event), request_id,
                     change_sub->private_data);
         }
 
@@ -1945,6 +2350,7 @@ process_event:
         change_sub->event = multi_sub_shm->event;
     }
 
+event_processed:
     /*
      * prepare additional event data written into subscription SHM (after the structure)
      */
@@ -1952,7 +2358,7 @@ process_event:
     case SR_SUB_EV_UPDATE:
         if (err_code == SR_ERR_OK) {
             /* we may have an updated edit (empty is fine), print it into LYB */
-            if (lyd_print_mem(&data, tmp_sess.dt[change_subs->ds].edit, LYD_LYB, LYP_WITHSIBLINGS)) {
+            if (lyd_print_mem(&data, tmp_sess->dt[change_subs->ds].edit, LYD_LYB, LYP_WITHSIBLINGS)) {
                 sr_errinfo_new_ly(&err_info, conn->ly_ctx);
                 goto cleanup_rdunlock;
             }
@@ -1962,7 +2368,7 @@ process_event:
     case SR_SUB_EV_CHANGE:
         if (err_code != SR_ERR_OK) {
             /* prepare error from session to be written to SHM */
-            if ((err_info = sr_shmsub_prepare_error(err_code, &tmp_sess, &data, &data_len))) {
+            if ((err_info = sr_shmsub_prepare_error(err_code, tmp_sess, &data, &data_len))) {
                 goto cleanup_rdunlock;
             }
         }
@@ -1973,7 +2379,7 @@ process_event:
 
     if (data_len) {
         /* remap SHM having the lock */
-        if ((err_info = sr_shm_remap(&change_subs->sub_shm, sizeof *multi_sub_shm + data_len))) {
+        if ((err_info = sr_shm_remap_hwm(&change_subs->sub_shm, sizeof *multi_sub_shm + data_len))) {
             goto cleanup_rdunlock;
         }
         multi_sub_shm = (sr_multi_sub_shm_t *)change_subs->sub_shm.addr;
@@ -2000,9 +2406,7 @@ cleanup_rdunlock:
     sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
 
 cleanup:
-    /* clear callback session */
-    sr_clear_sess(&tmp_sess);
-
+    /* the callback session is reset on its next use */
     lyd_free_withsiblings(diff);
     free(data);
     return err_info;
@@ -2053,7 +2457,7 @@ sr_shmsub_listen_write_event(sr_sub_shm_t *sub_shm, const char *data, uint32_t d
 }
 
 sr_error_info_t *
-sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs, sr_conn_ctx_t *conn)
+sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs, sr_subscription_ctx_t *subscription)
 {
     sr_error_info_t *err_info = NULL;
     uint32_t i, data_len = 0, request_id;
@@ -2063,12 +2467,16 @@ sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs, sr_
     struct modsub_opersub_s *oper_sub;
     struct lyd_node *parent = NULL, *orig_parent, *node;
     sr_sub_shm_t *sub_shm;
-    sr_session_ctx_t tmp_sess;
+    sr_conn_ctx_t *conn = subscription->conn;
+    sr_session_ctx_t **cb_sess, *tmp_sess;
 
-    memset(&tmp_sess, 0, sizeof tmp_sess);
-    tmp_sess.conn = conn;
-    tmp_sess.ds = SR_DS_OPERATIONAL;
-    tmp_sess.ev = SR_SUB_EV_CHANGE;
+    /* get reused callback session */
+    if ((err_info = sr_subs_cb_sess_get(subscription, 1, &cb_sess))) {
+        return err_info;
+    }
+    tmp_sess = cb_sess[0];
+    tmp_sess->ds = SR_DS_OPERATIONAL;
+    tmp_sess->ev = SR_SUB_EV_CHANGE;
 
     for (i = 0; (err_code == SR_ERR_OK) && (i < oper_subs->sub_count); ++i) {
         oper_sub = &oper_subs->subs[i];
@@ -2088,7 +2496,7 @@ sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs, sr_
         request_id = sub_shm->request_id;
 
         /* read SID */
-        tmp_sess.sid = sub_shm->sid;
+        tmp_sess->sid = sub_shm->sid;
 
         /* remap SHM */
         if ((err_info = sr_shm_remap(&oper_sub->sub_shm, 0))) {
@@ -2118,7 +2526,7 @@ sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs, sr_
 
         /* call callback */
         orig_parent = parent;
-        err_code = oper_sub->cb(&tmp_sess, oper_subs->module_name, oper_sub->xpath, request_xpath[0] ? request_xpath : NULL,
+        err_code = oper_sub->cb(tmp_sess, oper_subs->module_name, oper_sub->xpath, request_xpath[0] ? request_xpath : NULL,
                 request_id, &parent, oper_sub->private_data);
 
         /* go again to the top-level root for printing */
@@ -2156,22 +2564,23 @@ sr_shmsub_oper_listen_process_module_events(struct modsub_oper_s *oper_subs, sr_
          * prepare additional event data written into subscription SHM (after the structure)
          */
         if (err_code != SR_ERR_OK) {
-            if ((err_info = sr_shmsub_prepare_error(err_code, &tmp_sess, &data, &data_len))) {
+            if ((err_info = sr_shmsub_prepare_error(err_code, tmp_sess, &data, &data_len))) {
                 goto error_wrunlock;
             }
-        } else {
-            if (lyd_print_mem(&data, parent, LYD_LYB, LYP_WITHSIBLINGS)) {
-                sr_errinfo_new_ly(&err_info, conn->ly_ctx);
+
+            /* remap SHM having the lock */
+            if ((err_info = sr_shm_remap_hwm(&oper_sub->sub_shm, sizeof *sub_shm + data_len))) {
+                goto error_wrunlock;
+            }
+            sub_shm = (sr_sub_shm_t *)oper_sub->sub_shm.addr;
+        } else if (sub_shm->event == SR_SUB_EV_OPER) {
+            /* print the data directly into SHM, only if the event is still valid */
+            err_info = sr_shmsub_print_lyb(&oper_sub->sub_shm, sizeof *sub_shm, parent, LYP_WITHSIBLINGS, conn->ly_ctx);
+            sub_shm = (sr_sub_shm_t *)oper_sub->sub_shm.addr;
+            if (err_info) {
                 goto error_wrunlock;
             }
-            data_len = lyd_lyb_data_length(data);
-        }
-
-        /* remap SHM having the lock */
-        if ((err_info = sr_shm_remap(&oper_sub->sub_shm, sizeof *sub_shm + data_len))) {
-            goto error_wrunlock;
         }
-        sub_shm = (sr_sub_shm_t *)oper_sub->sub_shm.addr;
 
         /* finish event */
         if ((err_info = sr_shmsub_listen_write_event(sub_shm, data, data_len, err_code))) {
@@ -2192,7 +2601,6 @@ next_iter:
     }
 
     /* success */
-    sr_clear_sess(&tmp_sess);
     return NULL;
 
 error_wrunlock:
@@ -2204,7 +2612,6 @@ error_rdunlock:
     /* SUB READ UNLOCK */
     sr_rwunlock(&sub_shm->lock, SR_LOCK_READ, __func__);
 error:
-    sr_clear_sess(&tmp_sess);
     free(data);
     lyd_free_withsiblings(parent);
     free(request_xpath);
@@ -2336,7 +2743,7 @@ cleanup:
 }
 
 static int
-sr_shmsub_rpc_listen_is_new_event(sr_multi_sub_shm_t *multi_sub_shm, struct opsub_rpcsub_s *sub)
+sr_shmsub_rpc_listen_is_new_event(sr_multi_sub_shm_t *multi_sub_shm, struct opsub_rpcsub_s *sub, uint32_t slot)
 {
     /* not a listener event */
     if (!SR_IS_LISTEN_EVENT(multi_sub_shm->event)) {
@@ -2344,11 +2751,11 @@ sr_shmsub_rpc_listen_is_new_event(sr_multi_sub_shm_t *multi_sub_shm, struct opsu
     }
 
     /* new event and request ID */
-    if ((multi_sub_shm->request_id == sub->request_id) && (multi_sub_shm->event == sub->event)) {
+    if ((multi_sub_shm->request_id == sub->request_id[slot]) && (multi_sub_shm->event == sub->event[slot])) {
         return 0;
     }
-    if ((multi_sub_shm->event == SR_SUB_EV_ABORT) && ((sub->event != SR_SUB_EV_RPC)
-            || (sub->request_id != multi_sub_shm->request_id))) {
+    if ((multi_sub_shm->event == SR_SUB_EV_ABORT) && ((sub->event[slot] != SR_SUB_EV_RPC)
+            || (sub->request_id[slot] != multi_sub_shm->request_id))) {
         /* process "abort" only on subscriptions that have successfully processed "RPC" */
         return 0;
     }
@@ -2361,8 +2768,16 @@ sr_shmsub_rpc_listen_is_new_event(sr_multi_sub_shm_t *multi_sub_shm, struct opsu
     return 1;
 }
 
-sr_error_info_t *
-sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs, sr_conn_ctx_t *conn)
+/**
+ * @brief Process an RPC/action event in one request slot, if any.
+ *
+ * @param[in] rpc_subs RPC/action subscriptions.
+ * @param[in] slot Request slot.
+ * @param[in] subscription Subscription structure with the callback sessions.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmsub_rpc_listen_process_slot(struct opsub_rpc_s *rpc_subs, uint32_t slot, sr_subscription_ctx_t *subscription)
 {
     sr_error_info_t *err_info = NULL;
     uint32_t i, data_len = 0, valid_subscr_count, request_id;
@@ -2371,15 +2786,19 @@ sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs, sr_conn_ct
     sr_error_t err_code = SR_ERR_OK, ret;
     struct opsub_rpcsub_s *rpc_sub;
     sr_multi_sub_shm_t *multi_sub_shm;
-    sr_session_ctx_t tmp_sess;
+    sr_conn_ctx_t *conn = subscription->conn;
+    sr_session_ctx_t **cb_sess, *tmp_sess;
     sr_sub_event_t event;
 
-    memset(&tmp_sess, 0, sizeof tmp_sess);
-    tmp_sess.conn = conn;
-    tmp_sess.ds = SR_DS_OPERATIONAL;
-    tmp_sess.ev = SR_SUB_EV_RPC;
+    /* get reused callback session */
+    if ((err_info = sr_subs_cb_sess_get(subscription, 1, &cb_sess))) {
+        return err_info;
+    }
+    tmp_sess = cb_sess[0];
+    tmp_sess->ds = SR_DS_OPERATIONAL;
+    tmp_sess->ev = SR_SUB_EV_RPC;
 
-    multi_sub_shm = (sr_multi_sub_shm_t *)rpc_subs->sub_shm.addr;
+    multi_sub_shm = (sr_multi_sub_shm_t *)rpc_subs->sub_shm[slot].addr;
 
     /* SUB READ LOCK */
     if ((err_info = sr_rwlock(&multi_sub_shm->lock, SR_MAIN_LOCK_TIMEOUT * 1000, SR_LOCK_READ, __func__))) {
@@ -2387,19 +2806,19 @@ sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs, sr_conn_ct
     }
 
     /* remap SHM */
-    if ((err_info = sr_shm_remap(&rpc_subs->sub_shm, 0))) {
+    if ((err_info = sr_shm_remap(&rpc_subs->sub_shm[slot], 0))) {
         goto cleanup_rdunlock;
     }
-    multi_sub_shm = (sr_multi_sub_shm_t *)rpc_subs->sub_shm.addr;
+    multi_sub_shm = (sr_multi_sub_shm_t *)rpc_subs->sub_shm[slot].addr;
 
     for (i = 0; i < rpc_subs->sub_count; ++i) {
         rpc_sub = &rpc_subs->subs[i];
-        if (sr_shmsub_rpc_listen_is_new_event(multi_sub_shm, rpc_sub)) {
+        if (sr_shmsub_rpc_listen_is_new_event(multi_sub_shm, rpc_sub, slot)) {
             /* there is a new event so there is some operation that can be parsed */
             if (!input) {
                 ly_errno = 0;
                 /* parse RPC/action input */
-                input = lyd_parse_mem(conn->ly_ctx, rpc_subs->sub_shm.addr + sizeof *multi_sub_shm, LYD_LYB,
+                input = lyd_parse_mem(conn->ly_ctx, rpc_subs->sub_shm[slot].addr + sizeof *multi_sub_shm, LYD_LYB,
                         LYD_OPT_RPC | LYD_OPT_NOEXTDEPS | LYD_OPT_STRICT, NULL);
                 if (ly_errno) {
                     sr_errinfo_new_ly(&err_info, conn->ly_ctx);
@@ -2420,7 +2839,7 @@ sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs, sr_conn_ct
     }
 
     /* read SID */
-    tmp_sess.sid = multi_sub_shm->sid;
+    tmp_sess->sid = multi_sub_shm->sid;
 
     /* go to the operation, not the root */
     input_op = input;
@@ -2439,7 +2858,8 @@ sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs, sr_conn_ct
     goto process_event;
     for (; i < rpc_subs->sub_count; ++i) {
         rpc_sub = &rpc_subs->subs[i];
-        if (!sr_shmsub_rpc_listen_is_new_event(multi_sub_shm, rpc_sub) || !sr_shmsub_rpc_is_valid(input, rpc_sub->xpath)) {
+        if (!sr_shmsub_rpc_listen_is_new_event(multi_sub_shm, rpc_sub, slot)
+                || !sr_shmsub_rpc_is_valid(input, rpc_sub->xpath)) {
             continue;
         }
 
@@ -2451,7 +2871,7 @@ process_event:
         lyd_free_withsiblings(output);
 
         /* call callback */
-        if ((err_info = sr_shmsub_rpc_listen_call_callback(rpc_sub, &tmp_sess, input_op, event, request_id, &output, &ret))) {
+        if ((err_info = sr_shmsub_rpc_listen_call_callback(rpc_sub, tmp_sess, input_op, event, request_id, &output, &ret))) {
             goto cleanup;
         }
 
@@ -2472,8 +2892,8 @@ process_event:
                 err_code = ret;
 
                 /* remember request ID and "abort" event so that we do not process it */
-                rpc_sub->request_id = multi_sub_shm->request_id;
-                rpc_sub->event = SR_SUB_EV_ABORT;
+                rpc_sub->request_id[slot] = multi_sub_shm->request_id;
+                rpc_sub->event[slot] = SR_SUB_EV_ABORT;
                 break;
             }
         }
@@ -2482,31 +2902,23 @@ process_event:
         ++valid_subscr_count;
 
         /* remember request ID and event so that we do not process it again */
-        rpc_sub->request_id = multi_sub_shm->request_id;
-        rpc_sub->event = multi_sub_shm->event;
+        rpc_sub->request_id[slot] = multi_sub_shm->request_id;
+        rpc_sub->event[slot] = multi_sub_shm->event;
     }
 
     /*
      * prepare additional event data written into subscription SHM (after the structure)
      */
     if (err_code != SR_ERR_OK) {
-        if ((err_info = sr_shmsub_prepare_error(err_code, &tmp_sess, &data, &data_len))) {
-            goto cleanup_rdunlock;
-        }
-    } else {
-        if (lyd_print_mem(&data, output, LYD_LYB, 0)) {
-            sr_errinfo_new_ly(&err_info, conn->ly_ctx);
+        if ((err_info = sr_shmsub_prepare_error(err_code, tmp_sess, &data, &data_len))) {
             goto cleanup_rdunlock;
         }
-        data_len = lyd_lyb_data_length(data);
-    }
 
-    if (data_len) {
         /* remap SHM having the lock */
-        if ((err_info = sr_shm_remap(&rpc_subs->sub_shm, sizeof *multi_sub_shm + data_len))) {
+        if ((err_info = sr_shm_remap_hwm(&rpc_subs->sub_shm[slot], sizeof *multi_sub_shm + data_len))) {
             goto cleanup_rdunlock;
         }
-        multi_sub_shm = (sr_multi_sub_shm_t *)rpc_subs->sub_shm.addr;
+        multi_sub_shm = (sr_multi_sub_shm_t *)rpc_subs->sub_shm[slot].addr;
     }
 
     /* SUB READ UNLOCK */
@@ -2517,6 +2929,17 @@ process_event:
         goto cleanup;
     }
 
+    if ((err_code == SR_ERR_OK) && (multi_sub_shm->event == SR_SUB_EV_RPC)) {
+        /* print the output directly into SHM, only if the event is still valid */
+        err_info = sr_shmsub_print_lyb(&rpc_subs->sub_shm[slot], sizeof *multi_sub_shm, output, 0, conn->ly_ctx);
+        multi_sub_shm = (sr_multi_sub_shm_t *)rpc_subs->sub_shm[slot].addr;
+        if (err_info) {
+            /* SUB WRITE UNLOCK */
+            sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_WRITE, __func__);
+            goto cleanup;
+        }
+    }
+
     /* finish event */
     err_info = sr_shmsub_multi_listen_write_event(multi_sub_shm, valid_subscr_count, data, data_len, err_code);
 
@@ -2530,25 +2953,39 @@ cleanup_rdunlock:
     sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
 
 cleanup:
-    /* clear callback session */
-    sr_clear_sess(&tmp_sess);
-
+    /* the callback session is reset on its next use */
     free(data);
     lyd_free_withsiblings(input);
     lyd_free_withsiblings(output);
     return err_info;
 }
 
+sr_error_info_t *
+sr_shmsub_rpc_listen_process_rpc_events(struct opsub_rpc_s *rpc_subs, sr_subscription_ctx_t *subscription)
+{
+    sr_error_info_t *err_info = NULL;
+    uint32_t slot;
+
+    for (slot = 0; slot < SR_RPC_SLOT_COUNT; ++slot) {
+        if ((err_info = sr_shmsub_rpc_listen_process_slot(rpc_subs, slot, subscription))) {
+            return err_info;
+        }
+    }
+
+    return NULL;
+}
+
 sr_error_info_t *
 sr_shmsub_notif_listen_process_module_events(struct modsub_notif_s *notif_subs, sr_conn_ctx_t *conn)
 {
     sr_error_info_t *err_info = NULL;
-    uint32_t i;
-    struct lyd_node *notif = NULL, *notif_op;
+    uint32_t i, j, notif_count = 0;
+    struct lyd_node **notifs = NULL, *notif_op;
     struct ly_set *set;
     time_t notif_ts;
     sr_multi_sub_shm_t *multi_sub_shm;
     sr_sid_t sid;
+    char *ptr;
 
     multi_sub_shm = (sr_multi_sub_shm_t *)notif_subs->sub_shm.addr;
 
@@ -2568,14 +3005,22 @@ sr_shmsub_notif_listen_process_module_events(struct modsub_notif_s *notif_subs,
     }
     multi_sub_shm = (sr_multi_sub_shm_t *)notif_subs->sub_shm.addr;
 
-    /* parse timestamp */
-    notif_ts = *(time_t *)(notif_subs->sub_shm.addr + sizeof *multi_sub_shm);
-
-    /* parse notification */
-    ly_errno = 0;
-    notif = lyd_parse_mem(conn->ly_ctx, notif_subs->sub_shm.addr + sizeof *multi_sub_shm + sizeof notif_ts, LYD_LYB,
-            LYD_OPT_NOTIF | LYD_OPT_NOEXTDEPS | LYD_OPT_STRICT, NULL);
-    SR_CHECK_INT_GOTO(ly_errno, err_info, cleanup_rdunlock);
+    /* parse timestamp and notification count */
+    ptr = notif_subs->sub_shm.addr + sizeof *multi_sub_shm;
+    notif_ts = *(time_t *)ptr;
+    ptr += sizeof notif_ts;
+    notif_count = *(uint32_t *)ptr;
+    ptr += sizeof notif_count;
+
+    /* parse all the notifications */
+    notifs = calloc(notif_count, sizeof *notifs);
+    SR_CHECK_MEM_GOTO(notif_count && !notifs, err_info, cleanup_rdunlock);
+    for (i = 0; i < notif_count; ++i) {
+        ly_errno = 0;
+        notifs[i] = lyd_parse_mem(conn->ly_ctx, ptr, LYD_LYB, LYD_OPT_NOTIF | LYD_OPT_NOEXTDEPS | LYD_OPT_STRICT, NULL);
+        SR_CHECK_INT_GOTO(ly_errno, err_info, cleanup_rdunlock);
+        ptr += lyd_lyb_data_length(ptr);
+    }
 
     /* remember request ID so that we do not process it again */
     notif_subs->request_id = multi_sub_shm->request_id;
@@ -2586,7 +3031,8 @@ sr_shmsub_notif_listen_process_module_events(struct modsub_notif_s *notif_subs,
     /* SUB READ UNLOCK */
     sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
 
-    SR_LOG_INF("Processing \"notif\" \"%s\" event with ID %u.", notif_subs->module_name, multi_sub_shm->request_id);
+    SR_LOG_INF("Processing \"notif\" \"%s\" event with ID %u (%u notifications).", notif_subs->module_name,
+            multi_sub_shm->request_id, notif_count);
 
     /* SUB WRITE LOCK */
     if ((err_info = sr_rwlock(&multi_sub_shm->lock, SR_MAIN_LOCK_TIMEOUT * 1000, SR_LOCK_WRITE, __func__))) {
@@ -2603,27 +3049,29 @@ sr_shmsub_notif_listen_process_module_events(struct modsub_notif_s *notif_subs,
         goto cleanup;
     }
 
-    /* go to the operation, not the root */
-    notif_op = notif;
-    if ((err_info = sr_ly_find_last_parent(&notif_op, LYS_NOTIF))) {
-        goto cleanup;
-    }
+    for (j = 0; j < notif_count; ++j) {
+        /* go to the operation, not the root */
+        notif_op = notifs[j];
+        if ((err_info = sr_ly_find_last_parent(&notif_op, LYS_NOTIF))) {
+            goto cleanup;
+        }
 
-    /* call callbacks if xpath filter matches */
-    for (i = 0; i < notif_subs->sub_count; ++i) {
-        if (notif_subs->subs[i].xpath) {
-            set = lyd_find_path(notif_op, notif_subs->subs[i].xpath);
-            SR_CHECK_INT_GOTO(!set, err_info, cleanup);
-            if (!set->number) {
+        /* call callbacks if xpath filter matches */
+        for (i = 0; i < notif_subs->sub_count; ++i) {
+            if (notif_subs->subs[i].xpath) {
+                set = lyd_find_path(notif_op, notif_subs->subs[i].xpath);
+                SR_CHECK_INT_GOTO(!set, err_info, cleanup);
+                if (!set->number) {
+                    ly_set_free(set);
+                    continue;
+                }
                 ly_set_free(set);
-                continue;
             }
-            ly_set_free(set);
-        }
 
-        if ((err_info = sr_notif_call_callback(conn, notif_subs->subs[i].cb, notif_subs->subs[i].tree_cb,
-                notif_subs->subs[i].private_data, SR_EV_NOTIF_REALTIME, notif_op, notif_ts, sid))) {
-            goto cleanup;
+            if ((err_info = sr_notif_call_callback(conn, notif_subs->subs[i].cb, notif_subs->subs[i].tree_cb,
+                    notif_subs->subs[i].private_data, SR_EV_NOTIF_REALTIME, notif_op, notif_ts, sid))) {
+                goto cleanup;
+            }
         }
     }
 
@@ -2634,7 +3082,12 @@ cleanup_rdunlock:
     /* SUB READ UNLOCK */
     sr_rwunlock(&multi_sub_shm->lock, SR_LOCK_READ, __func__);
 cleanup:
-    lyd_free_withsiblings(notif);
+    if (notifs) {
+        for (i = 0; i < notif_count; ++i) {
+            lyd_free_withsiblings(notifs[i]);
+        }
+        free(notifs);
+    }
     return err_info;
 }
 
@@ -2852,3 +3305,464 @@ error:
     pthread_detach(pthread_self());
     return NULL;
 }
+
+/**
+ * @brief Process-wide dispatcher handling events of many subscriptions by a pool of threads. When all
+ * the threads are processing some subscription (their callbacks may be waiting for other subscriptions),
+ * a new thread is added and the extra threads exit once they are no longer needed.
+ */
+static struct sr_dispatcher_s {
+    pthread_mutex_t lock;       /**< Lock for accessing all the members below. */
+    pthread_cond_t cond;        /**< Condition signalled when a subscription processing finishes. */
+    int epoll_fd;               /**< Epoll instance with all the event pipes, -1 if the dispatcher is not running. */
+    int quit_pipe[2];           /**< Pipe written to when the dispatcher threads are supposed to quit. */
+    ATOMIC_T quit;              /**< Flag whether the dispatcher threads are supposed to quit. */
+    pthread_t *tids;            /**< Dispatcher thread IDs. */
+    uint32_t thread_count;      /**< Dispatcher thread count. */
+    uint32_t base_thread_count; /**< Dispatcher thread count requested on start, the pool never shrinks below it. */
+    uint32_t idle_count;        /**< Number of threads not processing any subscription. */
+
+    struct sr_dispatcher_sub_s {
+        sr_subscription_ctx_t *subs;    /**< Dispatched subscription. */
+        uint32_t id;            /**< Unique ID of the dispatched subscription, used in epoll events. */
+        pthread_t tid;          /**< Thread currently processing the subscription. */
+        int busy;               /**< Whether the subscription is being processed. */
+        int pending;            /**< Whether a new event arrived while the subscription was being processed. */
+        time_t stop_time;       /**< Time when the subscription needs processing even without an event, 0 if never. */
+    } *subs;                    /**< Dispatched subscriptions. */
+    uint32_t sub_count;         /**< Dispatched subscription count. */
+    uint32_t last_id;           /**< Last used subscription ID, 0 is the quit pipe. */
+} sr_disp = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, -1, {-1, -1}, 0, NULL, 0, 0, 0, NULL, 0, 0};
+
+/**
+ * @brief Find a dispatched subscription. Dispatcher lock is expected to be held.
+ *
+ * @param[in] id Dispatched subscription ID.
+ * @return Dispatched subscription, NULL if not found.
+ */
+static struct sr_dispatcher_sub_s *
+sr_shmsub_dispatch_find(uint32_t id)
+{
+    uint32_t i;
+
+    for (i = 0; i < sr_disp.sub_count; ++i) {
+        if (sr_disp.subs[i].id == id) {
+            return &sr_disp.subs[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Learn how long to wait for events until a stop time of some subscription elapses.
+ * Dispatcher lock is expected to be held.
+ *
+ * @return Timeout in ms, -1 for infinite.
+ */
+static int
+sr_shmsub_dispatch_timeout(void)
+{
+    time_t cur_time, min_stop_time = 0;
+    uint32_t i;
+
+    for (i = 0; i < sr_disp.sub_count; ++i) {
+        if (sr_disp.subs[i].stop_time && (!min_stop_time || (sr_disp.subs[i].stop_time < min_stop_time))) {
+            min_stop_time = sr_disp.subs[i].stop_time;
+        }
+    }
+    if (!min_stop_time) {
+        return -1;
+    }
+
+    cur_time = time(NULL);
+    return (min_stop_time > cur_time) ? (min_stop_time - cur_time) * 1000 : 0;
+}
+
+static void *sr_shmsub_dispatch_thread(void *arg);
+
+/**
+ * @brief Add a new dispatcher thread. Dispatcher lock is expected to be held.
+ *
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_shmsub_dispatch_thread_add(void)
+{
+    sr_error_info_t *err_info = NULL;
+    pthread_t *mem;
+    int ret;
+
+    mem = realloc(sr_disp.tids, (sr_disp.thread_count + 1) * sizeof *sr_disp.tids);
+    SR_CHECK_MEM_RET(!mem, err_info);
+    sr_disp.tids = mem;
+
+    ret = pthread_create(&sr_disp.tids[sr_disp.thread_count], NULL, sr_shmsub_dispatch_thread, NULL);
+    if (ret) {
+        sr_errinfo_new(&err_info, SR_ERR_INTERNAL, NULL, "Creating a new thread failed (%s).", strerror(ret));
+        return err_info;
+    }
+    ++sr_disp.thread_count;
+    ++sr_disp.idle_count;
+
+    return NULL;
+}
+
+/**
+ * @brief Dispatcher thread processing events of any dispatched subscription.
+ *
+ * @param[in] arg Unused.
+ * @return Always NULL.
+ */
+static void *
+sr_shmsub_dispatch_thread(void *arg)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_dispatcher_sub_s *disp_sub;
+    struct epoll_event ev;
+    sr_subscription_ctx_t *subs;
+    uint32_t i, id;
+    time_t cur_time, stop_time_in;
+    int ret, timeout, rearm;
+
+    (void)arg;
+
+    while (!ATOMIC_LOAD_RELAXED(sr_disp.quit)) {
+        /* DISPATCHER LOCK */
+        pthread_mutex_lock(&sr_disp.lock);
+        timeout = sr_shmsub_dispatch_timeout();
+        /* DISPATCHER UNLOCK */
+        pthread_mutex_unlock(&sr_disp.lock);
+
+        /* wait for a new event or until a stop time is elapsed */
+        ret = epoll_wait(sr_disp.epoll_fd, &ev, 1, timeout);
+        if ((ret == -1) && (errno != EINTR)) {
+            SR_ERRINFO_SYSERRNO(&err_info, "epoll_wait");
+            sr_errinfo_free(&err_info);
+            break;
+        } else if (ATOMIC_LOAD_RELAXED(sr_disp.quit)) {
+            break;
+        } else if (ret == -1) {
+            /* signal received, retry */
+            continue;
+        }
+
+        /* DISPATCHER LOCK */
+        pthread_mutex_lock(&sr_disp.lock);
+
+        disp_sub = NULL;
+        if (ret) {
+            /* event, the subscription could have been removed in the meantime */
+            rearm = 1;
+            disp_sub = sr_shmsub_dispatch_find(ev.data.u32);
+            if (disp_sub && disp_sub->busy) {
+                /* it is being processed because of its stop time, let the thread process it again */
+                disp_sub->pending = 1;
+                disp_sub = NULL;
+            }
+        } else {
+            /* timeout, find a subscription with an elapsed stop time */
+            rearm = 0;
+            cur_time = time(NULL);
+            for (i = 0; i < sr_disp.sub_count; ++i) {
+                if (!sr_disp.subs[i].busy && sr_disp.subs[i].stop_time && (sr_disp.subs[i].stop_time <= cur_time)) {
+                    disp_sub = &sr_disp.subs[i];
+                    break;
+                }
+            }
+        }
+        if (!disp_sub) {
+            /* DISPATCHER UNLOCK */
+            pthread_mutex_unlock(&sr_disp.lock);
+            continue;
+        }
+
+        disp_sub->busy = 1;
+        disp_sub->tid = pthread_self();
+        subs = disp_sub->subs;
+        id = disp_sub->id;
+
+        if (!--sr_disp.idle_count && !ATOMIC_LOAD_RELAXED(sr_disp.quit)) {
+            /* the callbacks may wait for events of other subscriptions, there must always be a thread to process them */
+            if ((err_info = sr_shmsub_dispatch_thread_add())) {
+                sr_errinfo_free(&err_info);
+            }
+        }
+
+        do {
+            disp_sub->pending = 0;
+
+            /* DISPATCHER UNLOCK */
+            pthread_mutex_unlock(&sr_disp.lock);
+
+            /* process the new events (or subscription stop time has elapsed), errors are printed */
+            sr_process_events(subs, NULL, &stop_time_in);
+
+            /* DISPATCHER LOCK */
+            pthread_mutex_lock(&sr_disp.lock);
+
+            /* the subscription could have been removed by its own callback */
+            disp_sub = sr_shmsub_dispatch_find(id);
+            if (!disp_sub) {
+                break;
+            }
+            disp_sub->stop_time = stop_time_in ? time(NULL) + stop_time_in : 0;
+            if (disp_sub->pending) {
+                /* its event arrived meanwhile, the event pipe needs to be rearmed after processing it */
+                rearm = 1;
+            }
+        } while (disp_sub->pending);
+
+        if (disp_sub) {
+            disp_sub->busy = 0;
+            if (rearm) {
+                /* listen for the next event */
+                ev.events = EPOLLIN | EPOLLONESHOT;
+                ev.data.u32 = id;
+                if (epoll_ctl(sr_disp.epoll_fd, EPOLL_CTL_MOD, subs->evpipe, &ev) == -1) {
+                    SR_ERRINFO_SYSERRNO(&err_info, "epoll_ctl");
+                    sr_errinfo_free(&err_info);
+                }
+            }
+        }
+        pthread_cond_broadcast(&sr_disp.cond);
+
+        ++sr_disp.idle_count;
+        if ((sr_disp.thread_count > sr_disp.base_thread_count) && (sr_disp.idle_count > 1)
+                && !ATOMIC_LOAD_RELAXED(sr_disp.quit)) {
+            /* extra thread no longer needed, remove it (joining is only done on quit, which is not in progress) */
+            for (i = 0; !pthread_equal(sr_disp.tids[i], pthread_self()); ++i) {}
+            sr_disp.tids[i] = sr_disp.tids[sr_disp.thread_count - 1];
+            --sr_disp.thread_count;
+            --sr_disp.idle_count;
+            pthread_detach(pthread_self());
+
+            /* DISPATCHER UNLOCK */
+            pthread_mutex_unlock(&sr_disp.lock);
+            break;
+        }
+
+        /* DISPATCHER UNLOCK */
+        pthread_mutex_unlock(&sr_disp.lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Stop all the dispatcher threads and free its resources. Dispatcher lock is expected to be held
+ * and it is temporarily released.
+ */
+static void
+sr_shmsub_dispatch_quit(void)
+{
+    char buf[1] = {0};
+    pthread_t *tids;
+    uint32_t i, thread_count;
+
+    /* wake up all the threads, no threads are added or removed from now on */
+    ATOMIC_STORE_RELAXED(sr_disp.quit, 1);
+    if (sr_disp.quit_pipe[1] > -1) {
+        while (write(sr_disp.quit_pipe[1], buf, 1) == -1 && (errno == EINTR)) {}
+    }
+
+    /* they can still access the dispatcher so it must not be locked */
+    tids = sr_disp.tids;
+    thread_count = sr_disp.thread_count;
+    pthread_mutex_unlock(&sr_disp.lock);
+    for (i = 0; i < thread_count; ++i) {
+        pthread_join(tids[i], NULL);
+    }
+    pthread_mutex_lock(&sr_disp.lock);
+
+    free(sr_disp.tids);
+    sr_disp.tids = NULL;
+    sr_disp.thread_count = 0;
+    sr_disp.base_thread_count = 0;
+    sr_disp.idle_count = 0;
+    for (i = 0; i < 2; ++i) {
+        if (sr_disp.quit_pipe[i] > -1) {
+            close(sr_disp.quit_pipe[i]);
+            sr_disp.quit_pipe[i] = -1;
+        }
+    }
+    if (sr_disp.epoll_fd > -1) {
+        close(sr_disp.epoll_fd);
+        sr_disp.epoll_fd = -1;
+    }
+}
+
+sr_error_info_t *
+sr_shmsub_dispatch_start(uint32_t thread_count)
+{
+    sr_error_info_t *err_info = NULL;
+    struct epoll_event ev;
+    uint32_t i;
+
+    assert(thread_count);
+
+    /* DISPATCHER LOCK */
+    pthread_mutex_lock(&sr_disp.lock);
+
+    if (sr_disp.epoll_fd > -1) {
+        sr_errinfo_new(&err_info, SR_ERR_EXISTS, NULL, "Event dispatcher is already running.");
+        goto cleanup;
+    }
+
+    /* create epoll instance with the quit pipe */
+    if ((sr_disp.epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+        SR_ERRINFO_SYSERRNO(&err_info, "epoll_create1");
+        goto error;
+    }
+    if (pipe(sr_disp.quit_pipe) == -1) {
+        SR_ERRINFO_SYSERRNO(&err_info, "pipe");
+        goto error;
+    }
+    ev.events = EPOLLIN;
+    ev.data.u32 = 0;
+    if (epoll_ctl(sr_disp.epoll_fd, EPOLL_CTL_ADD, sr_disp.quit_pipe[0], &ev) == -1) {
+        SR_ERRINFO_SYSERRNO(&err_info, "epoll_ctl");
+        goto error;
+    }
+    ATOMIC_STORE_RELAXED(sr_disp.quit, 0);
+
+    /* start the threads */
+    sr_disp.base_thread_count = thread_count;
+    for (i = 0; i < thread_count; ++i) {
+        if ((err_info = sr_shmsub_dispatch_thread_add())) {
+            goto error;
+        }
+    }
+
+    goto cleanup;
+
+error:
+    sr_shmsub_dispatch_quit();
+
+cleanup:
+    /* DISPATCHER UNLOCK */
+    pthread_mutex_unlock(&sr_disp.lock);
+    return err_info;
+}
+
+sr_error_info_t *
+sr_shmsub_dispatch_stop(void)
+{
+    sr_error_info_t *err_info = NULL;
+
+    /* DISPATCHER LOCK */
+    pthread_mutex_lock(&sr_disp.lock);
+
+    if (sr_disp.epoll_fd == -1) {
+        sr_errinfo_new(&err_info, SR_ERR_NOT_FOUND, NULL, "Event dispatcher is not running.");
+    } else if (sr_disp.sub_count) {
+        sr_errinfo_new(&err_info, SR_ERR_OPERATION_FAILED, NULL, "Event dispatcher still handles %u subscriptions.",
+                sr_disp.sub_count);
+    } else {
+        sr_shmsub_dispatch_quit();
+    }
+
+    /* DISPATCHER UNLOCK */
+    pthread_mutex_unlock(&sr_disp.lock);
+    return err_info;
+}
+
+sr_error_info_t *
+sr_shmsub_dispatch_add(sr_subscription_ctx_t *subs, int *added)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_dispatcher_sub_s *disp_sub;
+    struct epoll_event ev;
+    void *mem;
+
+    *added = 0;
+
+    /* DISPATCHER LOCK */
+    pthread_mutex_lock(&sr_disp.lock);
+
+    if (sr_disp.epoll_fd == -1) {
+        /* not running */
+        goto cleanup;
+    }
+
+    mem = realloc(sr_disp.subs, (sr_disp.sub_count + 1) * sizeof *sr_disp.subs);
+    SR_CHECK_MEM_GOTO(!mem, err_info, cleanup);
+    sr_disp.subs = mem;
+
+    disp_sub = &sr_disp.subs[sr_disp.sub_count];
+    memset(disp_sub, 0, sizeof *disp_sub);
+    disp_sub->subs = subs;
+    if (!++sr_disp.last_id) {
+        /* 0 is reserved for the quit pipe */
+        ++sr_disp.last_id;
+    }
+    disp_sub->id = sr_disp.last_id;
+
+    /* listen for events on its event pipe */
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.u32 = disp_sub->id;
+    if (epoll_ctl(sr_disp.epoll_fd, EPOLL_CTL_ADD, subs->evpipe, &ev) == -1) {
+        SR_ERRINFO_SYSERRNO(&err_info, "epoll_ctl");
+        goto cleanup;
+    }
+
+    ++sr_disp.sub_count;
+    *added = 1;
+
+cleanup:
+    /* DISPATCHER UNLOCK */
+    pthread_mutex_unlock(&sr_disp.lock);
+    return err_info;
+}
+
+void
+sr_shmsub_dispatch_del(sr_subscription_ctx_t *subs)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_dispatcher_sub_s *disp_sub;
+    uint32_t i;
+
+    /* DISPATCHER LOCK */
+    pthread_mutex_lock(&sr_disp.lock);
+
+    for (i = 0; i < sr_disp.sub_count; ++i) {
+        if (sr_disp.subs[i].subs == subs) {
+            break;
+        }
+    }
+    if (i == sr_disp.sub_count) {
+        SR_ERRINFO_INT(&err_info);
+        sr_errinfo_free(&err_info);
+        goto cleanup;
+    }
+    disp_sub = &sr_disp.subs[i];
+
+    /* stop listening for its events */
+    if (epoll_ctl(sr_disp.epoll_fd, EPOLL_CTL_DEL, subs->evpipe, NULL) == -1) {
+        SR_ERRINFO_SYSERRNO(&err_info, "epoll_ctl");
+        sr_errinfo_free(&err_info);
+    }
+
+    /* wait until it is no longer being processed, unless it is by this very thread from a callback */
+    while (disp_sub->busy && !pthread_equal(disp_sub->tid, pthread_self())) {
+        pthread_cond_wait(&sr_disp.cond, &sr_disp.lock);
+
+        /* find it again, the array may have changed */
+        for (i = 0; sr_disp.subs[i].subs != subs; ++i) {}
+        disp_sub = &sr_disp.subs[i];
+    }
+
+    /* remove it */
+    --sr_disp.sub_count;
+    if (i < sr_disp.sub_count) {
+        memcpy(disp_sub, &sr_disp.subs[sr_disp.sub_count], sizeof *disp_sub);
+    }
+    if (!sr_disp.sub_count) {
+        free(sr_disp.subs);
+        sr_disp.subs = NULL;
+    }
+
+cleanup:
+    /* DISPATCHER UNLOCK */
+    pthread_mutex_unlock(&sr_disp.lock);
+}
@@ -329,6 +329,45 @@ cleanup:
     return sr_api_ret(NULL, err_info);
 }
 
+/**
+ * @brief Process-wide pool of threads sending asynchronous RPCs/actions.
+ */
+static struct sr_rpc_async_s {
+    pthread_mutex_t lock;       /**< Lock for accessing all the members below and asynchronous RPC/action counts
+                                     of all the sessions. */
+    pthread_cond_t cond;        /**< Condition signalled when an asynchronous RPC/action finishes. */
+    uint32_t thread_count;      /**< Number of running threads, each of them is processing a request. */
+
+    struct sr_rpc_async_req_s {
+        sr_session_ctx_t *session;  /**< Session to send the RPC/action on. */
+        struct lyd_node *input;     /**< Duplicated input data tree. */
+        uint32_t timeout_ms;        /**< RPC/action callback timeout in milliseconds. */
+        sr_rpc_async_cb cb;         /**< Callback to be called with the result. */
+        void *private_data;         /**< Callback private data. */
+        struct sr_rpc_async_req_s *next;    /**< Next queued request. */
+    } *first;                   /**< First queued request. */
+    struct sr_rpc_async_req_s *last;    /**< Last queued request. */
+} sr_rpc_async = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, NULL, NULL};
+
+/**
+ * @brief Wait for all the asynchronous RPCs/actions sent on a session to finish.
+ *
+ * @param[in] session Session to wait for.
+ */
+static void
+sr_rpc_async_wait(sr_session_ctx_t *session)
+{
+    /* ASYNC LOCK */
+    pthread_mutex_lock(&sr_rpc_async.lock);
+
+    while (session->rpc_async_count) {
+        pthread_cond_wait(&sr_rpc_async.cond, &sr_rpc_async.lock);
+    }
+
+    /* ASYNC UNLOCK */
+    pthread_mutex_unlock(&sr_rpc_async.lock);
+}
+
 API int
 sr_disconnect(sr_conn_ctx_t *conn)
 {
@@ -339,6 +378,11 @@ sr_disconnect(sr_conn_ctx_t *conn)
         return sr_api_ret(NULL, NULL);
     }
 
+    /* the RPCs/actions need SHM lock to finish */
+    for (i = 0; i < conn->session_count; ++i) {
+        sr_rpc_async_wait(conn->sessions[i]);
+    }
+
     /* SHM LOCK */
     lock_err = sr_shmmain_lock_remap(conn, SR_LOCK_WRITE_NOSTATE, 1, 0);
     sr_errinfo_merge(&err_info, lock_err);
@@ -626,6 +670,9 @@ sr_session_stop(sr_session_ctx_t *session)
 
     conn = session->conn;
 
+    /* the RPCs/actions need SHM lock to finish */
+    sr_rpc_async_wait(session);
+
     /* SHM LOCK */
     lock_err = sr_shmmain_lock_remap(conn, SR_LOCK_WRITE, 0, 0);
     sr_errinfo_merge(&err_info, lock_err);
@@ -917,7 +964,9 @@ sr_check_ext_shm_defrag(sr_conn_ctx_t *conn)
     sr_error_info_t *err_info = NULL;
     char *buf;
 
-    if (*((size_t *)conn->ext_shm.addr) <= SR_SHM_WASTED_MAX_MEM) {
+    /* unused subscription array capacity is counted as wasted but it is going to be reused */
+    if (*((size_t *)conn->ext_shm.addr) - sr_shmmain_ext_get_unused_cap(&conn->main_shm, conn->ext_shm.addr)
+            <= SR_SHM_WASTED_MAX_MEM) {
         /* not enough wasted memory, leave it as it is */
         return NULL;
     }
@@ -1306,6 +1355,63 @@ cleanup_unlock:
     return sr_api_ret(NULL, err_info);
 }
 
+API int
+sr_set_module_subtree_lock(sr_conn_ctx_t *conn, const char *module_name, const char *list_name)
+{
+    sr_error_info_t *err_info = NULL;
+    const struct lys_module *ly_mod;
+    const struct lys_node *snode;
+
+    SR_CHECK_ARG_APIRET(!conn || !module_name, NULL, err_info);
+
+    /* SHM LOCK (the list name is stored in ext SHM) */
+    if ((err_info = sr_shmmain_lock_remap(conn, SR_LOCK_WRITE, 1, 1))) {
+        return sr_api_ret(NULL, err_info);
+    }
+
+    /* try to find this module */
+    ly_mod = ly_ctx_get_module(conn->ly_ctx, module_name, NULL, 1);
+    if (!ly_mod || !ly_mod->implemented) {
+        sr_errinfo_new(&err_info, SR_ERR_NOT_FOUND, NULL, "Module \"%s\" was not found in sysrepo.", module_name);
+        goto cleanup_unlock;
+    }
+
+    if (list_name) {
+        /* find the list */
+        snode = NULL;
+        while ((snode = lys_getnext(snode, NULL, ly_mod, 0))) {
+            if (!strcmp(snode->name, list_name)) {
+                break;
+            }
+        }
+        if (!snode || (snode->nodetype != LYS_LIST) || (snode->flags & LYS_CONFIG_R)) {
+            sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Module \"%s\" has no top-level configuration list \"%s\".",
+                    module_name, list_name);
+            goto cleanup_unlock;
+        }
+    }
+
+    /* check write permission */
+    if ((err_info = sr_perm_check(module_name, 1))) {
+        goto cleanup_unlock;
+    }
+
+    /* update subtree lock both in LY data tree and in main SHM */
+    if ((err_info = sr_lydmods_update_subtree_lock(conn->ly_ctx, module_name, list_name))) {
+        goto cleanup_unlock;
+    }
+    if ((err_info = sr_shmmain_update_subtree_lock(conn, module_name, list_name))) {
+        goto cleanup_unlock;
+    }
+
+    /* success */
+
+cleanup_unlock:
+    /* SHM UNLOCK */
+    sr_shmmain_unlock(conn, SR_LOCK_WRITE, 1, 1);
+    return sr_api_ret(NULL, err_info);
+}
+
 API int
 sr_set_module_access(sr_conn_ctx_t *conn, const char *module_name, const char *owner, const char *group, mode_t perm)
 {
@@ -1596,8 +1702,20 @@ cleanup_shm_unlock:
     return sr_api_ret(session, err_info);
 }
 
-API int
-sr_get_items(sr_session_ctx_t *session, const char *xpath, uint32_t timeout_ms, sr_val_t **values, size_t *value_cnt)
+/**
+ * @brief Get values of data elements selected by an XPath.
+ *
+ * @param[in] session Session to use.
+ * @param[in] xpath XPath of the data elements.
+ * @param[in] timeout_ms Operational callback timeout in milliseconds.
+ * @param[in] arena Whether to return the values packed in a single memory block.
+ * @param[out] values Array of values.
+ * @param[out] value_cnt Number of values.
+ * @return err_code (SR_ERR_OK on success).
+ */
+static int
+_sr_get_items(sr_session_ctx_t *session, const char *xpath, uint32_t timeout_ms, int arena, sr_val_t **values,
+        size_t *value_cnt)
 {
     sr_error_info_t *err_info = NULL, *cb_err_info = NULL;
     struct ly_set *set = NULL;
@@ -1644,16 +1762,23 @@ sr_get_items(sr_session_ctx_t *session, const char *xpath, uint32_t timeout_ms,
         goto cleanup_mods_unlock;
     }
 
-    if (set->number) {
-        *values = calloc(set->number, sizeof **values);
-        SR_CHECK_MEM_GOTO(!*values, err_info, cleanup_mods_unlock);
-    }
-
-    for (i = 0; i < set->number; ++i) {
-        if ((err_info = sr_val_ly2sr(set->set.d[i], (*values) + i))) {
+    if (arena) {
+        /* create everything in one block */
+        if ((err_info = sr_vals_ly2sr_arena(set, values, value_cnt))) {
             goto cleanup_mods_unlock;
         }
-        ++(*value_cnt);
+    } else {
+        if (set->number) {
+            *values = calloc(set->number, sizeof **values);
+            SR_CHECK_MEM_GOTO(!*values, err_info, cleanup_mods_unlock);
+        }
+
+        for (i = 0; i < set->number; ++i) {
+            if ((err_info = sr_val_ly2sr(set->set.d[i], (*values) + i))) {
+                goto cleanup_mods_unlock;
+            }
+            ++(*value_cnt);
+        }
     }
 
     /* success */
@@ -1674,6 +1799,7 @@ cleanup_shm_unlock:
         err_info->err_code = SR_ERR_CALLBACK_FAILED;
     }
     if (err_info) {
+        /* values are created in a block only on success */
         sr_free_values(*values, *value_cnt);
         *values = NULL;
         *value_cnt = 0;
@@ -1681,6 +1807,19 @@ cleanup_shm_unlock:
     return sr_api_ret(session, err_info);
 }
 
+API int
+sr_get_items(sr_session_ctx_t *session, const char *xpath, uint32_t timeout_ms, sr_val_t **values, size_t *value_cnt)
+{
+    return _sr_get_items(session, xpath, timeout_ms, 0, values, value_cnt);
+}
+
+API int
+sr_get_items_arena(sr_session_ctx_t *session, const char *xpath, uint32_t timeout_ms, sr_val_t **values,
+        size_t *value_cnt)
+{
+    return _sr_get_items(session, xpath, timeout_ms, 1, values, value_cnt);
+}
+
 API int
 sr_get_subtree(sr_session_ctx_t *session, const char *path, uint32_t timeout_ms, struct lyd_node **subtree)
 {
@@ -1761,8 +1900,20 @@ cleanup_shm_unlock:
     return sr_api_ret(session, err_info);
 }
 
-API int
-sr_get_data(sr_session_ctx_t *session, const char *xpath, uint32_t max_depth, uint32_t timeout_ms,
+/**
+ * @brief Get data subtrees selected by an XPath, optionally using a prepared query.
+ *
+ * @param[in] session Session to use.
+ * @param[in] xpath XPath selecting root nodes of the subtrees.
+ * @param[in] query Optional prepared query of @p xpath.
+ * @param[in] max_depth Maximum depth of the selected subtrees.
+ * @param[in] timeout_ms Operational callback timeout in milliseconds.
+ * @param[in] opts Get oper data options.
+ * @param[out] data Connected top-level trees with all the requested data.
+ * @return err_code (SR_ERR_OK on success).
+ */
+static int
+_sr_get_data(sr_session_ctx_t *session, const char *xpath, sr_query_t *query, uint32_t max_depth, uint32_t timeout_ms,
         const sr_get_oper_options_t opts, struct lyd_node **data)
 {
     sr_error_info_t *err_info = NULL, *cb_err_info = NULL;
@@ -1772,8 +1923,6 @@ sr_get_data(sr_session_ctx_t *session, const char *xpath, uint32_t max_depth, ui
     struct ly_set *subtrees = NULL;
     struct lyd_node *node;
 
-    SR_CHECK_ARG_APIRET(!session || !xpath || !data || ((session->ds != SR_DS_OPERATIONAL) && opts), session, err_info);
-
     if (!timeout_ms) {
         timeout_ms = SR_OPER_CB_TIMEOUT;
     }
@@ -1785,9 +1934,16 @@ sr_get_data(sr_session_ctx_t *session, const char *xpath, uint32_t max_depth, ui
         return sr_api_ret(session, err_info);
     }
 
-    /* collect all required modules */
-    if ((err_info = sr_shmmod_collect_xpath(session->conn, xpath, session->ds, &mod_info))) {
-        goto cleanup_shm_unlock;
+    if (query) {
+        /* use the modules collected before */
+        if ((err_info = sr_modinfo_query_load(query, &mod_info))) {
+            goto cleanup_shm_unlock;
+        }
+    } else {
+        /* collect all required modules */
+        if ((err_info = sr_shmmod_collect_xpath(session->conn, xpath, session->ds, &mod_info))) {
+            goto cleanup_shm_unlock;
+        }
     }
 
     /* check read perm */
@@ -1869,6 +2025,83 @@ cleanup_shm_unlock:
     return sr_api_ret(session, err_info);
 }
 
+API int
+sr_get_data(sr_session_ctx_t *session, const char *xpath, uint32_t max_depth, uint32_t timeout_ms,
+        const sr_get_oper_options_t opts, struct lyd_node **data)
+{
+    sr_error_info_t *err_info = NULL;
+
+    SR_CHECK_ARG_APIRET(!session || !xpath || !data || ((session->ds != SR_DS_OPERATIONAL) && opts), session, err_info);
+
+    return _sr_get_data(session, xpath, NULL, max_depth, timeout_ms, opts, data);
+}
+
+API int
+sr_prepare_query(sr_session_ctx_t *session, const char *xpath, sr_query_t **query)
+{
+    sr_error_info_t *err_info = NULL;
+
+    SR_CHECK_ARG_APIRET(!session || !xpath || !query, session, err_info);
+
+    *query = calloc(1, sizeof **query);
+    SR_CHECK_MEM_GOTO(!*query, err_info, error);
+    (*query)->conn = session->conn;
+    (*query)->ds = session->ds;
+    (*query)->xpath = strdup(xpath);
+    SR_CHECK_MEM_GOTO(!(*query)->xpath, err_info, error);
+
+    /* SHM LOCK */
+    if ((err_info = sr_shmmain_lock_remap(session->conn, SR_LOCK_READ, 0, 0))) {
+        goto error;
+    }
+
+    /* collect all required modules */
+    err_info = sr_modinfo_query_prepare(session->conn, xpath, session->ds, *query);
+
+    /* SHM UNLOCK */
+    sr_shmmain_unlock(session->conn, SR_LOCK_READ, 0, 0);
+
+    if (err_info) {
+        goto error;
+    }
+
+    return sr_api_ret(session, NULL);
+
+error:
+    sr_query_free(*query);
+    *query = NULL;
+    return sr_api_ret(session, err_info);
+}
+
+API int
+sr_get_data_prepared(sr_session_ctx_t *session, sr_query_t *query, uint32_t max_depth, uint32_t timeout_ms,
+        const sr_get_oper_options_t opts, struct lyd_node **data)
+{
+    sr_error_info_t *err_info = NULL;
+
+    SR_CHECK_ARG_APIRET(!session || !query || !data || (session->conn != query->conn) || (session->ds != query->ds)
+            || ((session->ds != SR_DS_OPERATIONAL) && opts), session, err_info);
+
+    return _sr_get_data(session, query->xpath, query, max_depth, timeout_ms, opts, data);
+}
+
+API void
+sr_query_free(sr_query_t *query)
+{
+    uint32_t i;
+
+    if (!query) {
+        return;
+    }
+
+    for (i = 0; i < query->mod_count; ++i) {
+        free(query->mods[i].oper_sub_req);
+    }
+    free(query->mods);
+    free(query->xpath);
+    free(query);
+}
+
 API void
 sr_free_val(sr_val_t *value)
 {
@@ -1927,6 +2160,15 @@ sr_free_values(sr_val_t *values, size_t count)
     free(values);
 }
 
+API void
+sr_free_values_arena(sr_val_t *values, size_t count)
+{
+    (void)count;
+
+    /* all the strings are stored in the same block */
+    free(values);
+}
+
 API int
 sr_set_item(sr_session_ctx_t *session, const char *path, const sr_val_t *value, const sr_edit_options_t opts)
 {
@@ -2078,6 +2320,31 @@ error:
     return sr_api_ret(session, err_info);
 }
 
+API int
+sr_edit_bulk(sr_session_ctx_t *session, const sr_edit_entry_t *entries, size_t entry_cnt, const char *origin)
+{
+    sr_error_info_t *err_info = NULL;
+    size_t i;
+
+    SR_CHECK_ARG_APIRET(!session || (!entries && entry_cnt), session, err_info);
+    for (i = 0; i < entry_cnt; ++i) {
+        SR_CHECK_ARG_APIRET(!entries[i].xpath, session, err_info);
+    }
+
+    /* SHM LOCK */
+    if ((err_info = sr_shmmain_lock_remap(session->conn, SR_LOCK_READ, 0, 0))) {
+        return sr_api_ret(session, err_info);
+    }
+
+    /* SHM UNLOCK */
+    sr_shmmain_unlock(session->conn, SR_LOCK_READ, 0, 0);
+
+    /* add all the operations into edit */
+    err_info = sr_edit_add_bulk(session, entries, entry_cnt, origin);
+
+    return sr_api_ret(session, err_info);
+}
+
 API int
 sr_validate(sr_session_ctx_t *session, uint32_t timeout_ms)
 {
@@ -2150,7 +2417,7 @@ cleanup_shm_unlock:
 API int
 sr_apply_changes(sr_session_ctx_t *session, uint32_t timeout_ms)
 {
-    sr_error_info_t *err_info = NULL, *cb_err_info = NULL;
+    sr_error_info_t *err_info = NULL, *cb_err_info = NULL, *tmp_err_info;
     struct lyd_node *update_edit = NULL, *diff = NULL;
     struct sr_mod_info_s mod_info;
     sr_get_oper_options_t get_opts;
@@ -2185,6 +2452,11 @@ sr_apply_changes(sr_session_ctx_t *session, uint32_t timeout_ms)
         goto cleanup_shm_unlock;
     }
 
+    /* collect subtrees to lock instead of whole modules, if possible */
+    if ((err_info = sr_modinfo_subtree_collect(&mod_info, session->dt[session->ds].edit))) {
+        goto cleanup_shm_unlock;
+    }
+
     /* MODULES READ LOCK (but setting flag for guaranteed later upgrade success) */
     if ((err_info = sr_shmmod_modinfo_rdlock(&mod_info, 1, session->sid))) {
         goto cleanup_mods_unlock;
@@ -2195,11 +2467,25 @@ sr_apply_changes(sr_session_ctx_t *session, uint32_t timeout_ms)
         goto cleanup_mods_unlock;
     }
 
+    /* MODULES READ UNLOCK (modules with only subtrees locked) */
+    sr_shmmod_modinfo_subtree_rdunlock(&mod_info);
+
     /* create diff */
     if ((err_info = sr_modinfo_edit_apply(&mod_info, session->dt[session->ds].edit, 1))) {
         goto cleanup_mods_unlock;
     }
 
+    /* detect repeated edits that change nothing */
+    if (sr_modinfo_edit_noop(&mod_info)) {
+        /* check write perm, the edit must not succeed otherwise */
+        if ((err_info = sr_modinfo_perm_check(&mod_info, 1))) {
+            goto cleanup_mods_unlock;
+        }
+
+        SR_LOG_INFMSG("No datastore changes to apply.");
+        goto cleanup_mods_unlock;
+    }
+
     /* call connection diff callback */
     if (mod_info.diff && session->conn->diff_check_cb && (ret = session->conn->diff_check_cb(session, mod_info.diff))) {
         /* create cb_err_info */
@@ -2233,7 +2519,7 @@ sr_apply_changes(sr_session_ctx_t *session, uint32_t timeout_ms)
 
     /* check write perm (we must wait until after validation, some additional modules can be modified) */
     if ((err_info = sr_modinfo_perm_check(&mod_info, 1))) {
-        goto cleanup_shm_unlock;
+        goto cleanup_mods_unlock;
     }
 
     if (mod_info.diff) {
@@ -2283,6 +2569,11 @@ sr_apply_changes(sr_session_ctx_t *session, uint32_t timeout_ms)
         }
 
         if (mod_info.diff) {
+            /* the changes must not affect any subtrees locked by other sessions */
+            if ((err_info = sr_modinfo_subtree_check(&mod_info))) {
+                goto cleanup_mods_unlock;
+            }
+
             /* publish final diff in a "change" event for any subscribers and wait for them */
             if ((err_info = sr_shmsub_change_notify_change(&mod_info, session->sid, timeout_ms, &cb_err_info))) {
                 goto cleanup_mods_unlock;
@@ -2304,6 +2595,16 @@ sr_apply_changes(sr_session_ctx_t *session, uint32_t timeout_ms)
         goto cleanup_mods_unlock;
     }
 
+    /* apply the changes on other subtrees changed meanwhile */
+    if ((err_info = sr_modinfo_subtree_rebase(&mod_info))) {
+        if (mod_info.diff) {
+            /* the changes will not be stored, publish "abort" event for the subscribers that accepted them */
+            tmp_err_info = sr_shmsub_change_notify_change_abort(&mod_info, session->sid);
+            sr_errinfo_merge(&err_info, tmp_err_info);
+        }
+        goto cleanup_mods_unlock;
+    }
+
     /* store updated datastore */
     if ((err_info = sr_modinfo_data_store(&mod_info))) {
         goto cleanup_mods_unlock;
@@ -2369,7 +2670,8 @@ sr_discard_changes(sr_session_ctx_t *session)
  *
  * @param[in] session Session to use.
  * @param[in] ly_mod Optional specific module.
- * @param[in] src_config Source data for the replace, they are spent.
+ * @param[in] src_config Source data for the replace, they are spent. If NULL, candidate changes are
+ * committed into running by applying their stored diff.
  * @param[in] trg_datastore Destination datastore.
  * @param[in] timeout_ms Change callback timeout in milliseconds.
  * @return err_info, NULL on success.
@@ -2381,9 +2683,11 @@ _sr_replace_config(sr_session_ctx_t *session, const struct lys_module *ly_mod, s
     sr_error_info_t *err_info = NULL, *cb_err_info = NULL;
     struct sr_mod_info_s mod_info;
     const char *err_msg = NULL, *err_xpath = NULL;
+    uint32_t i;
     int ret;
 
-    assert(!*src_config || !(*src_config)->prev->next);
+    assert(!src_config || !*src_config || !(*src_config)->prev->next);
+    assert(src_config || (trg_datastore == SR_DS_RUNNING));
     memset(&mod_info, 0, sizeof mod_info);
 
     /* collect all required modules */
@@ -2406,9 +2710,16 @@ _sr_replace_config(sr_session_ctx_t *session, const struct lys_module *ly_mod, s
         goto cleanup_mods_unlock;
     }
 
-    /* update affected data and create corresponding diff */
-    if ((err_info = sr_modinfo_replace(&mod_info, src_config))) {
-        goto cleanup_mods_unlock;
+    if (src_config) {
+        /* update affected data and create corresponding diff */
+        if ((err_info = sr_modinfo_replace(&mod_info, src_config))) {
+            goto cleanup_mods_unlock;
+        }
+    } else {
+        /* apply only candidate changes, their diff is known */
+        if ((err_info = sr_modinfo_candidate_apply(&mod_info))) {
+            goto cleanup_mods_unlock;
+        }
     }
 
     /* call connection diff callback */
@@ -2425,7 +2736,9 @@ _sr_replace_config(sr_session_ctx_t *session, const struct lys_module *ly_mod, s
         goto cleanup_mods_unlock;
     }
 
-    if (!mod_info.diff) {
+    /* there may be changes without a diff if nobody needs it */
+    for (i = 0; (i < mod_info.mod_count) && !(mod_info.mods[i].state & MOD_INFO_CHANGED); ++i) {}
+    if (i == mod_info.mod_count) {
         /* while there are no changes for callbacks, some default flags could have changed so we must store them */
         SR_LOG_INFMSG("No datastore changes to apply.");
     } else if (trg_datastore != SR_DS_CANDIDATE) {
@@ -2533,44 +2846,232 @@ cleanup_shm_unlock:
     return sr_api_ret(session, err_info);
 }
 
-API int
-sr_copy_config(sr_session_ctx_t *session, const char *module_name, sr_datastore_t src_datastore,
-        sr_datastore_t trg_datastore, uint32_t timeout_ms)
+/**
+ * @brief Copy module data between startup and running by copying their raw LYB files without parsing them.
+ * Possible only if nobody can observe the changes and the data do not need to be validated.
+ *
+ * Main SHM read lock is expected to be held.
+ *
+ * @param[in] session Session to use.
+ * @param[in] ly_mod Optional specific module.
+ * @param[in] src_datastore Source datastore.
+ * @param[in] trg_datastore Target datastore.
+ * @param[out] copied Whether the data were copied, if not, the standard way must be used.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_copy_config_raw(sr_session_ctx_t *session, const struct lys_module *ly_mod, sr_datastore_t src_datastore,
+        sr_datastore_t trg_datastore, int *copied)
 {
     sr_error_info_t *err_info = NULL;
-    struct sr_mod_info_s mod_info;
-    const struct lys_module *ly_mod = NULL;
+    struct sr_mod_info_s src_mod_info, trg_mod_info;
+    struct lyd_node *diff;
+    char **raw_data = NULL;
+    size_t *raw_size = NULL;
+    uint32_t i;
+    char *path;
+    int observed, r;
 
-    SR_CHECK_ARG_APIRET(!session || !SR_IS_CONVENTIONAL_DS(src_datastore) || !SR_IS_CONVENTIONAL_DS(trg_datastore),
-            session, err_info);
+    *copied = 0;
+    memset(&src_mod_info, 0, sizeof src_mod_info);
+    memset(&trg_mod_info, 0, sizeof trg_mod_info);
 
-    if (src_datastore == trg_datastore) {
-        /* nothing to do */
-        return sr_api_ret(session, NULL);
+    if (((src_datastore != SR_DS_STARTUP) || (trg_datastore != SR_DS_RUNNING))
+            && ((src_datastore != SR_DS_RUNNING) || (trg_datastore != SR_DS_STARTUP))) {
+        /* candidate is handled differently */
+        return NULL;
     }
 
-    if (!timeout_ms) {
-        timeout_ms = SR_CHANGE_CB_TIMEOUT;
+    /* collect target modules */
+    if ((err_info = sr_shmmod_collect_modules(session->conn, ly_mod, trg_datastore, MOD_INFO_DEP | MOD_INFO_INV_DEP,
+            &trg_mod_info))) {
+        goto cleanup;
     }
-    memset(&mod_info, 0, sizeof mod_info);
-
-    /* SHM LOCK */
-    if ((err_info = sr_shmmain_lock_remap(session->conn, SR_LOCK_READ, 0, 0))) {
-        return sr_api_ret(session, err_info);
+    if (ly_mod && (trg_mod_info.mod_count > 1)) {
+        /* the data of the single module would need to be validated with its dependencies */
+        goto cleanup;
     }
 
-    if (module_name) {
-        /* try to find this module */
-        ly_mod = ly_ctx_get_module(session->conn->ly_ctx, module_name, NULL, 1);
-        if (!ly_mod) {
-            sr_errinfo_new(&err_info, SR_ERR_NOT_FOUND, NULL, "Module \"%s\" was not found in sysrepo.", module_name);
-            goto cleanup_shm_unlock;
-        }
+    /* check write perm */
+    if ((err_info = sr_modinfo_perm_check(&trg_mod_info, 1))) {
+        goto cleanup;
     }
 
-    /* collect all required modules (dependencies are not needed for a single module, otherwise all of them are there) */
-    if ((err_info = sr_shmmod_collect_modules(session->conn, ly_mod, src_datastore, 0, &mod_info))) {
-        goto cleanup_shm_unlock;
+    /* changes must not be observable, the diff would need to be generated */
+    if ((err_info = sr_modinfo_changes_observed(&trg_mod_info, &observed))) {
+        goto cleanup;
+    }
+    if (observed) {
+        goto cleanup;
+    }
+
+    /* collect source modules, the same ones in the same order */
+    if ((err_info = sr_shmmod_collect_modules(session->conn, ly_mod, src_datastore, 0, &src_mod_info))) {
+        goto cleanup;
+    }
+    SR_CHECK_INT_GOTO(src_mod_info.mod_count != trg_mod_info.mod_count, err_info, cleanup);
+
+    raw_data = calloc(src_mod_info.mod_count, sizeof *raw_data);
+    raw_size = calloc(src_mod_info.mod_count, sizeof *raw_size);
+    SR_CHECK_MEM_GOTO(!raw_data || !raw_size, err_info, cleanup);
+
+    /* MODULES READ LOCK */
+    if ((err_info = sr_shmmod_modinfo_rdlock(&src_mod_info, 0, session->sid))) {
+        goto cleanup;
+    }
+
+    /* read raw source data */
+    for (i = 0; i < src_mod_info.mod_count; ++i) {
+        assert(src_mod_info.mods[i].ly_mod == trg_mod_info.mods[i].ly_mod);
+        if ((err_info = sr_module_file_data_get_raw(src_mod_info.mods[i].ly_mod->name, src_datastore, &raw_data[i],
+                &raw_size[i]))) {
+            break;
+        }
+    }
+
+    /* MODULES UNLOCK */
+    sr_shmmod_modinfo_unlock(&src_mod_info, 0);
+
+    if (err_info) {
+        goto cleanup;
+    }
+
+    /* MODULES READ LOCK (but setting flag for guaranteed later upgrade success) */
+    if ((err_info = sr_shmmod_modinfo_rdlock(&trg_mod_info, 1, session->sid))) {
+        goto cleanup;
+    }
+
+    if (trg_datastore == SR_DS_RUNNING) {
+        /* stored operational diffs would need to be updated and candidate diffs rebased on the new data */
+        for (i = 0; i < trg_mod_info.mod_count; ++i) {
+            if ((err_info = sr_path_ds_shm(trg_mod_info.mods[i].ly_mod->name, SR_DS_CANDIDATE, 1, &path))) {
+                goto cleanup_mods_unlock;
+            }
+            r = access(path, F_OK);
+            free(path);
+            if ((r == -1) && (errno != ENOENT)) {
+                SR_ERRINFO_SYSERRNO(&err_info, "access");
+                goto cleanup_mods_unlock;
+            } else if (!r) {
+                /* candidate was modified */
+                goto cleanup_mods_unlock;
+            }
+
+            diff = NULL;
+            if ((err_info = sr_module_file_data_append(trg_mod_info.mods[i].ly_mod, SR_DS_OPERATIONAL, &diff))) {
+                goto cleanup_mods_unlock;
+            }
+            if (diff) {
+                lyd_free_withsiblings(diff);
+                goto cleanup_mods_unlock;
+            }
+        }
+    }
+
+    /* MODULES WRITE LOCK (upgrade) */
+    if ((err_info = sr_shmmod_modinfo_rdlock_upgrade(&trg_mod_info, session->sid))) {
+        goto cleanup_mods_unlock;
+    }
+
+    /* store raw data */
+    for (i = 0; i < trg_mod_info.mod_count; ++i) {
+        if ((err_info = sr_module_file_data_set_raw(trg_mod_info.mods[i].ly_mod->name, trg_datastore, raw_data[i],
+                raw_size[i]))) {
+            goto cleanup_mods_unlock;
+        }
+        if (trg_datastore == SR_DS_RUNNING) {
+            /* update module running data version, any cached data will be reloaded */
+            ++trg_mod_info.mods[i].shm_mod->ver;
+        }
+    }
+
+    if (trg_datastore == SR_DS_STARTUP) {
+        /* make all the stored startup files durable at once */
+        if ((err_info = sr_startup_dir_sync())) {
+            goto cleanup_mods_unlock;
+        }
+    }
+
+    /* success */
+    *copied = 1;
+
+cleanup_mods_unlock:
+    /* MODULES UNLOCK */
+    sr_shmmod_modinfo_unlock(&trg_mod_info, 1);
+
+cleanup:
+    if (raw_data) {
+        for (i = 0; i < src_mod_info.mod_count; ++i) {
+            free(raw_data[i]);
+        }
+    }
+    free(raw_data);
+    free(raw_size);
+    sr_modinfo_free(&src_mod_info);
+    sr_modinfo_free(&trg_mod_info);
+    return err_info;
+}
+
+API int
+sr_copy_config(sr_session_ctx_t *session, const char *module_name, sr_datastore_t src_datastore,
+        sr_datastore_t trg_datastore, uint32_t timeout_ms)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_mod_info_s mod_info;
+    const struct lys_module *ly_mod = NULL;
+    int copied;
+
+    SR_CHECK_ARG_APIRET(!session || !SR_IS_CONVENTIONAL_DS(src_datastore) || !SR_IS_CONVENTIONAL_DS(trg_datastore),
+            session, err_info);
+
+    if (src_datastore == trg_datastore) {
+        /* nothing to do */
+        return sr_api_ret(session, NULL);
+    }
+
+    if (!timeout_ms) {
+        timeout_ms = SR_CHANGE_CB_TIMEOUT;
+    }
+    memset(&mod_info, 0, sizeof mod_info);
+
+    /* SHM LOCK */
+    if ((err_info = sr_shmmain_lock_remap(session->conn, SR_LOCK_READ, 0, 0))) {
+        return sr_api_ret(session, err_info);
+    }
+
+    if (module_name) {
+        /* try to find this module */
+        ly_mod = ly_ctx_get_module(session->conn->ly_ctx, module_name, NULL, 1);
+        if (!ly_mod) {
+            sr_errinfo_new(&err_info, SR_ERR_NOT_FOUND, NULL, "Module \"%s\" was not found in sysrepo.", module_name);
+            goto cleanup_shm_unlock;
+        }
+    }
+
+    /* try to copy the data directly */
+    if ((err_info = sr_copy_config_raw(session, ly_mod, src_datastore, trg_datastore, &copied))) {
+        goto cleanup_shm_unlock;
+    }
+    if (copied) {
+        SR_LOG_INF("Data copied from %s to %s datastore without parsing.", sr_ds2str(src_datastore),
+                sr_ds2str(trg_datastore));
+        goto cleanup_shm_unlock;
+    }
+
+    /* collect all required modules (dependencies are not needed for a single module, otherwise all of them are there) */
+    if ((err_info = sr_shmmod_collect_modules(session->conn, ly_mod, src_datastore, 0, &mod_info))) {
+        goto cleanup_shm_unlock;
+    }
+
+    if ((src_datastore == SR_DS_CANDIDATE) && (trg_datastore == SR_DS_RUNNING)) {
+        /* special case, apply only candidate changes without loading candidate data */
+        if ((err_info = _sr_replace_config(session, ly_mod, NULL, trg_datastore, timeout_ms))) {
+            goto cleanup_shm_unlock;
+        }
+
+        /* reset candidate after it was applied in running */
+        err_info = sr_modinfo_candidate_reset(&mod_info);
+        goto cleanup_shm_unlock;
     }
 
     /* MODULES READ LOCK */
@@ -2602,13 +3103,6 @@ sr_copy_config(sr_session_ctx_t *session, const char *module_name, sr_datastore_
         goto cleanup_shm_unlock;
     }
 
-    if ((src_datastore == SR_DS_CANDIDATE) && (trg_datastore == SR_DS_RUNNING)) {
-        /* reset candidate after it was applied in running */
-        if ((err_info = sr_modinfo_candidate_reset(&mod_info))) {
-            goto cleanup_shm_unlock;
-        }
-    }
-
     /* success */
 
 cleanup_shm_unlock:
@@ -2658,7 +3152,7 @@ sr_change_dslock(struct sr_mod_info_s *mod_info, int lock, sr_sid_t sid)
                     mod->ly_mod->name, sid.sr, sid.nc);
             goto error;
         } else if (lock && (mod_info->ds == SR_DS_CANDIDATE)) {
-            /* candidate DS file cannot exist */
+            /* candidate DS diff cannot exist */
             if ((err_info = sr_path_ds_shm(mod->ly_mod->name, SR_DS_CANDIDATE, 1, &path))) {
                 goto error;
             }
@@ -2667,7 +3161,8 @@ sr_change_dslock(struct sr_mod_info_s *mod_info, int lock, sr_sid_t sid)
             if ((r == -1) && (errno != ENOENT)) {
                 SR_ERRINFO_SYSERRNO(&err_info, "access");
                 goto error;
-            } else if (!r) {
+            } else if (!r && (mod->shm_mod->cand_ver == mod->shm_mod->ver)) {
+                /* stale candidate diff is ignored */
                 sr_errinfo_new(&err_info, SR_ERR_UNSUPPORTED, NULL, "Module \"%s\" candidate datastore data have "
                         "already been modified.", mod->ly_mod->name);
                 goto error;
@@ -2885,6 +3380,26 @@ sr_get_event_pipe(sr_subscription_ctx_t *subscription, int *event_pipe)
     return SR_ERR_OK;
 }
 
+API int
+sr_dispatcher_start(uint32_t thread_count)
+{
+    sr_error_info_t *err_info = NULL;
+
+    SR_CHECK_ARG_APIRET(!thread_count, NULL, err_info);
+
+    err_info = sr_shmsub_dispatch_start(thread_count);
+    return sr_api_ret(NULL, err_info);
+}
+
+API int
+sr_dispatcher_stop(void)
+{
+    sr_error_info_t *err_info = NULL;
+
+    err_info = sr_shmsub_dispatch_stop();
+    return sr_api_ret(NULL, err_info);
+}
+
 /**
  * @brief Process special notification events on a subscription involving
  * changing ext SHM.
@@ -2995,21 +3510,21 @@ process_events:
 
     /* change subscriptions */
     for (i = 0; i < subscription->change_sub_count; ++i) {
-        if ((err_info = sr_shmsub_change_listen_process_module_events(&subscription->change_subs[i], subscription->conn))) {
+        if ((err_info = sr_shmsub_change_listen_process_module_events(&subscription->change_subs[i], subscription))) {
             goto cleanup_unlock;
         }
     }
 
     /* operational subscriptions */
     for (i = 0; i < subscription->oper_sub_count; ++i) {
-        if ((err_info = sr_shmsub_oper_listen_process_module_events(&subscription->oper_subs[i], subscription->conn))) {
+        if ((err_info = sr_shmsub_oper_listen_process_module_events(&subscription->oper_subs[i], subscription))) {
             goto cleanup_unlock;
         }
     }
 
     /* RPC/action subscriptions */
     for (i = 0; i < subscription->rpc_sub_count; ++i) {
-        if ((err_info = sr_shmsub_rpc_listen_process_rpc_events(&subscription->rpc_subs[i], subscription->conn))) {
+        if ((err_info = sr_shmsub_rpc_listen_process_rpc_events(&subscription->rpc_subs[i], subscription))) {
             goto cleanup_unlock;
         }
     }
@@ -3030,6 +3545,37 @@ cleanup_unlock:
     return sr_api_ret(session, err_info);
 }
 
+API int
+sr_subscription_set_workers(sr_subscription_ctx_t *subscription, uint32_t worker_count)
+{
+    sr_error_info_t *err_info = NULL;
+    sr_workers_t *workers = NULL;
+
+    SR_CHECK_ARG_APIRET(!subscription, NULL, err_info);
+
+    if (worker_count > 1) {
+        /* the processing thread is one of the workers */
+        if ((err_info = sr_workers_new(worker_count - 1, &workers))) {
+            return sr_api_ret(NULL, err_info);
+        }
+    }
+
+    /* SUBS LOCK */
+    if ((err_info = sr_mlock(&subscription->subs_lock, SR_SUB_SUBS_LOCK_TIMEOUT, __func__))) {
+        sr_workers_free(workers);
+        return sr_api_ret(NULL, err_info);
+    }
+
+    /* swap the worker pools */
+    sr_workers_free(subscription->workers);
+    subscription->workers = workers;
+
+    /* SUBS UNLOCK */
+    sr_munlock(&subscription->subs_lock);
+
+    return sr_api_ret(NULL, NULL);
+}
+
 /**
  * @brief Unlocked unsubscribe (free) a subscription.
  *
@@ -3059,6 +3605,9 @@ _sr_unsubscribe(sr_subscription_ctx_t *subscription)
                 sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Joining the subscriber thread failed (%s).", strerror(ret));
             }
         }
+    } else if (subscription->dispatched) {
+        /* stop the event dispatcher from handling it */
+        sr_shmsub_dispatch_del(subscription);
     }
 
     /* delete all subscriptions (also removes this subscription from all the sessions) */
@@ -3089,6 +3638,8 @@ _sr_unsubscribe(sr_subscription_ctx_t *subscription)
     }
 
     /* free attributes */
+    sr_workers_free(subscription->workers);
+    sr_subs_cb_sess_free(subscription);
     close(subscription->evpipe);
     pthread_mutex_destroy(&subscription->subs_lock);
     free(subscription);
@@ -3192,6 +3743,8 @@ sr_module_change_subscribe_running_enable(sr_session_ctx_t *session, const struc
     tmp_sess.conn = session->conn;
     tmp_sess.ds = mod_info.ds;
     tmp_sess.dt[tmp_sess.ds].diff = mod_info.diff;
+    /* the diff is owned by mod_info */
+    tmp_sess.dt[tmp_sess.ds].diff_shared = 1;
 
     if (!(opts & SR_SUBSCR_DONE_ONLY)) {
         tmp_sess.ev = SR_SUB_EV_ENABLED;
@@ -3205,6 +3758,7 @@ sr_module_change_subscribe_running_enable(sr_session_ctx_t *session, const struc
             if (tmp_sess.err_info && (tmp_sess.err_info->err_code == SR_ERR_OK)) {
                 /* remember callback error info */
                 sr_errinfo_merge(&err_info, tmp_sess.err_info);
+                tmp_sess.err_info = NULL;
             }
             goto cleanup_mods_unlock;
         }
@@ -3221,6 +3775,8 @@ cleanup_mods_unlock:
     /* MODULES UNLOCK */
     sr_shmmod_modinfo_unlock(&mod_info, 0);
 
+    /* free the diff index created by the callbacks */
+    sr_clear_sess(&tmp_sess);
     sr_modinfo_free(&mod_info);
     return err_info;
 }
@@ -3281,6 +3837,13 @@ sr_subs_new(sr_conn_ctx_t *conn, sr_subscr_options_t opts, sr_subscription_ctx_t
     }
 
     if (!(opts & SR_SUBSCR_NO_THREAD)) {
+        /* let the event dispatcher handle it, if running */
+        if ((err_info = sr_shmsub_dispatch_add(*subs_p, &(*subs_p)->dispatched))) {
+            goto error;
+        }
+    }
+
+    if (!(opts & SR_SUBSCR_NO_THREAD) && !(*subs_p)->dispatched) {
         /* set thread_running to non-zero so that thread does not immediately quit */
         ATOMIC_STORE_RELAXED((*subs_p)->thread_running, 1);
 
@@ -3442,8 +4005,29 @@ sr_get_changes_iter(sr_session_ctx_t *session, const char *xpath, sr_change_iter
         return sr_api_ret(session, err_info);
     }
 
+    (*iter)->set = NULL;
     if (session->dt[session->ds].diff) {
-        (*iter)->set = lyd_find_path(session->dt[session->ds].diff, xpath);
+        /* index the diff only once for all the iterators of this event */
+        if ((!session->dt[session->ds].diff_idx || !session->dt[session->ds].diff_idx->indexed)
+                && (err_info = sr_diff_index(session->dt[session->ds].diff, session->dt[session->ds].diff_view,
+                &session->dt[session->ds].diff_idx))) {
+            goto error;
+        }
+
+        /* try to select the changes using the index */
+        if ((err_info = sr_diff_index_find(session->dt[session->ds].diff_idx, session->conn->ly_ctx, xpath,
+                &(*iter)->set))) {
+            goto error;
+        }
+
+        if (!(*iter)->set) {
+            /* generic XPath */
+            (*iter)->set = lyd_find_path(session->dt[session->ds].diff, xpath);
+            if ((*iter)->set && session->dt[session->ds].diff_view) {
+                /* only changes visible in this session */
+                sr_diff_view_filter(session->dt[session->ds].diff_view, (*iter)->set);
+            }
+        }
     } else {
         (*iter)->set = ly_set_new();
     }
@@ -3690,7 +4274,7 @@ sr_get_change_next(sr_session_ctx_t *session, sr_change_iter_t *iter, sr_change_
     const char *attr_name;
     sr_change_oper_t op;
 
-    SR_CHECK_ARG_APIRET(!session || !iter || !operation || !old_value || !new_value, session, err_info);
+    SR_CHECK_ARG_APIRET(!session || !iter || !operation || (!old_value != !new_value), session, err_info);
 
     /* get next change */
     if ((err_info = sr_diff_set_getnext(iter->set, &iter->idx, &node, &op))) {
@@ -3702,6 +4286,12 @@ sr_get_change_next(sr_session_ctx_t *session, sr_change_iter_t *iter, sr_change_
         return SR_ERR_NOT_FOUND;
     }
 
+    if (!old_value) {
+        /* only the operation was requested, do not create any values */
+        *operation = op;
+        return sr_api_ret(session, NULL);
+    }
+
     /* create values */
     switch (op) {
     case SR_OP_DELETED:
@@ -3794,11 +4384,14 @@ sr_get_change_tree_next(sr_session_ctx_t *session, sr_change_iter_t *iter, sr_ch
     struct lyd_attr *attr, *attr2;
     const char *attr_name;
 
-    SR_CHECK_ARG_APIRET(!session || !iter || !operation || !node || !prev_value || !prev_list || !prev_dflt, session, err_info);
+    SR_CHECK_ARG_APIRET(!session || !iter || !operation || !node || ((prev_value || prev_list || prev_dflt)
+            && (!prev_value || !prev_list || !prev_dflt)), session, err_info);
 
-    *prev_value = NULL;
-    *prev_list = NULL;
-    *prev_dflt = 0;
+    if (prev_value) {
+        *prev_value = NULL;
+        *prev_list = NULL;
+        *prev_dflt = 0;
+    }
 
     /* get next change */
     if ((err_info = sr_diff_set_getnext(iter->set, &iter->idx, (struct lyd_node **)node, operation))) {
@@ -3810,6 +4403,11 @@ sr_get_change_tree_next(sr_session_ctx_t *session, sr_change_iter_t *iter, sr_ch
         return SR_ERR_NOT_FOUND;
     }
 
+    if (!prev_value) {
+        /* only the node and operation were requested */
+        return sr_api_ret(session, NULL);
+    }
+
     /* create values */
     switch (*operation) {
     case SR_OP_DELETED:
@@ -4104,26 +4702,27 @@ cleanup:
     return sr_api_ret(session, err_info);
 }
 
-API int
-sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t timeout_ms, struct lyd_node **output)
+/**
+ * @brief Send an RPC/action and wait for the result. Session error information is not touched.
+ *
+ * @param[in] session Session to use.
+ * @param[in] input Input data tree.
+ * @param[in] timeout_ms RPC/action callback timeout in milliseconds.
+ * @param[out] output Output data tree.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+_sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t timeout_ms, struct lyd_node **output)
 {
     sr_error_info_t *err_info = NULL, *cb_err_info = NULL;
     struct sr_mod_info_s mod_info;
     struct lyd_node *input_op;
     sr_mod_data_dep_t *shm_deps;
     uint16_t shm_dep_count;
+    uint8_t *oper_sub_req = NULL;
     char *op_path = NULL, *str;
     uint32_t event_id = 0;
 
-    SR_CHECK_ARG_APIRET(!session || !input || !output, session, err_info);
-    if (session->conn->ly_ctx != input->schema->module->ctx) {
-        sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Data trees must be created using the session connection libyang context.");
-        return sr_api_ret(session, err_info);
-    }
-
-    if (!timeout_ms) {
-        timeout_ms = SR_RPC_CB_TIMEOUT;
-    }
     *output = NULL;
     memset(&mod_info, 0, sizeof mod_info);
 
@@ -4140,7 +4739,7 @@ sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t tim
         /* find the action */
         input_op = input;
         if ((err_info = sr_ly_find_last_parent(&input_op, LYS_ACTION))) {
-            return sr_api_ret(session, err_info);
+            return err_info;
         }
         if (input_op->schema->nodetype == LYS_ACTION) {
             break;
@@ -4148,12 +4747,12 @@ sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t tim
         /* fallthrough */
     default:
         sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Provided input is not a valid RPC or action invocation.");
-        return sr_api_ret(session, err_info);
+        return err_info;
     }
 
     /* SHM LOCK */
     if ((err_info = sr_shmmain_lock_remap(session->conn, SR_LOCK_READ, 0, 0))) {
-        return sr_api_ret(session, err_info);
+        return err_info;
     }
 
     /* check read perm */
@@ -4181,7 +4780,10 @@ sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t tim
         goto cleanup_mods_unlock;
     }
 
-    /* load all input dependency modules data */
+    /* load all input dependency modules data, only the referenced subtrees from operational subscribers */
+    if ((err_info = sr_modinfo_op_oper_subs(&mod_info, &shm_deps, &shm_dep_count, 1, &oper_sub_req))) {
+        goto cleanup_mods_unlock;
+    }
     if ((err_info = sr_modinfo_data_load(&mod_info, MOD_INFO_TYPE_MASK, 1, &session->sid, NULL, SR_OPER_CB_TIMEOUT, 0,
             &cb_err_info)) || cb_err_info) {
         goto cleanup_mods_unlock;
@@ -4219,6 +4821,8 @@ sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t tim
     /* collect all required modules for output validation */
     sr_modinfo_free(&mod_info);
     memset(&mod_info, 0, sizeof mod_info);
+    free(oper_sub_req);
+    oper_sub_req = NULL;
     if ((err_info = sr_shmmod_collect_op(session->conn, op_path, *output, 1, &shm_deps, &shm_dep_count, &mod_info))) {
         goto cleanup_shm_unlock;
     }
@@ -4229,6 +4833,9 @@ sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t tim
     }
 
     /* load all output dependency modules data */
+    if ((err_info = sr_modinfo_op_oper_subs(&mod_info, &shm_deps, &shm_dep_count, 1, &oper_sub_req))) {
+        goto cleanup_mods_unlock;
+    }
     if ((err_info = sr_modinfo_data_load(&mod_info, MOD_INFO_TYPE_MASK, 1, &session->sid, NULL, SR_OPER_CB_TIMEOUT, 0,
             &cb_err_info)) || cb_err_info) {
         goto cleanup_mods_unlock;
@@ -4254,6 +4861,7 @@ cleanup_shm_unlock:
     sr_shmmain_unlock(session->conn, SR_LOCK_READ, 0, 0);
 
     free(op_path);
+    free(oper_sub_req);
     sr_modinfo_free(&mod_info);
     if (cb_err_info) {
         /* return callback error if some was generated */
@@ -4265,6 +4873,151 @@ cleanup_shm_unlock:
         lyd_free_withsiblings(*output);
         *output = NULL;
     }
+    return err_info;
+}
+
+API int
+sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t timeout_ms, struct lyd_node **output)
+{
+    sr_error_info_t *err_info = NULL;
+
+    SR_CHECK_ARG_APIRET(!session || !input || !output, session, err_info);
+    if (session->conn->ly_ctx != input->schema->module->ctx) {
+        sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Data trees must be created using the session connection libyang context.");
+        return sr_api_ret(session, err_info);
+    }
+
+    if (!timeout_ms) {
+        timeout_ms = SR_RPC_CB_TIMEOUT;
+    }
+
+    err_info = _sr_rpc_send_tree(session, input, timeout_ms, output);
+    return sr_api_ret(session, err_info);
+}
+
+/**
+ * @brief Thread sending queued asynchronous RPCs/actions. It ends once there are no more requests.
+ *
+ * @param[in] arg Unused.
+ * @return Always NULL.
+ */
+static void *
+sr_rpc_async_thread(void *arg)
+{
+    sr_error_info_t *err_info;
+    struct sr_rpc_async_req_s *req;
+    struct lyd_node *output;
+
+    (void)arg;
+
+    /* ASYNC LOCK */
+    pthread_mutex_lock(&sr_rpc_async.lock);
+
+    while ((req = sr_rpc_async.first)) {
+        /* dequeue the request */
+        sr_rpc_async.first = req->next;
+        if (!sr_rpc_async.first) {
+            sr_rpc_async.last = NULL;
+        }
+
+        /* ASYNC UNLOCK */
+        pthread_mutex_unlock(&sr_rpc_async.lock);
+
+        /* send the RPC/action and report the result */
+        err_info = _sr_rpc_send_tree(req->session, req->input, req->timeout_ms, &output);
+        req->cb(req->session, err_info, output, req->private_data);
+
+        sr_errinfo_free(&err_info);
+        for (; output && output->parent; output = output->parent);
+        lyd_free_withsiblings(output);
+        for (; req->input->parent; req->input = req->input->parent);
+        lyd_free_withsiblings(req->input);
+
+        /* ASYNC LOCK */
+        pthread_mutex_lock(&sr_rpc_async.lock);
+
+        /* the request is finished */
+        --req->session->rpc_async_count;
+        pthread_cond_broadcast(&sr_rpc_async.cond);
+        free(req);
+    }
+
+    /* no more requests */
+    --sr_rpc_async.thread_count;
+
+    /* ASYNC UNLOCK */
+    pthread_mutex_unlock(&sr_rpc_async.lock);
+    return NULL;
+}
+
+API int
+sr_rpc_send_async(sr_session_ctx_t *session, struct lyd_node *input, uint32_t timeout_ms, sr_rpc_async_cb callback,
+        void *private_data)
+{
+    sr_error_info_t *err_info = NULL;
+    struct sr_rpc_async_req_s *req;
+    pthread_t tid;
+    int ret;
+
+    SR_CHECK_ARG_APIRET(!session || !input || !callback, session, err_info);
+    if (session->conn->ly_ctx != input->schema->module->ctx) {
+        sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Data trees must be created using the session connection libyang context.");
+        return sr_api_ret(session, err_info);
+    }
+
+    if (!timeout_ms) {
+        timeout_ms = SR_RPC_CB_TIMEOUT;
+    }
+
+    /* prepare the request */
+    req = calloc(1, sizeof *req);
+    SR_CHECK_MEM_GOTO(!req, err_info, cleanup);
+    req->input = lyd_dup(input, LYD_DUP_OPT_RECURSIVE | LYD_DUP_OPT_WITH_PARENTS);
+    if (!req->input) {
+        sr_errinfo_new_ly(&err_info, session->conn->ly_ctx);
+        free(req);
+        goto cleanup;
+    }
+    req->session = session;
+    req->timeout_ms = timeout_ms;
+    req->cb = callback;
+    req->private_data = private_data;
+
+    /* ASYNC LOCK */
+    pthread_mutex_lock(&sr_rpc_async.lock);
+
+    /* enqueue it */
+    if (sr_rpc_async.last) {
+        sr_rpc_async.last->next = req;
+    } else {
+        sr_rpc_async.first = req;
+    }
+    sr_rpc_async.last = req;
+    ++session->rpc_async_count;
+
+    /* all the running threads are busy, start a new one if allowed */
+    if (sr_rpc_async.thread_count < SR_RPC_ASYNC_THREAD_COUNT) {
+        ret = pthread_create(&tid, NULL, sr_rpc_async_thread, NULL);
+        if (!ret) {
+            pthread_detach(tid);
+            ++sr_rpc_async.thread_count;
+        } else if (!sr_rpc_async.thread_count) {
+            /* there is no thread to send the request, it must be the only one */
+            assert(sr_rpc_async.first == req);
+            sr_rpc_async.first = NULL;
+            sr_rpc_async.last = NULL;
+            --session->rpc_async_count;
+            for (; req->input->parent; req->input = req->input->parent);
+            lyd_free_withsiblings(req->input);
+            free(req);
+            sr_errinfo_new(&err_info, SR_ERR_SYS, NULL, "Creating a new thread failed (%s).", strerror(ret));
+        }
+    }
+
+    /* ASYNC UNLOCK */
+    pthread_mutex_unlock(&sr_rpc_async.lock);
+
+cleanup:
     return sr_api_ret(session, err_info);
 }
 
@@ -4525,67 +5278,122 @@ cleanup:
 API int
 sr_event_notif_send_tree(sr_session_ctx_t *session, struct lyd_node *notif)
 {
-    sr_error_info_t *err_info = NULL, *cb_err_info = NULL, *tmp_err_info = NULL;
-    struct sr_mod_info_s mod_info;
-    struct lyd_node *notif_op;
-    sr_mod_data_dep_t *shm_deps;
-    sr_mod_t *shm_mod;
-    time_t notif_ts;
-    uint16_t shm_dep_count;
-    sr_mod_notif_sub_t *notif_subs;
-    uint32_t notif_sub_count;
-    char *xpath = NULL;
+    sr_error_info_t *err_info = NULL;
 
     SR_CHECK_ARG_APIRET(!session || !notif, session, err_info);
-    if (session->conn->ly_ctx != notif->schema->module->ctx) {
-        sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Data trees must be created using the session connection libyang context.");
-        return sr_api_ret(session, err_info);
-    }
 
-    memset(&mod_info, 0, sizeof mod_info);
+    return sr_event_notif_send_batch(session, &notif, 1);
+}
 
-    /* remember when the notification was generated */
-    notif_ts = time(NULL);
+/**
+ * @brief Find the notification in a notification data tree.
+ *
+ * @param[in] notif Notification data tree, any of its nodes.
+ * @param[out] notif_root Top-level node of the notification tree.
+ * @param[out] notif_op Notification node.
+ * @return err_info, NULL on success.
+ */
+static sr_error_info_t *
+sr_event_notif_find_op(struct lyd_node *notif, struct lyd_node **notif_root, struct lyd_node **notif_op)
+{
+    sr_error_info_t *err_info = NULL;
 
-    /* check notif data tree */
     switch (notif->schema->nodetype) {
     case LYS_NOTIF:
-        for (notif_op = notif; notif->parent; notif = notif->parent);
-        break;
+        for (*notif_op = notif; notif->parent; notif = notif->parent);
+        *notif_root = notif;
+        return NULL;
     case LYS_CONTAINER:
     case LYS_LIST:
         /* find the notification */
-        notif_op = notif;
-        if ((err_info = sr_ly_find_last_parent(&notif_op, LYS_NOTIF))) {
-            return sr_api_ret(session, err_info);
+        *notif_op = notif;
+        if ((err_info = sr_ly_find_last_parent(notif_op, LYS_NOTIF))) {
+            return err_info;
         }
-        if (notif_op->schema->nodetype == LYS_NOTIF) {
-            break;
+        if ((*notif_op)->schema->nodetype == LYS_NOTIF) {
+            *notif_root = notif;
+            return NULL;
         }
         /* fallthrough */
     default:
         sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Provided tree is not a valid notification invocation.");
-        return sr_api_ret(session, err_info);
+        return err_info;
+    }
+}
+
+API int
+sr_event_notif_send_batch(sr_session_ctx_t *session, struct lyd_node **notifs, uint32_t notif_count)
+{
+    sr_error_info_t *err_info = NULL, *cb_err_info = NULL, *tmp_err_info = NULL;
+    struct sr_mod_info_s mod_info;
+    struct lyd_node **notif_roots = NULL, **notif_ops = NULL;
+    sr_mod_data_dep_t **shm_deps = NULL;
+    const struct lys_module *ly_mod;
+    sr_mod_t *shm_mod;
+    time_t notif_ts;
+    uint16_t *shm_dep_counts = NULL;
+    uint8_t *oper_sub_req = NULL;
+    sr_mod_notif_sub_t *notif_subs;
+    uint32_t notif_sub_count, mod_notif_count, i, j;
+    char *xpath = NULL, **notif_lybs = NULL, **mod_notif_lybs = NULL;
+
+    SR_CHECK_ARG_APIRET(!session || !notifs || !notif_count, session, err_info);
+
+    memset(&mod_info, 0, sizeof mod_info);
+
+    /* remember when the notifications were generated */
+    notif_ts = time(NULL);
+
+    notif_roots = malloc(notif_count * sizeof *notif_roots);
+    notif_ops = malloc(notif_count * sizeof *notif_ops);
+    notif_lybs = calloc(notif_count, sizeof *notif_lybs);
+    mod_notif_lybs = malloc(notif_count * sizeof *mod_notif_lybs);
+    shm_deps = malloc(notif_count * sizeof *shm_deps);
+    shm_dep_counts = malloc(notif_count * sizeof *shm_dep_counts);
+    SR_CHECK_MEM_GOTO(!notif_roots || !notif_ops || !notif_lybs || !mod_notif_lybs || !shm_deps || !shm_dep_counts,
+            err_info, cleanup);
+
+    /* check notif data trees */
+    for (i = 0; i < notif_count; ++i) {
+        if (!notifs[i]) {
+            sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Invalid arguments for function \"%s\".", __func__);
+            goto cleanup;
+        }
+        if (session->conn->ly_ctx != notifs[i]->schema->module->ctx) {
+            sr_errinfo_new(&err_info, SR_ERR_INVAL_ARG, NULL, "Data trees must be created using the session connection libyang context.");
+            goto cleanup;
+        }
+        if ((err_info = sr_event_notif_find_op(notifs[i], &notif_roots[i], &notif_ops[i]))) {
+            goto cleanup;
+        }
     }
 
     /* SHM LOCK */
     if ((err_info = sr_shmmain_lock_remap(session->conn, SR_LOCK_READ, 0, 0))) {
-        return sr_api_ret(session, err_info);
+        goto cleanup;
     }
 
-    /* check write/read perm */
-    shm_mod = sr_shmmain_find_module(&session->conn->main_shm, session->conn->ext_shm.addr, lyd_node_module(notif)->name, 0);
-    SR_CHECK_INT_GOTO(!shm_mod, err_info, cleanup_shm_unlock);
-    if ((err_info = sr_perm_check(lyd_node_module(notif)->name, (shm_mod->flags & SR_MOD_REPLAY_SUPPORT) ? 1 : 0))) {
-        goto cleanup_shm_unlock;
-    }
+    for (i = 0; i < notif_count; ++i) {
+        ly_mod = lyd_node_module(notif_roots[i]);
+        if (!i || (ly_mod != lyd_node_module(notif_roots[i - 1]))) {
+            /* check write/read perm */
+            shm_mod = sr_shmmain_find_module(&session->conn->main_shm, session->conn->ext_shm.addr, ly_mod->name, 0);
+            SR_CHECK_INT_GOTO(!shm_mod, err_info, cleanup_shm_unlock);
+            if ((err_info = sr_perm_check(ly_mod->name, (shm_mod->flags & SR_MOD_REPLAY_SUPPORT) ? 1 : 0))) {
+                goto cleanup_shm_unlock;
+            }
+        }
 
-    /* collect all required modules for validation (including checking that the nested notification
-     * can be invoked meaning its parent data node exists) */
-    xpath = lys_data_path(notif_op->schema);
-    SR_CHECK_MEM_GOTO(!xpath, err_info, cleanup_shm_unlock);
-    if ((err_info = sr_shmmod_collect_op(session->conn, xpath, notif_op, 0, &shm_deps, &shm_dep_count, &mod_info))) {
-        goto cleanup_shm_unlock;
+        /* collect all required modules for validation (including checking that the nested notification
+         * can be invoked meaning its parent data node exists), for all the notifications together */
+        xpath = lys_data_path(notif_ops[i]->schema);
+        SR_CHECK_MEM_GOTO(!xpath, err_info, cleanup_shm_unlock);
+        if ((err_info = sr_shmmod_collect_op(session->conn, xpath, notif_ops[i], 0, &shm_deps[i], &shm_dep_counts[i],
+                &mod_info))) {
+            goto cleanup_shm_unlock;
+        }
+        free(xpath);
+        xpath = NULL;
     }
 
     /* MODULES READ LOCK */
@@ -4593,39 +5401,79 @@ sr_event_notif_send_tree(sr_session_ctx_t *session, struct lyd_node *notif)
         goto cleanup_mods_unlock;
     }
 
-    /* load all input dependency modules data */
+    /* load all input dependency modules data, only once and only the referenced subtrees from operational subscribers */
+    if ((err_info = sr_modinfo_op_oper_subs(&mod_info, shm_deps, shm_dep_counts, notif_count, &oper_sub_req))) {
+        goto cleanup_mods_unlock;
+    }
     if ((err_info = sr_modinfo_data_load(&mod_info, MOD_INFO_TYPE_MASK, 1, &session->sid, NULL, SR_OPER_CB_TIMEOUT, 0,
             &cb_err_info)) || cb_err_info) {
         goto cleanup_mods_unlock;
     }
 
-    /* validate the operation */
-    if ((err_info = sr_modinfo_op_validate(&mod_info, notif_op, shm_deps, shm_dep_count, 0, &session->sid,
-            SR_OPER_CB_TIMEOUT, &cb_err_info))) {
-        goto cleanup_mods_unlock;
-    }
-    if (cb_err_info) {
-        goto cleanup_mods_unlock;
+    /* validate the operations, nothing is sent if any of them is invalid */
+    for (i = 0; i < notif_count; ++i) {
+        if ((err_info = sr_modinfo_op_validate(&mod_info, notif_ops[i], shm_deps[i], shm_dep_counts[i], 0, &session->sid,
+                SR_OPER_CB_TIMEOUT, &cb_err_info))) {
+            goto cleanup_mods_unlock;
+        }
+        if (cb_err_info) {
+            goto cleanup_mods_unlock;
+        }
     }
 
     /* MODULES UNLOCK */
     sr_shmmod_modinfo_unlock(&mod_info, 0);
 
-    /* store the notification for a replay, we continue on failure */
-    err_info = sr_replay_store(session, notif, notif_ts);
+    /* print each notification only once, the same LYB is stored for replay and published to subscribers */
+    for (i = 0; i < notif_count; ++i) {
+        if (lyd_print_mem(&notif_lybs[i], notif_roots[i], LYD_LYB, 0)) {
+            sr_errinfo_new_ly(&err_info, session->conn->ly_ctx);
+            goto cleanup_shm_unlock;
+        }
+    }
 
-    /* check that there is a subscriber */
-    if ((tmp_err_info = sr_notif_find_subscriber(session->conn, lyd_node_module(notif)->name, &notif_subs, &notif_sub_count))) {
-        goto cleanup_shm_unlock;
+    /* store the notifications for a replay, we continue on failure */
+    for (i = 0; i < notif_count; ++i) {
+        if ((tmp_err_info = sr_replay_store(session, notif_roots[i], notif_lybs[i], notif_ts))) {
+            sr_errinfo_merge(&err_info, tmp_err_info);
+            tmp_err_info = NULL;
+        }
     }
 
-    if (notif_sub_count) {
-        /* publish notif in an event, do not wait for subscribers */
-        if ((tmp_err_info = sr_shmsub_notif_notify(notif, notif_ts, session->sid, (uint32_t *)notif_subs, notif_sub_count))) {
+    /* publish the notifications of each module in a single event, keeping their order */
+    for (i = 0; i < notif_count; ++i) {
+        ly_mod = lyd_node_module(notif_roots[i]);
+        for (j = 0; j < i; ++j) {
+            if (lyd_node_module(notif_roots[j]) == ly_mod) {
+                break;
+            }
+        }
+        if (j < i) {
+            /* already published */
+            continue;
+        }
+
+        /* check that there is a subscriber */
+        if ((tmp_err_info = sr_notif_find_subscriber(session->conn, ly_mod->name, &notif_subs, &notif_sub_count))) {
+            goto cleanup_shm_unlock;
+        }
+        if (!notif_sub_count) {
+            SR_LOG_INF("There are no subscribers for \"%s\" notifications.", ly_mod->name);
+            continue;
+        }
+
+        mod_notif_count = 0;
+        for (j = i; j < notif_count; ++j) {
+            if (lyd_node_module(notif_roots[j]) == ly_mod) {
+                mod_notif_lybs[mod_notif_count++] = notif_lybs[j];
+            }
+        }
+
+        /* publish notifs in an event, do not wait for subscribers */
+        if ((tmp_err_info = sr_shmsub_notif_notify(ly_mod, mod_notif_lybs, mod_notif_count, notif_ts, session->sid,
+                (uint32_t *)notif_subs, notif_sub_count))) {
             goto cleanup_shm_unlock;
         }
-    } else {
-        SR_LOG_INF("There are no subscribers for \"%s\" notifications.", lyd_node_module(notif)->name);
     }
 
     /* success */
@@ -4639,7 +5487,20 @@ cleanup_shm_unlock:
     /* SHM UNLOCK */
     sr_shmmain_unlock(session->conn, SR_LOCK_READ, 0, 0);
 
+cleanup:
     free(xpath);
+    free(notif_roots);
+    free(notif_ops);
+    if (notif_lybs) {
+        for (i = 0; i < notif_count; ++i) {
+            free(notif_lybs[i]);
+        }
+        free(notif_lybs);
+    }
+    free(mod_notif_lybs);
+    free(shm_deps);
+    free(shm_dep_counts);
+    free(oper_sub_req);
     sr_modinfo_free(&mod_info);
     if (tmp_err_info) {
         sr_errinfo_merge(&err_info, tmp_err_info);
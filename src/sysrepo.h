@@ -520,6 +520,21 @@ int sr_cancel_update_module(sr_conn_ctx_t *conn, const char *module_name);
  */
 int sr_set_module_replay_support(sr_conn_ctx_t *conn, const char *module_name, int replay_support);
 
+/**
+ * @brief Change module subtree lock. Running datastore changes (::sr_apply_changes) of separate instances
+ * of the top-level list are then WRITE-locked separately instead of the whole module so that they can be
+ * applied concurrently. Changes of any other data of the module still lock the whole module as do changes
+ * of modules whose data are referenced by other modules.
+ *
+ * Required WRITE access.
+ *
+ * @param[in] conn Connection to use.
+ * @param[in] module_name Name of the module to change.
+ * @param[in] list_name Name of a top-level configuration list of the module, NULL to lock only the whole module.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_set_module_subtree_lock(sr_conn_ctx_t *conn, const char *module_name, const char *list_name);
+
 /**
  * @brief Change module filesystem permissions.
  *
@@ -738,6 +753,27 @@ int sr_get_item(sr_session_ctx_t *session, const char *path, uint32_t timeout_ms
  */
 int sr_get_items(sr_session_ctx_t *session, const char *xpath, uint32_t timeout_ms, sr_val_t **values, size_t *value_cnt);
 
+/**
+ * @brief Retrieve an array of data elements selected by the provided XPath, same as ::sr_get_items.
+ * The difference is that the whole result, including all the xpaths and string values, is stored
+ * in a single memory block, which is cheaper both to create and to free for large results.
+ *
+ * The returned array must not be modified by ::sr_realloc_values and must be freed
+ * using ::sr_free_values_arena (never ::sr_free_values). Use ::sr_dup_values to get
+ * a standard array if needed.
+ *
+ * Required READ access.
+ *
+ * @param[in] session Session ([DS](@ref sr_datastore_t)-specific) to use.
+ * @param[in] xpath [XPath](@ref paths) of the data elements to be retrieved.
+ * @param[in] timeout_ms Operational callback timeout in milliseconds. If 0, default is used.
+ * @param[out] values Array of requested nodes, allocated in one block (free using ::sr_free_values_arena).
+ * @param[out] value_cnt Number of returned elements in the values array.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_get_items_arena(sr_session_ctx_t *session, const char *xpath, uint32_t timeout_ms, sr_val_t **values,
+        size_t *value_cnt);
+
 /**
  * @brief Retrieve a single subtree whose root node is selected by the provided path.
  * Data are represented as _libyang_ subtrees.
@@ -784,6 +820,53 @@ int sr_get_subtree(sr_session_ctx_t *session, const char *path, uint32_t timeout
 int sr_get_data(sr_session_ctx_t *session, const char *xpath, uint32_t max_depth, uint32_t timeout_ms,
         const sr_get_oper_options_t opts, struct lyd_node **data);
 
+/**
+ * @brief Prepared get query, see ::sr_prepare_query.
+ */
+typedef struct sr_query_s sr_query_t;
+
+/**
+ * @brief Prepare a get query for repeated execution by ::sr_get_data_prepared.
+ *
+ * All the work depending only on the XPath is performed once - the modules it selects are resolved with all
+ * their dependencies and it is remembered which operational subscriptions may provide data for it. The query
+ * is bound to the connection and datastore of the session. Whenever operational subscriptions
+ * of the selected modules change, the affected cached information is refreshed on the next execution.
+ *
+ * A prepared query must not be executed from several threads at once.
+ *
+ * @param[in] session Session ([DS](@ref sr_datastore_t)-specific) to use.
+ * @param[in] xpath [XPath](@ref paths) selecting root nodes of subtrees to be retrieved.
+ * @param[out] query Prepared query, free with ::sr_query_free.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_prepare_query(sr_session_ctx_t *session, const char *xpath, sr_query_t **query);
+
+/**
+ * @brief Execute a query prepared by ::sr_prepare_query. Semantics are the same as of ::sr_get_data.
+ *
+ * Required READ access.
+ *
+ * @param[in] session Session to use, must be created on the same connection and use the same datastore
+ * as the one used for preparing the query.
+ * @param[in] query Prepared query.
+ * @param[in] max_depth Maximum depth of the selected subtrees. 0 is unlimited, 1 will not return any
+ * descendant nodes. If a list should be returned, its keys are always returned as well.
+ * @param[in] timeout_ms Operational callback timeout in milliseconds. If 0, default is used.
+ * @param[in] opts Options overriding default get behaviour.
+ * @param[out] data Connected top-level trees with all the requested data, allocated dynamically.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_get_data_prepared(sr_session_ctx_t *session, sr_query_t *query, uint32_t max_depth, uint32_t timeout_ms,
+        const sr_get_oper_options_t opts, struct lyd_node **data);
+
+/**
+ * @brief Free a prepared query.
+ *
+ * @param[in] query Prepared query to free.
+ */
+void sr_query_free(sr_query_t *query);
+
 /**
  * @brief Free ::sr_val_t structure and all memory allocated within it.
  *
@@ -800,6 +883,14 @@ void sr_free_val(sr_val_t *value);
  */
 void sr_free_values(sr_val_t *values, size_t count);
 
+/**
+ * @brief Free array of ::sr_val_t structures returned by ::sr_get_items_arena.
+ *
+ * @param[in] values Array of values to be freed.
+ * @param[in] count Number of elements stored in the array.
+ */
+void sr_free_values_arena(sr_val_t *values, size_t count);
+
 /** @} getdata */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -929,6 +1020,35 @@ int sr_move_item(sr_session_ctx_t *session, const char *path, const sr_move_posi
  */
 int sr_edit_batch(sr_session_ctx_t *session, const struct lyd_node *edit, const char *default_operation);
 
+/**
+ * @brief Single change of a bulk edit, see ::sr_edit_bulk.
+ */
+typedef struct sr_edit_entry_s {
+    const char *xpath;          /**< [Path](@ref paths) identifier of the data element. */
+    const char *value;          /**< String representation of the value to be set, ignored for deletes. */
+    int del;                    /**< If set, the data element is deleted as by ::sr_delete_item, otherwise it is set
+                                     as by ::sr_set_item_str. */
+    sr_edit_options_t opts;     /**< Options overriding default behavior of this change. */
+} sr_edit_entry_t;
+
+/**
+ * @brief Prepare to set or delete several data elements at once.
+ * These changes are applied only after calling ::sr_apply_changes.
+ *
+ * Every change has the same semantics as if ::sr_set_item_str or ::sr_delete_item was called for it,
+ * but the edit is built in one pass. If the changes are sorted so that paths with a common prefix
+ * follow each other, the common parent nodes are not resolved again for every change, which
+ * makes this function much more efficient than many separate calls when preparing large edits.
+ * If any of the changes fails, none of them are added and the previous session changes are kept.
+ *
+ * @param[in] session Session ([DS](@ref sr_datastore_t)-specific) to use.
+ * @param[in] entries Array of changes, preferably sorted by their paths.
+ * @param[in] entry_cnt Number of changes in \p entries.
+ * @param[in] origin Origin of the values, used only for ::SR_DS_OPERATIONAL edits.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_edit_bulk(sr_session_ctx_t *session, const sr_edit_entry_t *entries, size_t entry_cnt, const char *origin);
+
 /**
  * @brief Perform the validation a datastore and any changes made in the current session, but do not
  * apply nor discard them.
@@ -1183,6 +1303,46 @@ int sr_get_event_pipe(sr_subscription_ctx_t *subscription, int *event_pipe);
  */
 int sr_process_events(sr_subscription_ctx_t *subscription, sr_session_ctx_t *session, time_t *stop_time_in);
 
+/**
+ * @brief Start a process-wide event dispatcher. All the subscriptions subsequently created without
+ * ::SR_SUBSCR_NO_THREAD flag will then be handled by a pool of dispatcher threads instead of each
+ * having its own listening thread. Useful for processes with many subscriptions, such as plugin daemons.
+ *
+ * When all the dispatcher threads are executing callbacks, another thread is temporarily added so that
+ * a callback can wait for another local subscription (when applying changes, getting operational data,
+ * or sending an RPC/action).
+ *
+ * @param[in] thread_count Number of dispatcher threads.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_dispatcher_start(uint32_t thread_count);
+
+/**
+ * @brief Stop the process-wide event dispatcher. All the subscriptions handled by it
+ * must have been unsubscribed before.
+ *
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_dispatcher_stop(void);
+
+/**
+ * @brief Set the number of threads processing module change callbacks of a subscription in parallel.
+ *
+ * If there are several module change subscriptions of a single module, datastore, and priority in this
+ * subscription context, all of their callbacks for a single event are called concurrently by up to
+ * `worker_count` threads (including the thread processing the events). Results are then evaluated
+ * in the same order as when called sequentially and the priority ordering is preserved. The only difference
+ * is that if a ::SR_EV_CHANGE callback fails, all the other callbacks of the same priority have already
+ * been called and so they get the ::SR_EV_ABORT event. ::SR_EV_UPDATE callbacks are always called sequentially.
+ *
+ * The callbacks must be thread-safe. By default, all callbacks are called sequentially.
+ *
+ * @param[in] subscription Subscription context.
+ * @param[in] worker_count Number of threads calling the callbacks, 0 or 1 to call them sequentially.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_subscription_set_workers(sr_subscription_ctx_t *subscription, uint32_t worker_count);
+
 /**
  * @brief Unsubscribes from a subscription acquired by any of sr_*_subscribe
  * calls and releases all subscription-related data.
@@ -1302,7 +1462,9 @@ int sr_module_change_subscribe(sr_session_ctx_t *session, const char *module_nam
  *
  * @param[in] session Implicit session provided in the callbacks (::sr_module_change_cb). Will not work with other sessions.
  * @param[in] xpath [XPath](@ref paths) selecting the requested changes. Be careful, you must select all the changes,
- * not just subtrees! To get a full change subtree `//.` can be appended to the XPath.
+ * not just subtrees! To get a full change subtree `//.` can be appended to the XPath. The changes are indexed
+ * once per event so simple paths without predicates (such as `/module:*` or `/module:container/list`,
+ * optionally followed by `//.`) are selected without any XPath evaluation.
  * @param[out] iter Iterator context that can be used to retrieve individual changes using
  * ::sr_get_change_next calls. Allocated by the function, should be freed with ::sr_free_change_iter.
  * @return Error code (::SR_ERR_OK on success).
@@ -1323,6 +1485,7 @@ int sr_get_changes_iter(sr_session_ctx_t *session, const char *xpath, sr_change_
  * @param[out] operation Type of the operation made on the returned item.
  * @param[out] old_value Old value of the item (the value before the change).
  * NULL in case that the item has been just created (operation ::SR_OP_CREATED).
+ * If both \p old_value and \p new_value are NULL, no values are created and only the operation is returned.
  * @param[out] new_value New (modified) value of the the item. NULL in case that
  * the item has been just deleted (operation ::SR_OP_DELETED).
  * @return Error code (::SR_ERR_OK on success, ::SR_ERR_NOT_FOUND on no more changes).
@@ -1347,7 +1510,8 @@ int sr_get_change_next(sr_session_ctx_t *session, sr_change_iter_t *iter, sr_cha
  * @param[in,out] iter Iterator acquired with ::sr_get_changes_iter call.
  * @param[out] operation Type of the operation made on the returned item.
  * @param[out] node Affected data node always with all parents, depends on the operation.
- * @param[out] prev_value Previous value, depends on the operation.
+ * @param[out] prev_value Previous value, depends on the operation. If \p prev_value, \p prev_list, and \p prev_dflt
+ * are all NULL, only the node and operation are returned, which is the cheapest way of iterating over changes.
  * @param[out] prev_list Previous list keys predicate (`[key1="val1"][key2="val2"]...`), depends on the operation.
  * @param[out] prev_dflt Previous value default flag, depends on the operation.
  * @return Error code (::SR_ERR_OK on success, ::SR_ERR_NOT_FOUND on no more changes).
@@ -1488,6 +1652,40 @@ int sr_rpc_send(sr_session_ctx_t *session, const char *path, const sr_val_t *inp
  */
 int sr_rpc_send_tree(sr_session_ctx_t *session, struct lyd_node *input, uint32_t timeout_ms, struct lyd_node **output);
 
+/**
+ * @brief Callback to be called when an asynchronously sent RPC/action finishes.
+ *
+ * @note Callback MUST not stop \p session, it would result in a deadlock.
+ *
+ * @param[in] session Session used for sending the RPC/action.
+ * @param[in] err_info Error information if the RPC/action failed, NULL on success.
+ * @param[in] output Output data tree, NULL on error. It is freed after the callback returns.
+ * @param[in] private_data Private context opaque to sysrepo, as passed to ::sr_rpc_send_async call.
+ */
+typedef void (*sr_rpc_async_cb)(sr_session_ctx_t *session, const sr_error_info_t *err_info, const struct lyd_node *output,
+        void *private_data);
+
+/**
+ * @brief Send an RPC/action without waiting for the result. Data are represented as _libyang_ subtrees.
+ *
+ * The RPC/action is sent from a separate thread and several RPCs/actions, even the same ones, can be in flight
+ * at once. Their results are delivered by calling \p callback in the order they finish. ::sr_session_stop
+ * waits for all the RPCs/actions sent on the session to finish.
+ *
+ * Required READ access.
+ *
+ * @note RPC/action must be valid in (is validated against) the [operational datastore](@ref oper_ds) context.
+ *
+ * @param[in] session Session (not [DS](@ref sr_datastore_t)-specific) to use.
+ * @param[in] input Input data tree, it is duplicated so it can be freed right after the call.
+ * @param[in] timeout_ms RPC/action callback timeout in milliseconds. If 0, default is used.
+ * @param[in] callback Callback to be called with the result.
+ * @param[in] private_data Private context passed to the callback function, opaque to sysrepo.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_rpc_send_async(sr_session_ctx_t *session, struct lyd_node *input, uint32_t timeout_ms, sr_rpc_async_cb callback,
+        void *private_data);
+
 /** @} rpcsubs */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1619,6 +1817,25 @@ int sr_event_notif_send(sr_session_ctx_t *session, const char *path, const sr_va
  */
 int sr_event_notif_send_tree(sr_session_ctx_t *session, struct lyd_node *notif);
 
+/**
+ * @brief Send several notifications at once. Data are represented as _libyang_ subtrees. Compared to sending
+ * the notifications one by one, modules are locked and the data required for validation are loaded only once
+ * for the whole batch and all the notifications of a module are delivered to its subscribers in a single event.
+ *
+ * All the notifications are validated first and if any of them is invalid, none are sent. Notifications
+ * of the same module are delivered in the order they are in @p notifs, all with the same timestamp.
+ *
+ * Required WRITE access. If the module does not support replay, required READ access.
+ *
+ * @note Notifications must be valid in (are validated against) the [operational datastore](@ref oper_ds) context.
+ *
+ * @param[in] session Session (not [DS](@ref sr_datastore_t)-specific) to use.
+ * @param[in] notifs Array of notification data trees to send.
+ * @param[in] notif_count Number of notifications in @p notifs.
+ * @return Error code (::SR_ERR_OK on success).
+ */
+int sr_event_notif_send_batch(sr_session_ctx_t *session, struct lyd_node **notifs, uint32_t notif_count);
+
 /** @} notifsubs */
 
 ////////////////////////////////////////////////////////////////////////////////
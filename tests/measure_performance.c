@@ -2,7 +2,7 @@
  * @file measure_performance.c
  * @author Rastislav Szabo <raszabo@cisco.com>, Lukas Macko <lmacko@cisco.com>
  * @author Michal Vasko <mvasko@cesnet.cz>
- * @brief File measure performance of the sysrepo operations
+ * @brief Benchmark of the sysrepo operations with concurrent clients and subscribers
  *
  * @copyright
  * Copyright 2016 Cisco Systems, Inc.
@@ -24,1147 +24,886 @@
 
 #include <stdlib.h>
 #include <stdio.h>
-#include <sys/time.h>
-#include <unistd.h>
+#include <stdint.h>
+#include <inttypes.h>
 #include <string.h>
-#include <setjmp.h>
-#include <cmocka.h>
-#include <stdbool.h>
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
 #include <libyang/libyang.h>
 
 #include "tests/config.h"
 #include "sysrepo.h"
 
-/* Constants defining how many times the operation is performed to compute an average ops/sec */
+/** default number of client processes */
+#define PERF_CLIENTS 1
 
-/**@brief all operations except commit */
-#define OP_COUNT 50000
+/** default number of threads in every client process */
+#define PERF_THREADS 1
 
-/**@brief used with larger data files */
-#define OP_COUNT_LOW 30000
+/** default number of subscriber processes */
+#define PERF_SUBSCRIBERS 1
 
-/**@brief constant for commit operation */
-#define OP_COUNT_COMMIT 1000
+/** default number of list instances in the data */
+#define PERF_ITEMS 100
 
-#define TEST_SCHEMA_SEARCH_DIR "/home/vasko/Documents/sysrepo/build/repository/yang/"
-#define TEST_DATA_PREFIX "/dev/shm/sr_"
-#define SR_RUNNING_FILE_EXT ".running"
-#define EXAMPLE_MODULE_DATA_FILE_NAME TEST_DATA_PREFIX "example-module" SR_RUNNING_FILE_EXT
+/** default number of operations performed by every client thread */
+#define PERF_OPS 1000
 
-int instance_cnt = 1;
+/** timeout for all the processes to get ready and for notifications to be delivered */
+#define PERF_TIMEOUT_MS 30000
 
-/* Computes diff of two timeval structures
- * @see http://www.gnu.org/software/libc/manual/html_node/Elapsed-Time.html
- */
-int
-timeval_subtract (struct timeval *result, struct timeval *x, struct timeval *y)
-{
-    /* Perform the carry for the later subtraction by updating y. */
-    if (x->tv_usec < y->tv_usec) {
-        int nsec = (y->tv_usec - x->tv_usec) / 1000000 + 1;
-        y->tv_usec -= 1000000 * nsec;
-        y->tv_sec += nsec;
-    }
-    if (x->tv_usec - y->tv_usec > 1000000) {
-        int nsec = (x->tv_usec - y->tv_usec) / 1000000;
-        y->tv_usec += 1000000 * nsec;
-        y->tv_sec -= nsec;
-    }
+struct perf_opts {
+    uint32_t clients;
+    uint32_t threads;
+    uint32_t subscribers;
+    uint32_t items;
+    uint32_t ops;
+};
 
-    /* Compute the time remaining to wait.
-     tv_usec is certainly positive. */
-    result->tv_sec = x->tv_sec - y->tv_sec;
-    result->tv_usec = x->tv_usec - y->tv_usec;
+/* memory shared by all the benchmark processes */
+struct perf_shm {
+    uint32_t ready;
+    uint32_t start;
+    uint64_t notif_count;
+    uint64_t errors;
+    uint64_t lat[];
+};
 
-    /* Return 1 if result is negative. */
-    return x->tv_sec < y->tv_sec;
-}
+struct perf_client {
+    sr_session_ctx_t *sess;
+    const struct perf_test *test;
+    const struct perf_opts *opts;
+    struct perf_shm *shm;
+    uint64_t *lat;
+    unsigned int seed;
+    uint64_t errors;
+};
 
-typedef struct test_s{
-    void ( *function)(void **, int, int *);
-    char *op_name;
-    int op_count;
-    void (*setup)(void **);
-    void (*teardown)(void **);
-} test_t;
+struct perf_test {
+    const char *name;
+    const char *desc;
+    sr_datastore_t ds;
+    int need_sub;
+    int (*op)(struct perf_client *client, uint32_t i);
+};
 
-void
-print_measure_header(const char *title)
-{
-    printf("\n\n\t\t%s", title);
-    printf("\n%-32s| %10s | %10s | %13s | %10s | %10s\n",
-            "Operation", "ops/sec", "items/op", "ops performed", "items/sec", "test time");
-    printf("---------------------------------------------------------------------------------------------------\n");
-}
+static volatile sig_atomic_t perf_quit;
 
-/**
- * @brief Handles the process of time measurement.
- * 1. runs setup
- * 2. starts timer
- * 3. execute function being measured
- * 4. stops timer
- * 5. runs cleanup
- * 6. computes and prints the output
- *
- * Function being measured accepts:
- * - the state argument created by setup,
- * - the repeat count - how man times the operation should be performed
- * - pointer where the number of influenced items is returned
- */
-void
-measure(void (*func)(void **, int, int *), const char *name, int op_count, void (*setup)(void **), void (*teardown)(void **))
+static uint64_t
+perf_time_ns(void)
 {
-    struct timeval tv1 = {0, };
-    struct timeval tv2 = {0, };
-    struct timeval diff = {0, };
-    void *state = NULL;
-    double seconds = 0.0;
-    int items = 0;
-
-    setup(&state);
-
-    gettimeofday(&tv1, NULL);
-
-    func(&state, op_count, &items);
-
-    gettimeofday(&tv2, NULL);
-    teardown(&state);
+    struct timespec ts;
 
-    timeval_subtract(&diff, &tv2, &tv1);
-
-    seconds = diff.tv_sec + 0.000001*diff.tv_usec;
-    printf("%-32s| %10.0f | %10d | %13d | %10.0f | %10.2f\n",
-            name, items ? ((double) op_count)/ seconds : 0, items, op_count, items ? ((double) op_count * items)/ seconds : 0, seconds);
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
 }
 
-void
-sysrepo_setup(void **state)
+static int
+perf_op_get_item(struct perf_client *client, uint32_t i)
 {
+    char xpath[64];
+    sr_val_t *val;
+    int r;
 
-    sr_conn_ctx_t *conn = NULL;
-    int rc = SR_ERR_OK;
+    (void)i;
 
-    /* turn off all logging */
-    sr_log_stderr(SR_LL_WRN);
-    sr_log_syslog("perf_test", SR_LL_NONE);
+    sprintf(xpath, "/perf:cont/lst[k='%u']/l", rand_r(&client->seed) % client->opts->items);
+    r = sr_get_item(client->sess, xpath, 0, &val);
+    if (!r) {
+        sr_free_val(val);
+    }
+    return r;
+}
 
-    /* connect to sysrepo */
-    rc = sr_connect(SR_CONN_CACHE_RUNNING, &conn);
-    assert_int_equal(rc, SR_ERR_OK);
+static int
+perf_op_get_data(struct perf_client *client, uint32_t i)
+{
+    struct lyd_node *data = NULL;
+    int r;
 
-    *state = (void*)conn;
+    (void)i;
 
+    r = sr_get_data(client->sess, "/perf:cont", 0, 0, 0, &data);
+    lyd_free_withsiblings(data);
+    return r;
 }
 
-void
-sysrepo_teardown(void **state)
+static int
+perf_op_edit(struct perf_client *client, uint32_t i)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
+    char xpath[64], value[16];
+    int r;
 
-    /* disconnect from sysrepo */
-    sr_disconnect(conn);
+    sprintf(xpath, "/perf:cont/lst[k='%u']/l", rand_r(&client->seed) % client->opts->items);
+    sprintf(value, "v%u", i);
+    r = sr_set_item_str(client->sess, xpath, value, NULL, 0);
+    if (!r) {
+        r = sr_apply_changes(client->sess, 0);
+    }
+    if (r) {
+        sr_discard_changes(client->sess);
+    }
+    return r;
 }
 
-void
-libyang_setup(void **state)
+static int
+perf_op_rw_mix(struct perf_client *client, uint32_t i)
 {
-    struct ly_ctx *ctx = ly_ctx_new(TEST_SCHEMA_SEARCH_DIR, 0);
-    const struct lys_module *module = ly_ctx_load_module(ctx, "example-module", NULL);
-    assert_non_null(module);
-    *state = (void *) ctx;
+    /* 1 write for every 9 reads */
+    if (rand_r(&client->seed) % 10) {
+        return perf_op_get_item(client, i);
+    }
+    return perf_op_edit(client, i);
 }
 
-void
-libyang_teardown(void **state)
+static int
+perf_op_oper_get(struct perf_client *client, uint32_t i)
 {
-    struct ly_ctx *ctx = *state;
-    ly_ctx_destroy(ctx, NULL);
-}
+    struct lyd_node *data = NULL;
+    int r;
 
-typedef struct dp_setup_s {
-    sr_subscription_ctx_t *subs;
-    sr_conn_ctx_t *conn;
-    sr_session_ctx_t *session;
-    size_t if_count;
-}dp_setup_t;
+    (void)i;
 
+    r = sr_get_data(client->sess, "/perf:oper", 0, 0, 0, &data);
+    lyd_free_withsiblings(data);
+    return r;
+}
 
-int
-data_provide_cb(sr_session_ctx_t *session, const char *module_name, const char *path, const char *request_xpath,
-        uint32_t request_id, struct lyd_node **parent, void *private_data)
+static int
+perf_op_rpc(struct perf_client *client, uint32_t i)
 {
-    size_t if_count = *((size_t *) private_data);
-    int rc = SR_ERR_OK;
-    struct lyd_node *list, *node, *stats;
-    char *xpath;
+    struct lyd_node *input, *output = NULL;
+    char value[16];
+    int r;
 
-    (void)session;
-    (void)module_name;
-    (void)path;
-    (void)request_xpath;
-    (void)request_id;
-
-    for (size_t i = 0; i < if_count; i++) {
-        asprintf(&xpath, "interface[name='eth%zu']", i);
-        list = lyd_new_path(*parent, NULL, xpath, NULL, 0, 0);
-        free(xpath);
-        assert_non_null(list);
-
-        node = lyd_new_leaf(list, NULL, "oper-status", "up");
-        assert_non_null(node);
-
-        stats = lyd_new(list, NULL, "statistics");
-        assert_non_null(stats);
-
-        node = lyd_new_leaf(stats, NULL, "in-octets", "456213");
-        assert_non_null(node);
-
-        node = lyd_new_leaf(stats, NULL, "in-unicast-pkts", "45213");
-        assert_non_null(node);
-
-        node = lyd_new_leaf(stats, NULL, "in-broadcast-pkts", "4213");
-        assert_non_null(node);
+    sprintf(value, "v%u", i);
+    input = lyd_new_path(NULL, sr_get_context(sr_session_get_connection(client->sess)), "/perf:rpc/in", value, 0, 0);
+    if (!input) {
+        return SR_ERR_LY;
     }
 
-    return rc;
+    r = sr_rpc_send_tree(client->sess, input, 0, &output);
+    lyd_free_withsiblings(input);
+    lyd_free_withsiblings(output);
+    return r;
 }
 
-void
-data_provide_setup(void **state)
+static int
+perf_op_notif(struct perf_client *client, uint32_t i)
 {
+    struct lyd_node *notif;
+    char value[16];
+    int r;
 
-    dp_setup_t *dp_setup = calloc(1, sizeof(*dp_setup));
-    assert_non_null(dp_setup);
-    int rc = SR_ERR_OK;
-
-    /* turn off all logging */
-    sr_log_stderr(SR_LL_NONE);
-    sr_log_syslog(NULL, SR_LL_NONE);
-
-    /* connect to sysrepo */
-    rc = sr_connect(SR_CONN_DEFAULT, &dp_setup->conn);
-    assert_int_equal(rc, SR_ERR_OK);
+    sprintf(value, "v%u", i);
+    notif = lyd_new_path(NULL, sr_get_context(sr_session_get_connection(client->sess)), "/perf:notif/l", value, 0, 0);
+    if (!notif) {
+        return SR_ERR_LY;
+    }
 
-    rc = sr_session_start(dp_setup->conn, SR_DS_RUNNING, &dp_setup->session);
-    assert_int_equal(rc, SR_ERR_OK);
+    r = sr_event_notif_send_tree(client->sess, notif);
+    lyd_free_withsiblings(notif);
+    return r;
+}
 
-    rc = sr_oper_get_items_subscribe(dp_setup->session, "ietf-interfaces", "/ietf-interfaces:interfaces-state/interface",
-            data_provide_cb, &dp_setup->if_count, SR_SUBSCR_DEFAULT, &dp_setup->subs);
-    assert_int_equal(rc, SR_ERR_OK);
+static const struct perf_test perf_tests[] = {
+    {"get-item", "Get a single leaf", SR_DS_RUNNING, 0, perf_op_get_item},
+    {"get-data", "Get all the configuration data", SR_DS_RUNNING, 0, perf_op_get_data},
+    {"edit", "Change a single leaf, including change subscriber fan-out", SR_DS_RUNNING, 0, perf_op_edit},
+    {"rw-mix", "Get a single leaf (90 %) or change it (10 %), lock contention", SR_DS_RUNNING, 0, perf_op_rw_mix},
+    {"oper-get", "Get all the operational data pulled from a subscriber", SR_DS_OPERATIONAL, 1, perf_op_oper_get},
+    {"rpc", "Send an RPC handled by a subscriber", SR_DS_RUNNING, 1, perf_op_rpc},
+    {"notif", "Send a notification to all the subscribers", SR_DS_RUNNING, 0, perf_op_notif},
+};
 
-    sr_session_switch_ds(dp_setup->session, SR_DS_OPERATIONAL);
+#define PERF_TEST_COUNT (sizeof perf_tests / sizeof *perf_tests)
 
-    *state = (void *) dp_setup;
+static void
+help_print(void)
+{
+    uint32_t i;
+
+    printf(
+        "Usage:\n"
+        "  measure_performance [-c <count>] [-T <count>] [-s <count>] [-n <count>] [-o <count>] [-t <tests>] [-f <file>]\n"
+        "\n"
+        "Options:\n"
+        "  -h, --help              Print usage help.\n"
+        "  -c, --clients <count>   Number of client processes (default %u).\n"
+        "  -T, --threads <count>   Number of threads with their own session in every client process (default %u).\n"
+        "  -s, --subscribers <count>\n"
+        "                          Number of subscriber processes (default %u).\n"
+        "  -n, --items <count>     Number of list instances in the configuration and operational data (default %u).\n"
+        "  -o, --ops <count>       Number of operations performed by every client thread (default %u).\n"
+        "  -t, --tests <tests>     Comma-separated tests to run, all by default.\n"
+        "  -f, --file <file>       Print the results in JSON into a file instead of STDOUT.\n"
+        "\n"
+        "Tests:\n",
+        PERF_CLIENTS, PERF_THREADS, PERF_SUBSCRIBERS, PERF_ITEMS, PERF_OPS);
+    for (i = 0; i < PERF_TEST_COUNT; ++i) {
+        printf("  %-22s  %s\n", perf_tests[i].name, perf_tests[i].desc);
+    }
+    printf("\n");
 }
 
-void
-data_provide_teardown(void **state)
+static int
+perf_arg_count(const char *arg, uint32_t *count, int allow_zero)
 {
-    dp_setup_t *dp_setup = (dp_setup_t *) *state;
-
-    sr_unsubscribe(dp_setup->subs);
-    sr_session_stop(dp_setup->session);
-    sr_disconnect(dp_setup->conn);
+    char *ptr;
 
+    *count = strtoul(arg, &ptr, 10);
+    if (!arg[0] || ptr[0] || (!allow_zero && !*count)) {
+        fprintf(stderr, "Invalid count \"%s\".\n", arg);
+        return 1;
+    }
+    return 0;
 }
 
-static void
-perf_data_provide_test(void **state, int op_num, int *items)
+static int
+perf_wait(struct perf_shm *shm, uint32_t count)
 {
-    dp_setup_t *dp_setup = *state;
-    assert_non_null(dp_setup);
-
-    sr_val_t *value = NULL;
-    size_t val_cnt = 0;
-    int rc = 0;
-
-    dp_setup->if_count = instance_cnt;
-
-    /* perform get call*/
-    for (int i = 0; i < op_num; i++){
-        val_cnt = 0;
-        value = NULL;
-
-        rc = sr_get_items(dp_setup->session, "/ietf-interfaces:interfaces-state/interface/statistics//*", 0, &value, &val_cnt);
-        assert_int_equal(SR_ERR_OK, rc);
+    uint32_t ms = 0;
 
-        sr_free_values(value, val_cnt);
+    while (__atomic_load_n(&shm->ready, __ATOMIC_ACQUIRE) < count) {
+        if (ms == PERF_TIMEOUT_MS) {
+            fprintf(stderr, "Timeout elapsed waiting for processes to get ready.\n");
+            return 1;
+        }
+        usleep(1000);
+        ++ms;
     }
 
-    /* stop the session */
-    *items = val_cnt;
+    return 0;
 }
 
+/*
+ * SUBSCRIBER PROCESS
+ */
 static void
-perf_get_item_test(void **state, int op_num, int *items)
+perf_sig_handler(int sig)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    sr_val_t *value = NULL;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform a get-item request */
-    for (int i = 0; i<op_num; i++){
-
-        /* existing leaf */
-        rc = sr_get_item(session, "/example-module:container/list[key1='key1'][key2='key2']/leaf", 0, &value);
-        assert_int_equal(rc, SR_ERR_OK);
-        assert_non_null(value);
-        assert_int_equal(SR_STRING_T, value->type);
-        sr_free_val(value);
-    }
-
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = 1;
+    (void)sig;
+    perf_quit = 1;
 }
 
-static void
-perf_get_item_first_test(void **state, int op_num, int *items)
+static int
+perf_change_cb(sr_session_ctx_t *session, const char *module_name, const char *xpath, sr_event_t event,
+        uint32_t request_id, void *private_data)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    sr_val_t *value = NULL;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform a get-item request */
-    for (int i = 0; i<op_num; i++){
-
-        /* existing first node in data tree */
-        rc = sr_get_item(session, "/example-module:container", 0, &value);
-        if (SR_ERR_OK == rc) {
-            *items = 1;
-            assert_non_null(value);
-            assert_int_equal(SR_CONTAINER_T, value->type);
-            sr_free_val(value);
-        } else{
-            *items = 0;
-        }
-    }
+    (void)session;
+    (void)module_name;
+    (void)xpath;
+    (void)event;
+    (void)request_id;
+    (void)private_data;
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
+    return SR_ERR_OK;
 }
 
-static void
-perf_get_item_with_data_load_test(void **state, int op_num, int *items)
+static int
+perf_oper_cb(sr_session_ctx_t *session, const char *module_name, const char *path, const char *request_xpath,
+        uint32_t request_id, struct lyd_node **parent, void *private_data)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
+    const struct perf_opts *opts = (const struct perf_opts *)private_data;
+    char xpath[64];
+    uint32_t i;
 
-    sr_session_ctx_t *session = NULL;
-    sr_val_t *value = NULL;
-    int rc = 0;
-
-
-    /* perform session_start, get-item, session-stop requests */
-    for (int i = 0; i<op_num; i++){
-        /* start a session */
-        rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-        assert_int_equal(rc, SR_ERR_OK);
-
-
-        /* existing leaf */
-        rc = sr_get_item(session, "/example-module:container/list[key1='key1'][key2='key2']/leaf", 0, &value);
-        assert_int_equal(rc, SR_ERR_OK);
-        assert_non_null(value);
-        assert_int_equal(SR_STRING_T, value->type);
-        sr_free_val(value);
+    (void)module_name;
+    (void)path;
+    (void)request_xpath;
+    (void)request_id;
 
-        /* stop the session */
-        rc = sr_session_stop(session);
-        assert_int_equal(rc, SR_ERR_OK);
+    for (i = 0; i < opts->items; ++i) {
+        sprintf(xpath, "/perf:oper/lst[k='%u']/l", i);
+        if (!*parent) {
+            *parent = lyd_new_path(NULL, sr_get_context(sr_session_get_connection(session)), xpath, "oper", 0, 0);
+            if (!*parent) {
+                return SR_ERR_LY;
+            }
+        } else if (!lyd_new_path(*parent, NULL, xpath, "oper", 0, 0)) {
+            return SR_ERR_LY;
+        }
     }
 
-
-    *items = 1;
+    return SR_ERR_OK;
 }
 
-static void
-perf_get_items_test(void **state, int op_num, int *items)
+static int
+perf_rpc_cb(sr_session_ctx_t *session, const char *op_path, const struct lyd_node *input, sr_event_t event,
+        uint32_t request_id, struct lyd_node *output, void *private_data)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    sr_val_t *values = NULL;
-    size_t count = 0;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform a get-items request */
-    for (int i = 0; i<op_num; i++){
-        /* existing leaf */
-        rc = sr_get_items(session, "/example-module:container/list/leaf", 0, &values, &count);
-        assert_int_equal(SR_ERR_OK, rc);
-        sr_free_values(values, count);
-    }
+    (void)session;
+    (void)op_path;
+    (void)input;
+    (void)event;
+    (void)request_id;
+    (void)private_data;
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = count;
+    if (!lyd_new_path(output, NULL, "out", "reply", 0, LYD_PATH_OPT_OUTPUT)) {
+        return SR_ERR_LY;
+    }
+    return SR_ERR_OK;
 }
 
 static void
-perf_get_items_iter_test(void **state, int op_num, int *items)
+perf_notif_cb(sr_session_ctx_t *session, const sr_ev_notif_type_t notif_type, const struct lyd_node *notif,
+        time_t timestamp, void *private_data)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-    (void)op_num;
+    struct perf_shm *shm = (struct perf_shm *)private_data;
 
-    *items = 0;
-}
-
-static size_t
-get_nodes_cnt(struct lyd_node *trees)
-{
-    struct lyd_node *root, *next, *elem;
-    size_t count = 0;
+    (void)session;
+    (void)notif;
+    (void)timestamp;
 
-    LY_TREE_FOR(trees, root) {
-        LY_TREE_DFS_BEGIN(root, next, elem) {
-            ++count;
-            LY_TREE_DFS_END(root, next, elem);
-        }
+    if (notif_type == SR_EV_NOTIF_REALTIME) {
+        __atomic_add_fetch(&shm->notif_count, 1, __ATOMIC_RELAXED);
     }
-
-    return count;
 }
 
-static void
-perf_get_ietf_intefaces_test(void **state, int op_num, int *items)
+static int
+perf_subscriber(const struct perf_opts *opts, struct perf_shm *shm, uint32_t idx)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    struct lyd_node *data;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform a get-items_iter request */
-    size_t count = 0;
-    for (int i = 0; i<op_num; i++){
-        count = 0;
-        /* existing leaf */
-        rc = sr_get_data(session, "/ietf-interfaces:interfaces/*", 0, 0, 0, &data);
-        assert_int_equal(SR_ERR_OK, rc);
-        count += get_nodes_cnt(data);
-        lyd_free_withsiblings(data);
-    }
+    struct sigaction action;
+    sr_conn_ctx_t *conn = NULL;
+    sr_session_ctx_t *sess;
+    sr_subscription_ctx_t *subscr = NULL;
+    int r;
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = count;
-}
+    memset(&action, 0, sizeof action);
+    action.sa_handler = perf_sig_handler;
+    sigaction(SIGTERM, &action, NULL);
 
-static void
-perf_get_subtree_test(void **state, int op_num, int *items)
-{
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    struct lyd_node *tree = NULL;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform a get-item request */
-    for (int i = 0; i<op_num; i++){
-        /* existing leaf */
-        rc = sr_get_subtree(session, "/example-module:container/list[key1='key1'][key2='key2']/leaf", 0, &tree);
-        assert_int_equal(rc, SR_ERR_OK);
-        assert_non_null(tree);
-        assert_int_equal(LY_TYPE_STRING, ((struct lys_node_leaf *)tree->schema)->type.base);
-        lyd_free(tree);
+    if ((r = sr_connect(0, &conn)) || (r = sr_session_start(conn, SR_DS_RUNNING, &sess))) {
+        goto cleanup;
     }
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = 1;
-}
-
-static void
-perf_get_subtree_with_data_load_test(void **state, int op_num, int *items)
-{
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    struct lyd_node *tree = NULL;
-    int rc = 0;
-
-    /* perform session_start, get-item, session-stop requests */
-    for (int i = 0; i<op_num; i++){
-        /* start a session */
-        rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-        assert_int_equal(rc, SR_ERR_OK);
-
-        /* existing leaf */
-        rc = sr_get_subtree(session, "/example-module:container/list[key1='key1'][key2='key2']/leaf", 0, &tree);
-        assert_int_equal(rc, SR_ERR_OK);
-        assert_non_null(tree);
-        assert_int_equal(LY_TYPE_STRING, ((struct lys_node_leaf *)tree->schema)->type.base);
-        lyd_free(tree);
-
-        /* stop the session */
-        rc = sr_session_stop(session);
-        assert_int_equal(rc, SR_ERR_OK);
+    /* every subscriber is notified about changes and notifications */
+    if ((r = sr_module_change_subscribe(sess, "perf", NULL, perf_change_cb, NULL, 0, 0, &subscr))) {
+        goto cleanup;
+    }
+    if ((r = sr_event_notif_subscribe_tree(sess, "perf", NULL, 0, 0, perf_notif_cb, shm, SR_SUBSCR_CTX_REUSE, &subscr))) {
+        goto cleanup;
     }
 
-    *items = 1;
-}
-
-static void
-perf_get_subtrees_test(void **state, int op_num, int *items)
-{
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    struct lyd_node *trees = NULL;
-    size_t count = 0;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform a get-subtrees request */
-    for (int i = 0; i<op_num; i++){
-        count = 0;
-        /* existing leaf */
-        rc = sr_get_data(session, "/example-module:container/list/leaf", 0, 0, 0, &trees);
-        assert_int_equal(SR_ERR_OK, rc);
-        /* skip 2 keys */
-        assert_string_equal(trees->child->child->next->next->schema->name, "leaf");
-        count += get_nodes_cnt(trees);
-        lyd_free_withsiblings(trees);
+    /* only the first one provides data and handles RPCs */
+    if (!idx) {
+        if ((r = sr_oper_get_items_subscribe(sess, "perf", "/perf:oper", perf_oper_cb, (void *)opts,
+                SR_SUBSCR_CTX_REUSE, &subscr))) {
+            goto cleanup;
+        }
+        if ((r = sr_rpc_subscribe_tree(sess, "/perf:rpc", perf_rpc_cb, NULL, 0, SR_SUBSCR_CTX_REUSE, &subscr))) {
+            goto cleanup;
+        }
     }
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = count;
-}
+    /* ready */
+    __atomic_add_fetch(&shm->ready, 1, __ATOMIC_RELEASE);
 
-static void
-perf_get_ietf_intefaces_tree_test(void **state, int op_num, int *items)
-{
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-
-    sr_session_ctx_t *session = NULL;
-    struct lyd_node *trees = NULL;
-    size_t total_cnt = 0;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform a get-subtrees request */
-    for (int i = 0; i<op_num; i++){
-        rc = sr_get_data(session, "/ietf-interfaces:interfaces/.", 0, 0, 0, &trees);
-        assert_int_equal(rc, SR_ERR_OK);
-        if (0 == i) {
-            total_cnt = get_nodes_cnt(trees);
-        }
-        lyd_free_withsiblings(trees);
+    while (!perf_quit) {
+        usleep(10000);
     }
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = total_cnt;
+cleanup:
+    if (r) {
+        fprintf(stderr, "Subscriber %u failed (%s).\n", idx, sr_strerror(r));
+    }
+    sr_unsubscribe(subscr);
+    sr_disconnect(conn);
+    return r ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
-static void
-perf_set_delete_test(void **state, int op_num, int *items)
+/*
+ * CLIENT PROCESS
+ */
+static void *
+perf_client_thread(void *arg)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-    (void)op_num;
-//     sr_session_ctx_t *session = NULL;
-//     char xpath[PATH_MAX] = { 0, };
-//     int rc = 0;
-//
-//     /* start a session */
-//     rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-//     assert_int_equal(rc, SR_ERR_OK);
-//
-//     /* perform edit, commit request */
-//     sr_val_t value = {0,};
-//     for (size_t i = 0; i < op_num; i++) {
-//
-//         /* set a list instance */
-//         sprintf(xpath, "/example-module:container/list[key1='set_del'][key2='set_1']/leaf");
-//         value.type = SR_STRING_T;
-//         value.data.string_val = strdup("Leaf");
-//         assert_non_null(value.data.string_val);
-//         rc = sr_set_item(session, xpath, &value, SR_EDIT_DEFAULT);
-//         assert_int_equal(rc, SR_ERR_OK);
-//
-//         /* delete a list instance */
-//         sprintf(xpath, "/example-module:container/list[key1='set_del'][key2='set_1']");
-//         rc = sr_delete_item(session, xpath, SR_EDIT_DEFAULT);
-//         assert_int_equal(rc, SR_ERR_OK);
-//     }
-//
-//     /* stop the session */
-//     rc = sr_session_stop(session);
-//     assert_int_equal(rc, SR_ERR_OK);
-//
-//     *items = 1 /* list instances */ * 3 /* leaves */ * 2 /* set + delete */ ;
-    *items = 0;
-}
+    struct perf_client *client = (struct perf_client *)arg;
+    uint64_t start;
+    uint32_t i;
 
-static void
-perf_set_delete_100_test(void **state, int op_num, int *items)
-{
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-    (void)op_num;
-//     sr_session_ctx_t *session = NULL;
-//     char xpath[PATH_MAX] = { 0, };
-//     int rc = 0;
-//
-//     /* start a session */
-//     rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-//     assert_int_equal(rc, SR_ERR_OK);
-//
-//     /* perform edit, commit request */
-//     sr_val_t value = {0,};
-//     for (size_t i = 0; i < op_num; i++) {
-//
-//         /* set 100 list instances */
-//         for (size_t j = 0; j <= 100; j++) {
-//             sprintf(xpath, "/example-module:container/list[key1='set_del'][key2='set_%zu']/leaf", j);
-//             value.type = SR_STRING_T;
-//             value.data.string_val = strdup("Leaf");
-//             assert_non_null(value.data.string_val);
-//             rc = sr_set_item(session, xpath, &value, SR_EDIT_DEFAULT);
-//             assert_int_equal(rc, SR_ERR_OK);
-//         }
-//
-//         /* delete 100 list instances */
-//         for (size_t j = 0; j <= 100; j++) {
-//             sprintf(xpath, "/example-module:container/list[key1='set_del'][key2='set_%zu']", j);
-//             rc = sr_delete_item(session, xpath, SR_EDIT_DEFAULT);
-//             assert_int_equal(rc, SR_ERR_OK);
-//         }
-//     }
-//
-//     /* stop the session */
-//     rc = sr_session_stop(session);
-//     assert_int_equal(rc, SR_ERR_OK);
-//
-//     *items = 100 /* list instances */ * 3 /* leaves */ * 2 /* set + delete */ ;
-    *items = 0;
-}
+    /* ready, wait for the others */
+    __atomic_add_fetch(&client->shm->ready, 1, __ATOMIC_RELEASE);
+    while (!__atomic_load_n(&client->shm->start, __ATOMIC_ACQUIRE)) {
+        usleep(100);
+    }
 
-static void
-perf_commit_test(void **state, int op_num, int *items)
-{
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-    sr_session_ctx_t *session = NULL;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* perform edit, commit request */
-    bool even = true;
-    for (int i = 0; i<op_num; i++){
-        if (even) {
-            rc = sr_delete_item(session, "/example-module:container/list[key1='key1'][key2='key2']/leaf", SR_EDIT_DEFAULT);
-        } else {
-            sr_val_t value = {0,};
-            value.type = SR_STRING_T;
-            value.data.string_val = strdup("Leaf");
-            assert_non_null(value.data.string_val);
-            rc = sr_set_item(session, "/example-module:container/list[key1='key1'][key2='key2']/leaf", &value, SR_EDIT_DEFAULT);
+    for (i = 0; i < client->opts->ops; ++i) {
+        start = perf_time_ns();
+        if (client->test->op(client, i)) {
+            ++client->errors;
         }
-        assert_int_equal(rc, SR_ERR_OK);
-        rc = sr_apply_changes(session, 0);
-        assert_int_equal(rc, SR_ERR_OK);
-        even = !even;
+        client->lat[i] = perf_time_ns() - start;
     }
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = 1;
+    return NULL;
 }
 
 static int
-test_rpc_cb(sr_session_ctx_t *session, const char *op_path, const sr_val_t *input, const size_t input_cnt,
-        sr_event_t event, uint32_t request_id, sr_val_t **output, size_t *output_cnt, void *private_data)
+perf_client_proc(const struct perf_opts *opts, const struct perf_test *test, struct perf_shm *shm, uint32_t idx)
 {
-    sr_val_t *v = NULL;
-    (void)session;
-    (void)op_path;
-    (void)input;
-    (void)event;
-    (void)request_id;
-    (void)private_data;
-
-    /* check input */
-    assert_true(input_cnt > 0);
+    sr_conn_ctx_t *conn = NULL;
+    struct perf_client *clients;
+    pthread_t *tids;
+    uint32_t i, count = 0;
+    uint64_t errors = 0;
+    int r = SR_ERR_OK;
+
+    clients = calloc(opts->threads, sizeof *clients);
+    tids = calloc(opts->threads, sizeof *tids);
+    if (!clients || !tids) {
+        r = SR_ERR_NOMEM;
+        goto cleanup;
+    }
 
-    v = calloc(1, sizeof *v);
-    assert_non_null(v);
+    /* every client process has its own connection and every thread its own session */
+    if ((r = sr_connect(0, &conn))) {
+        goto cleanup;
+    }
+    for (i = 0; i < opts->threads; ++i) {
+        if ((r = sr_session_start(conn, test->ds, &clients[i].sess))) {
+            goto cleanup;
+        }
+        clients[i].test = test;
+        clients[i].opts = opts;
+        clients[i].shm = shm;
+        clients[i].lat = shm->lat + ((uint64_t)idx * opts->threads + i) * opts->ops;
+        clients[i].seed = idx * opts->threads + i + 1;
+    }
 
-    v->xpath = strdup("/test-module:activate-software-image/status");
-    v->type = SR_STRING_T;
-    v->data.string_val = strdup("The image acmefw-2.3 is being installed.");
+    for (i = 0; i < opts->threads; ++i) {
+        if ((r = pthread_create(&tids[i], NULL, perf_client_thread, &clients[i]))) {
+            r = SR_ERR_SYS;
+            break;
+        }
+        ++count;
+    }
 
-    *output = v;
-    *output_cnt = 1;
+    for (i = 0; i < count; ++i) {
+        pthread_join(tids[i], NULL);
+        errors += clients[i].errors;
+    }
+    __atomic_add_fetch(&shm->errors, errors, __ATOMIC_RELAXED);
 
-    return SR_ERR_OK;
+cleanup:
+    if (r) {
+        fprintf(stderr, "Client %u failed (%s).\n", idx, sr_strerror(r));
+    }
+    sr_disconnect(conn);
+    free(clients);
+    free(tids);
+    return r ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
+/*
+ * MAIN PROCESS
+ */
 static int
-test_dummy_cb(sr_session_ctx_t *session, const char *module_name, const char *xpath, sr_event_t event,
-        uint32_t request_id, void *private_data)
+perf_lat_cmp(const void *ptr1, const void *ptr2)
 {
-    (void)session;
-    (void)module_name;
-    (void)xpath;
-    (void)event;
-    (void)request_id;
-    (void)private_data;
-    return SR_ERR_OK;
+    uint64_t lat1 = *(const uint64_t *)ptr1, lat2 = *(const uint64_t *)ptr2;
+
+    return (lat1 > lat2) - (lat1 < lat2);
 }
 
-static void
-perf_rpc_test(void **state, int op_num, int *items)
+static double
+perf_percentile_us(const uint64_t *lat, uint64_t count, double perc)
 {
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-    sr_session_ctx_t *session = NULL;
-    sr_subscription_ctx_t *subscription = NULL;
-    sr_val_t input = { 0, };
-    sr_val_t *output = NULL;
-    size_t output_cnt = 0;
-    int rc = 0;
-
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* subscribe for RPC */
-    rc = sr_rpc_subscribe(session, "/test-module:activate-software-image", test_rpc_cb, NULL, 0, SR_SUBSCR_DEFAULT,
-            &subscription);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* subscribe to a default leaf so that it is present in operational */
-    rc = sr_module_change_subscribe(session, "test-module", "/test-module:top-level-default", test_dummy_cb, NULL, 0,
-            SR_SUBSCR_CTX_REUSE, &subscription);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    input.xpath = "/test-module:activate-software-image/image-name";
-    input.type = SR_STRING_T;
-    input.data.string_val = "acmefw-2.3";
-
-    /* send the RPC */
-    for (int i = 0; i < op_num; i++) {
-        rc = sr_rpc_send(session, "/test-module:activate-software-image", &input, 1, 0, &output, &output_cnt);
-        assert_int_equal(rc, SR_ERR_OK);
-        assert_true(output_cnt > 0);
-        sr_free_values(output, output_cnt);
-    }
-
-    /* unsubscribe from RPCs */
-    rc = sr_unsubscribe(subscription);
-    assert_int_equal(rc, SR_ERR_OK);
+    uint64_t idx;
 
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = 1;
+    /* nearest-rank */
+    idx = (uint64_t)(perc * count + 0.999999);
+    if (idx) {
+        --idx;
+    }
+    if (idx >= count) {
+        idx = count - 1;
+    }
+    return lat[idx] / 1000.0;
 }
 
-static void
-test_event_notif_link_discovery_cb(sr_session_ctx_t *session, const sr_ev_notif_type_t notif_type, const char *path,
-        const sr_val_t *values, const size_t values_cnt, time_t timestamp, void *private_data)
+static int
+perf_prepare(const struct perf_opts *opts)
 {
-    (void)session;
-    (void)notif_type;
-    (void)path;
-    (void)values;
-    (void)timestamp;
-    (void)private_data;
-    assert_true(values_cnt > 0);
-}
+    sr_conn_ctx_t *conn = NULL;
+    sr_session_ctx_t *sess;
+    struct lyd_node *data = NULL;
+    char xpath[64];
+    uint32_t i, conn_count;
+    int r;
 
-static void
-perf_ev_notification_test(void **state, int op_num, int *items, bool ephemeral)
-{
-    sr_conn_ctx_t *conn = *state;
-    assert_non_null(conn);
-    sr_session_ctx_t *session = NULL;
-    sr_subscription_ctx_t *subscription = NULL;
-    sr_val_t values[4] = { { 0, }, };
-    int rc = 0;
-
-    if (ephemeral) {
-        rc = sr_set_module_replay_support(conn, "test-module", 0);
-        assert_int_equal(rc, SR_ERR_OK);
-    } else {
-        rc = sr_set_module_replay_support(conn, "test-module", 1);
-        assert_int_equal(rc, SR_ERR_OK);
+    if ((r = sr_connection_count(&conn_count))) {
+        goto cleanup;
+    } else if (conn_count) {
+        fprintf(stderr, "There can be no running connections.\n");
+        return 1;
     }
 
-    /* start a session */
-    rc = sr_session_start(conn, SR_DS_RUNNING, &session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* enable notification buffering */
-    rc = sr_session_notif_buffer(session);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* subscribe for event notification */
-    rc = sr_event_notif_subscribe(session, "test-module", "/test-module:link-discovered", 0, 0,
-            test_event_notif_link_discovery_cb, NULL, SR_SUBSCR_DEFAULT, &subscription);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* send event notification - link discovery */
-    values[0].xpath = "/test-module:link-discovered/source/address";
-    values[0].type = SR_STRING_T;
-    values[0].data.string_val = "10.10.1.5";
-    values[1].xpath = "/test-module:link-discovered/source/interface";
-    values[1].type = SR_STRING_T;
-    values[1].data.string_val = "eth1";
-    values[2].xpath = "/test-module:link-discovered/destination/address";
-    values[2].type = SR_STRING_T;
-    values[2].data.string_val = "10.10.1.8";
-    values[3].xpath = "/test-module:link-discovered/destination/interface";
-    values[3].type = SR_STRING_T;
-    values[3].data.string_val = "eth0";
-
-    /* send the notification */
-    for (int i = 0; i < op_num; i++) {
-        rc = sr_event_notif_send(session, "/test-module:link-discovered", values, 4);
-        assert_int_equal(rc, SR_ERR_OK);
+    /* install the module */
+    if ((r = sr_connect(0, &conn))) {
+        goto cleanup;
+    }
+    r = sr_install_module(conn, TESTS_DIR "/files/perf.yang", TESTS_DIR "/files", NULL, 0);
+    if (r && (r != SR_ERR_EXISTS)) {
+        goto cleanup;
+    }
+    sr_disconnect(conn);
+    if ((r = sr_connect(0, &conn)) || (r = sr_session_start(conn, SR_DS_RUNNING, &sess))) {
+        goto cleanup;
     }
 
-    /* unsubscribe from notifications */
-    rc = sr_unsubscribe(subscription);
-    assert_int_equal(rc, SR_ERR_OK);
-
-    /* stop the session */
-    rc = sr_session_stop(session);
-    assert_int_equal(rc, SR_ERR_OK);
-    *items = 1;
-}
-
-static void
-perf_ev_notification_ephemeral_test(void **state, int op_num, int *items)
-{
-    perf_ev_notification_test(state, op_num, items, true);
-}
+    /* create the configuration data */
+    for (i = 0; i < opts->items; ++i) {
+        sprintf(xpath, "/perf:cont/lst[k='%u']/l", i);
+        if (!data) {
+            data = lyd_new_path(NULL, sr_get_context(conn), xpath, "init", 0, 0);
+            if (!data) {
+                r = SR_ERR_LY;
+                goto cleanup;
+            }
+        } else if (!lyd_new_path(data, NULL, xpath, "init", 0, 0)) {
+            r = SR_ERR_LY;
+            goto cleanup;
+        }
+    }
+    r = sr_replace_config(sess, "perf", data, SR_DS_RUNNING, 0);
+    data = NULL;
 
-static void
-perf_ev_notification_store_test(void **state, int op_num, int *items)
-{
-    perf_ev_notification_test(state, op_num, items, false);
+cleanup:
+    if (r) {
+        fprintf(stderr, "Preparing the benchmark failed (%s).\n", sr_strerror(r));
+    }
+    lyd_free_withsiblings(data);
+    sr_disconnect(conn);
+    return r ? 1 : 0;
 }
 
 static void
-perf_libyang_get_node(void **state, int op_num, int *items)
+perf_cleanup(void)
 {
-    struct ly_ctx *ctx = *state;
-    assert_non_null(ctx);
-
-    struct lyd_node *root = lyd_parse_path(ctx, EXAMPLE_MODULE_DATA_FILE_NAME, LYD_LYB, LYD_OPT_CONFIG | LYD_OPT_STRICT);
-    assert_non_null(root);
-
-    /* perform a lyd_get_node op */
-    for (int i = 0; i<op_num; i++){
+    sr_conn_ctx_t *conn = NULL;
 
-        /* existing leaf */
-        struct ly_set *set = lyd_find_path(root, "/example-module:container/list[key1='key1'][key2='key2']/leaf");
-        assert_non_null(set);
-        ly_set_free(set);
+    if (!sr_connect(0, &conn)) {
+        sr_remove_module(conn, "perf");
     }
-
-    lyd_free_withsiblings(root);
-    *items = 1;
+    sr_disconnect(conn);
 }
 
-static void
-perf_libyang_get_all_list(void **state, int op_num, int *items)
+static pid_t
+perf_fork(int (*proc_cb)(const struct perf_opts *, const struct perf_test *, struct perf_shm *, uint32_t),
+        const struct perf_opts *opts, const struct perf_test *test, struct perf_shm *shm, uint32_t idx)
 {
-    struct ly_ctx *ctx = *state;
-    assert_non_null(ctx);
-
-    struct lyd_node *root = lyd_parse_path(ctx, EXAMPLE_MODULE_DATA_FILE_NAME, LYD_LYB, LYD_OPT_CONFIG | LYD_OPT_STRICT);
-    assert_non_null(root);
+    pid_t pid;
 
-    /* perform a lyd_get_node op */
-    for (int i = 0; i<op_num; i++){
-
-        /* existing leaf */
-        struct ly_set *set = lyd_find_path(root, "/example-module:container/list/leaf");
-        *items = set->number;
-        assert_non_null(set);
-        ly_set_free(set);
+    pid = fork();
+    if (!pid) {
+        /* child, must not flush the inherited stdio buffers */
+        _exit(proc_cb(opts, test, shm, idx));
+    } else if (pid == -1) {
+        fprintf(stderr, "fork() failed (%s).\n", strerror(errno));
     }
 
-    lyd_free_withsiblings(root);
-
+    return pid;
 }
 
-void
-test_perf(test_t *ts, int test_count, const char *title, int selection)
+static int
+perf_subscriber_proc(const struct perf_opts *opts, const struct perf_test *test, struct perf_shm *shm, uint32_t idx)
 {
-    print_measure_header(title);
-    for (int i = 0; i < test_count; i++) {
-        test_t *t = &ts[i];
-        if (-1 == selection || i == selection){
-            measure(t->function, t->op_name, t->op_count, t->setup, t->teardown);
-        }
-    }
+    (void)test;
+    return perf_subscriber(opts, shm, idx);
 }
 
-static void
-createDataTreeExampleModule(sr_session_ctx_t *sess)
+static int
+perf_wait_children(pid_t *pids, uint32_t count)
 {
-    const struct ly_ctx *ctx = NULL;
-    struct lyd_node *root = NULL;
+    uint32_t i;
+    int status, rc = 0;
 
-    ctx = sr_get_context(sr_session_get_connection(sess));
-
-    const struct lys_module *module = ly_ctx_get_module(ctx, "example-module", NULL, 1);
-    assert_non_null(module);
-
-#define XPATH "/example-module:container/list[key1='key1'][key2='key2']/leaf"
+    for (i = 0; i < count; ++i) {
+        if (pids[i] <= 0) {
+            continue;
+        }
+        if ((waitpid(pids[i], &status, 0) == -1) || !WIFEXITED(status) || WEXITSTATUS(status)) {
+            rc = 1;
+        }
+        pids[i] = 0;
+    }
 
-    root = lyd_new_path(NULL, ctx, XPATH, "Leaf value", 0, 0);
-    assert_non_null(root);
-    assert_int_equal(0, lyd_validate(&root, LYD_OPT_STRICT | LYD_OPT_CONFIG, NULL));
-    assert_int_equal(SR_ERR_OK, sr_replace_config(sess, "example-module", root, SR_DS_RUNNING, 0));
+    return rc;
 }
 
-static void
-createDataTreeLargeExampleModule(sr_session_ctx_t *sess, int list_count)
-{
-    const struct ly_ctx *ctx = NULL;
-    struct lyd_node *root = NULL, *node = NULL;
-
-    ctx = sr_get_context(sr_session_get_connection(sess));
-
-    const struct lys_module *module = ly_ctx_get_module(ctx, "example-module", NULL, 1);
-    assert_non_null(module);
+static int
+perf_run_test(const struct perf_opts *opts, const struct perf_test *test, FILE *out, int first)
+{
+    struct perf_shm *shm;
+    pid_t *pids = NULL, *sub_pids = NULL;
+    uint64_t lat_count, start = 0, end = 0, deliver_end = 0, expected, delivered = 0, sum = 0;
+    size_t shm_size;
+    uint32_t i, ms;
+    int rc = 1, skipped = 0;
+
+    lat_count = (uint64_t)opts->clients * opts->threads * opts->ops;
+    shm_size = sizeof *shm + lat_count * sizeof *shm->lat;
+    shm = mmap(NULL, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shm == MAP_FAILED) {
+        fprintf(stderr, "mmap() failed (%s).\n", strerror(errno));
+        return 1;
+    }
+    memset(shm, 0, sizeof *shm);
 
-#define MAX_XP_LEN 100
-    const char *template = "/example-module:container/list[key1='k1%d'][key2='k2%d']/leaf";
-    char xpath[MAX_XP_LEN] = {0,};
+    pids = calloc(opts->clients, sizeof *pids);
+    sub_pids = calloc(opts->subscribers, sizeof *sub_pids);
+    if (!pids || (opts->subscribers && !sub_pids)) {
+        fprintf(stderr, "Memory allocation failed.\n");
+        goto cleanup;
+    }
 
+    if (test->need_sub && !opts->subscribers) {
+        /* nobody to handle the operations */
+        skipped = 1;
+        rc = 0;
+        goto print;
+    }
 
-    for (int i = 0; i < list_count; i++){
-        snprintf(xpath, MAX_XP_LEN, template, i, i);
-        node = lyd_new_path(root, ctx, xpath, "Leaf value", 0, 0);
-        if (NULL == root) {
-            root = node;
+    /* start fresh subscribers for every test */
+    for (i = 0; i < opts->subscribers; ++i) {
+        if ((sub_pids[i] = perf_fork(perf_subscriber_proc, opts, test, shm, i)) == -1) {
+            goto cleanup;
         }
     }
-    lyd_new_path(root, ctx, "/example-module:container/list[key1='key1'][key2='key2']/leaf", "Leaf value", 0, 0);
-
-    assert_int_equal(0, lyd_validate(&root, LYD_OPT_STRICT | LYD_OPT_CONFIG, NULL));
-    assert_int_equal(SR_ERR_OK, sr_replace_config(sess, "example-module", root, SR_DS_RUNNING, 0));
-}
-
-static void
-createDataTreeLargeIETFinterfacesModule(sr_session_ctx_t *sess, size_t if_count)
-{
+    if (perf_wait(shm, opts->subscribers)) {
+        goto cleanup;
+    }
 
-    const struct ly_ctx *ctx = sr_get_context(sr_session_get_connection(sess));
-
-    struct lyd_node *root = NULL;
-
-    #define MAX_IF_LEN 150
-    const char *template_prefix_len = "/ietf-interfaces:interfaces/interface[name='eth%d']/ietf-ip:ipv4/ietf-ip:address[ietf-ip:ip='192.168.%d.%d']/ietf-ip:prefix-length";
-    const char *template_type = "/ietf-interfaces:interfaces/interface[name='eth%d']/type";
-    const char *template_desc = "/ietf-interfaces:interfaces/interface[name='eth%d']/description";
-    const char *template_enabled = "/ietf-interfaces:interfaces/interface[name='eth%d']/enabled";
-    const char *template_ipv4_enabled = "/ietf-interfaces:interfaces/interface[name='eth%d']/ietf-ip:ipv4/ietf-ip:enabled";
-    const char *template_ipv4_mtu = "/ietf-interfaces:interfaces/interface[name='eth%d']/ietf-ip:ipv4/ietf-ip:mtu";
-    char xpath[MAX_IF_LEN] = {0,};
-
-    const struct lys_module *module_interfaces = ly_ctx_get_module(ctx, "ietf-interfaces", NULL, 1);
-    assert_non_null(module_interfaces);
-    const struct lys_module *module_ip = ly_ctx_get_module(ctx, "ietf-ip", NULL, 1);
-    assert_non_null(module_ip);
-    const struct lys_module *module = ly_ctx_get_module(ctx, "iana-if-type", "2014-05-08", 1);
-    assert_non_null(module);
-    struct lyd_node *node = NULL;
-
-    for (size_t i = 1; i < (if_count+1); i++) {
-        snprintf(xpath, MAX_IF_LEN, template_prefix_len, i, (i/244 +1), i % 244);
-        node = lyd_new_path(root, ctx, xpath, "24", 0, 0);
-        if (NULL == root) {
-            root = node;
+    /* start clients and wait for them to get ready */
+    for (i = 0; i < opts->clients; ++i) {
+        if ((pids[i] = perf_fork(perf_client_proc, opts, test, shm, i)) == -1) {
+            goto cleanup;
         }
-        snprintf(xpath, MAX_IF_LEN, template_type, i);
-        lyd_new_path(root, ctx, xpath, "iana-if-type:ethernetCsmacd", 0, 0);
-
-        snprintf(xpath, MAX_IF_LEN, template_desc, i);
-        lyd_new_path(root, ctx, xpath, "ethernet interface", 0, 0);
+    }
+    if (perf_wait(shm, opts->subscribers + opts->clients * opts->threads)) {
+        goto cleanup;
+    }
 
-        snprintf(xpath, MAX_IF_LEN, template_enabled, i);
-        lyd_new_path(root, ctx, xpath, "true", 0, 0);
+    /* run */
+    start = perf_time_ns();
+    __atomic_store_n(&shm->start, 1, __ATOMIC_RELEASE);
+    if (perf_wait_children(pids, opts->clients)) {
+        fprintf(stderr, "Some clients failed.\n");
+        goto cleanup;
+    }
+    end = perf_time_ns();
+
+    if (test->op == perf_op_notif) {
+        /* wait for all the notifications to be delivered */
+        expected = lat_count * opts->subscribers;
+        for (ms = 0; ms < PERF_TIMEOUT_MS; ++ms) {
+            delivered = __atomic_load_n(&shm->notif_count, __ATOMIC_RELAXED);
+            if (delivered >= expected) {
+                break;
+            }
+            usleep(1000);
+        }
+        deliver_end = perf_time_ns();
+    }
 
-        snprintf(xpath, MAX_IF_LEN, template_ipv4_enabled, i);
-        lyd_new_path(root, ctx, xpath, "true", 0, 0);
+    /* compute latency statistics */
+    qsort(shm->lat, lat_count, sizeof *shm->lat, perf_lat_cmp);
+    for (i = 0; i < lat_count; ++i) {
+        sum += shm->lat[i];
+    }
 
-        snprintf(xpath, MAX_IF_LEN, template_ipv4_mtu, i);
-        lyd_new_path(root, ctx, xpath, "1500", 0, 0);
+    rc = 0;
 
+print:
+    fprintf(out, "%s\n    {\n      \"test\": \"%s\",\n", first ? "" : ",", test->name);
+    if (skipped) {
+        fprintf(out, "      \"skipped\": true\n    }");
+        fprintf(stderr, "%-10s skipped, no subscribers\n", test->name);
+        goto cleanup;
     }
+    fprintf(out,
+            "      \"ops\": %" PRIu64 ",\n"
+            "      \"errors\": %" PRIu64 ",\n"
+            "      \"duration_s\": %.6f,\n"
+            "      \"throughput_ops_s\": %.1f,\n"
+            "      \"latency_us\": {\n"
+            "        \"min\": %.1f,\n"
+            "        \"mean\": %.1f,\n"
+            "        \"p50\": %.1f,\n"
+            "        \"p99\": %.1f,\n"
+            "        \"p999\": %.1f,\n"
+            "        \"max\": %.1f\n"
+            "      }",
+            lat_count, shm->errors, (end - start) / 1e9, lat_count / ((end - start) / 1e9),
+            shm->lat[0] / 1000.0, (sum / (double)lat_count) / 1000.0, perf_percentile_us(shm->lat, lat_count, 0.5),
+            perf_percentile_us(shm->lat, lat_count, 0.99), perf_percentile_us(shm->lat, lat_count, 0.999),
+            shm->lat[lat_count - 1] / 1000.0);
+    if (test->op == perf_op_notif) {
+        fprintf(out, ",\n      \"notifications_delivered\": %" PRIu64 ",\n      \"delivery_throughput_s\": %.1f",
+                delivered, delivered / ((deliver_end - start) / 1e9));
+    }
+    fprintf(out, "\n    }");
+    fprintf(stderr, "%-10s %10.1f ops/s, p50 %10.1f us, p99 %10.1f us, p999 %10.1f us, %" PRIu64 " errors\n",
+            test->name, lat_count / ((end - start) / 1e9), perf_percentile_us(shm->lat, lat_count, 0.5),
+            perf_percentile_us(shm->lat, lat_count, 0.99), perf_percentile_us(shm->lat, lat_count, 0.999), shm->errors);
 
-
-    assert_int_equal(0, lyd_validate(&root, LYD_OPT_STRICT | LYD_OPT_CONFIG, NULL));
-    assert_int_equal(SR_ERR_OK, sr_replace_config(sess, "ietf-interfaces", root, SR_DS_RUNNING, 0));
+cleanup:
+    if (pids) {
+        for (i = 0; i < opts->clients; ++i) {
+            if (pids[i] > 0) {
+                kill(pids[i], SIGKILL);
+            }
+        }
+        perf_wait_children(pids, opts->clients);
+    }
+    if (sub_pids) {
+        for (i = 0; i < opts->subscribers; ++i) {
+            if (sub_pids[i] > 0) {
+                kill(sub_pids[i], SIGTERM);
+            }
+        }
+        if (perf_wait_children(sub_pids, opts->subscribers)) {
+            fprintf(stderr, "Some subscribers failed.\n");
+            rc = 1;
+        }
+    }
+    free(pids);
+    free(sub_pids);
+    munmap(shm, shm_size);
+    return rc;
 }
 
 int
 main(int argc, char **argv)
 {
-    test_t tests[] = {
-        {perf_get_item_test, "Get item one leaf", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_item_first_test, "Get item first leaf", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_item_with_data_load_test, "Get item incl session start", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_items_test, "Get items all lists", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_items_iter_test, "Get items iter all lists", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_ietf_intefaces_test, "Get items ietf-if config", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_subtree_test, "Get subtree one leaf", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_subtree_with_data_load_test, "Get subtree incl session start", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_subtrees_test, "Get subtrees all lists", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_get_ietf_intefaces_tree_test, "Get subtrees ietf-if config", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_set_delete_test, "Set & delete one list", OP_COUNT, sysrepo_setup, sysrepo_teardown},
-        {perf_set_delete_100_test, "Set & delete 100 lists", OP_COUNT_COMMIT, sysrepo_setup, sysrepo_teardown},
-        {perf_commit_test, "Commit one leaf change", OP_COUNT_COMMIT, sysrepo_setup, sysrepo_teardown},
-        {perf_data_provide_test, "Operational data provide", OP_COUNT_COMMIT, data_provide_setup, data_provide_teardown},
-        {perf_rpc_test, "RPC", OP_COUNT_COMMIT, sysrepo_setup, sysrepo_teardown},
-        {perf_ev_notification_ephemeral_test, "Event notification - ephemeral", OP_COUNT_COMMIT, sysrepo_setup, sysrepo_teardown},
-        {perf_ev_notification_store_test, "Event notification - store", OP_COUNT_COMMIT, sysrepo_setup, sysrepo_teardown},
-        {perf_libyang_get_node, "Libyang get one node", OP_COUNT, libyang_setup, libyang_teardown},
-        {perf_libyang_get_all_list, "Libyang get all list", OP_COUNT, libyang_setup, libyang_teardown},
+    struct perf_opts opts = {PERF_CLIENTS, PERF_THREADS, PERF_SUBSCRIBERS, PERF_ITEMS, PERF_OPS};
+    const char *tests = NULL, *file_path = NULL, *ptr;
+    FILE *out = stdout;
+    uint32_t i;
+    size_t len;
+    int opt, first = 1, rc = EXIT_FAILURE, prepared = 0;
+    struct option options[] = {
+        {"help",        no_argument,       NULL, 'h'},
+        {"clients",     required_argument, NULL, 'c'},
+        {"threads",     required_argument, NULL, 'T'},
+        {"subscribers", required_argument, NULL, 's'},
+        {"items",       required_argument, NULL, 'n'},
+        {"ops",         required_argument, NULL, 'o'},
+        {"tests",       required_argument, NULL, 't'},
+        {"file",        required_argument, NULL, 'f'},
+        {NULL,          0,                 NULL, 0},
     };
 
-    size_t test_count = sizeof(tests)/sizeof(*tests);
-    sr_conn_ctx_t *conn = NULL;
-    sr_session_ctx_t *sess;
-    int rc, ret = -1, selection = -1;
-    uint32_t conn_count;
-
-    if (argc > 1) {
-        rc = sscanf(argv[1], "%d", &selection);
-        assert_int_equal(rc, 1);
+    opterr = 0;
+    while ((opt = getopt_long(argc, argv, "hc:T:s:n:o:t:f:", options, NULL)) != -1) {
+        switch (opt) {
+        case 'h':
+            help_print();
+            return EXIT_SUCCESS;
+        case 'c':
+            if (perf_arg_count(optarg, &opts.clients, 0)) {
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'T':
+            if (perf_arg_count(optarg, &opts.threads, 0)) {
+                return EXIT_FAILURE;
+            }
+            break;
+        case 's':
+            if (perf_arg_count(optarg, &opts.subscribers, 1)) {
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'n':
+            if (perf_arg_count(optarg, &opts.items, 0)) {
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'o':
+            if (perf_arg_count(optarg, &opts.ops, 0)) {
+                return EXIT_FAILURE;
+            }
+            break;
+        case 't':
+            tests = optarg;
+            break;
+        case 'f':
+            file_path = optarg;
+            break;
+        default:
+            fprintf(stderr, "Invalid option or missing argument: -%c\n", optopt);
+            return EXIT_FAILURE;
+        }
     }
 
-    sr_connection_count(&conn_count);
-    if (conn_count) {
-        puts("There can be no running connections.\n");
-        goto cleanup;
+    /* check the selected tests */
+    for (ptr = tests; ptr && ptr[0]; ptr += len + (ptr[len] ? 1 : 0)) {
+        len = strcspn(ptr, ",");
+        for (i = 0; i < PERF_TEST_COUNT; ++i) {
+            if ((strlen(perf_tests[i].name) == len) && !strncmp(perf_tests[i].name, ptr, len)) {
+                break;
+            }
+        }
+        if (i == PERF_TEST_COUNT) {
+            fprintf(stderr, "Unknown test \"%.*s\".\n", (int)len, ptr);
+            return EXIT_FAILURE;
+        }
     }
 
-    sr_connect(0, &conn);
-
-    /* install required modules */
-    rc = sr_install_module(conn, TESTS_DIR "/files/example-module.yang", TESTS_DIR "/files", NULL, 0);
-    if (rc && (rc != SR_ERR_EXISTS)) {
-        goto cleanup;
-    }
-    rc = sr_install_module(conn, TESTS_DIR "/files/referenced-data.yang", TESTS_DIR "/files", NULL, 0);
-    if (rc && (rc != SR_ERR_EXISTS)) {
-        goto cleanup;
-    }
-    rc = sr_install_module(conn, TESTS_DIR "/files/test-module.yang", TESTS_DIR "/files", NULL, 0);
-    if (rc && (rc != SR_ERR_EXISTS)) {
-        goto cleanup;
-    }
-    rc = sr_install_module(conn, TESTS_DIR "/files/ietf-ip.yang", TESTS_DIR "/files", NULL, 0);
-    if (rc && (rc != SR_ERR_EXISTS)) {
-        goto cleanup;
+    if (file_path) {
+        out = fopen(file_path, "w");
+        if (!out) {
+            fprintf(stderr, "Failed to open \"%s\" for writing (%s).\n", file_path, strerror(errno));
+            return EXIT_FAILURE;
+        }
     }
-    rc = sr_install_module(conn, TESTS_DIR "/files/iana-if-type.yang", TESTS_DIR "/files", NULL, 0);
-    if (rc && (rc != SR_ERR_EXISTS)) {
+
+    sr_log_stderr(SR_LL_ERR);
+    if (perf_prepare(&opts)) {
         goto cleanup;
     }
+    prepared = 1;
+
+    fprintf(out, "{\n  \"clients\": %u,\n  \"threads\": %u,\n  \"subscribers\": %u,\n  \"items\": %u,\n  \"ops\": %u,\n"
+            "  \"results\": [", opts.clients, opts.threads, opts.subscribers, opts.items, opts.ops);
+    for (i = 0; i < PERF_TEST_COUNT; ++i) {
+        if (tests) {
+            len = strlen(perf_tests[i].name);
+            for (ptr = tests; (ptr = strstr(ptr, perf_tests[i].name)); ptr += len) {
+                if (((ptr == tests) || (ptr[-1] == ',')) && (!ptr[len] || (ptr[len] == ','))) {
+                    break;
+                }
+            }
+            if (!ptr) {
+                continue;
+            }
+        }
 
-    sr_disconnect(conn);
-    sr_connect(0, &conn);
-    sr_session_start(conn, SR_DS_RUNNING, &sess);
-
-    /* one list instance */
-    createDataTreeExampleModule(sess);
-    createDataTreeLargeIETFinterfacesModule(sess, 1);
-    instance_cnt = 1;
-    test_perf(tests, test_count, "Data file with one list instance", selection);
-
-    /* 20 list instances*/
-    createDataTreeLargeExampleModule(sess, 20);
-    createDataTreeLargeIETFinterfacesModule(sess, 20);
-    instance_cnt = 20;
-    test_perf(tests, test_count, "Data file with 20 list instances", selection);
-
-
-    /* decrease the number of performed operation on larger file */
-    for (size_t i = 0; i < test_count; i++){
-        if (OP_COUNT_COMMIT != tests[i].op_count){
-            tests[i].op_count = OP_COUNT_LOW;
+        if (perf_run_test(&opts, &perf_tests[i], out, first)) {
+            goto cleanup;
         }
+        first = 0;
     }
+    fprintf(out, "\n  ]\n}\n");
 
-    /* 100 list instances*/
-    createDataTreeLargeExampleModule(sess, 100);
-    createDataTreeLargeIETFinterfacesModule(sess, 100);
-    instance_cnt = 100;
-    test_perf(tests, test_count, "Data file with 100 list instances", selection);
-    puts("\n\n");
-    ret = 0;
+    rc = EXIT_SUCCESS;
 
 cleanup:
-    /* uninstall modules */
-    sr_remove_module(conn, "example-module");
-    sr_remove_module(conn, "test-module");
-    sr_remove_module(conn, "referenced-data");
-    sr_remove_module(conn, "ietf-ip");
-    sr_remove_module(conn, "iana-if-type");
-    sr_remove_module(conn, "ietf-interfaces");
-    sr_disconnect(conn);
-    return ret;
+    if (prepared) {
+        perf_cleanup();
+    }
+    if (file_path) {
+        fclose(out);
+    }
+    return rc;
 }
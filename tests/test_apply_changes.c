@@ -138,6 +138,7 @@ module_change_done_cb(sr_session_ctx_t *session, const char *module_name, const
     char *str1;
     const char *str2, *prev_val, *prev_list;
     bool prev_dflt;
+    uint32_t i;
     int ret;
 
     (void)request_id;
@@ -253,6 +254,30 @@ module_change_done_cb(sr_session_ctx_t *session, const char *module_name, const
 
         sr_free_change_iter(iter);
 
+        /* get the same changes again, only nodes and operations */
+        ret = sr_get_changes_iter(session, "/ietf-interfaces:interfaces/interface//.", &iter);
+        assert_int_equal(ret, SR_ERR_OK);
+
+        for (i = 0; (ret = sr_get_change_tree_next(session, iter, &op, &node, NULL, NULL, NULL)) == SR_ERR_OK; ++i) {
+            assert_int_equal(op, SR_OP_CREATED);
+        }
+        assert_int_equal(ret, SR_ERR_NOT_FOUND);
+        assert_int_equal(i, 10);
+
+        sr_free_change_iter(iter);
+
+        /* only the list instance */
+        ret = sr_get_changes_iter(session, "/ietf-interfaces:interfaces/interface", &iter);
+        assert_int_equal(ret, SR_ERR_OK);
+
+        ret = sr_get_change_next(session, iter, &op, NULL, NULL);
+        assert_int_equal(ret, SR_ERR_OK);
+        assert_int_equal(op, SR_OP_CREATED);
+        ret = sr_get_change_next(session, iter, &op, NULL, NULL);
+        assert_int_equal(ret, SR_ERR_NOT_FOUND);
+
+        sr_free_change_iter(iter);
+
         /* check current data tree */
         ret = sr_get_subtree(session, "/ietf-interfaces:interfaces", 0, &subtree);
         assert_int_equal(ret, SR_ERR_OK);
@@ -2959,6 +2984,338 @@ test_change_order(void **state)
     pthread_join(tid[1], NULL);
 }
 
+/* TEST 11 */
+static pthread_mutex_t parallel_lock = PTHREAD_MUTEX_INITIALIZER;
+static int parallel_running, parallel_max_running, parallel_fail;
+
+static int
+module_change_parallel_cb(sr_session_ctx_t *session, const char *module_name, const char *xpath, sr_event_t event,
+        uint32_t request_id, void *private_data)
+{
+    struct state *st = (struct state *)private_data;
+    int ret = SR_ERR_OK;
+
+    (void)session;
+    (void)request_id;
+
+    assert_string_equal(module_name, "test");
+
+    pthread_mutex_lock(&parallel_lock);
+    ++parallel_running;
+    if (parallel_running > parallel_max_running) {
+        parallel_max_running = parallel_running;
+    }
+    pthread_mutex_unlock(&parallel_lock);
+
+    if (event == SR_EV_CHANGE) {
+        /* give the other callbacks time to start */
+        usleep(100000);
+        if (parallel_fail && xpath) {
+            ret = SR_ERR_UNSUPPORTED;
+        }
+    }
+
+    pthread_mutex_lock(&parallel_lock);
+    --parallel_running;
+    ++st->cb_called;
+    pthread_mutex_unlock(&parallel_lock);
+
+    return ret;
+}
+
+static void *
+apply_change_parallel_thread(void *arg)
+{
+    struct state *st = (struct state *)arg;
+    sr_session_ctx_t *sess;
+    int ret;
+
+    ret = sr_session_start(st->conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_set_item_str(sess, "/test:l1[k='one']/v", "1", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* wait for subscription before applying changes */
+    pthread_barrier_wait(&st->barrier);
+
+    /* perform the change */
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    pthread_barrier_wait(&st->barrier);
+
+    /* perform a change that will fail */
+    parallel_fail = 1;
+    ret = sr_set_item_str(sess, "/test:l1[k='two']/v", "2", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_CALLBACK_FAILED);
+    ret = sr_discard_changes(sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* signal that we have finished applying changes */
+    pthread_barrier_wait(&st->barrier);
+
+    sr_session_stop(sess);
+    return NULL;
+}
+
+static void *
+subscribe_change_parallel_thread(void *arg)
+{
+    struct state *st = (struct state *)arg;
+    sr_session_ctx_t *sess;
+    sr_subscription_ctx_t *subscr;
+    int count, ret;
+
+    ret = sr_session_start(st->conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* make 4 subscriptions with the same priority */
+    ret = sr_module_change_subscribe(sess, "test", NULL, module_change_parallel_cb, st, 0, 0, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_module_change_subscribe(sess, "test", NULL, module_change_parallel_cb, st, 0, SR_SUBSCR_CTX_REUSE, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_module_change_subscribe(sess, "test", NULL, module_change_parallel_cb, st, 0, SR_SUBSCR_CTX_REUSE, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_module_change_subscribe(sess, "test", "/test:l1", module_change_parallel_cb, st, 0, SR_SUBSCR_CTX_REUSE, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_subscription_set_workers(subscr, 4);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* signal that subscription was created */
+    pthread_barrier_wait(&st->barrier);
+
+    /* "change" and "done" */
+    count = 0;
+    while ((st->cb_called < 8) && (count < 1500)) {
+        usleep(10000);
+        ++count;
+    }
+    assert_int_equal(st->cb_called, 8);
+    assert_true(parallel_max_running > 1);
+
+    /* wait for the other thread to try the failing change */
+    pthread_barrier_wait(&st->barrier);
+
+    /* "change" and "abort" for the successful callbacks */
+    count = 0;
+    while ((st->cb_called < 15) && (count < 1500)) {
+        usleep(10000);
+        ++count;
+    }
+    assert_int_equal(st->cb_called, 15);
+
+    /* wait for the other thread to finish */
+    pthread_barrier_wait(&st->barrier);
+
+    sr_unsubscribe(subscr);
+
+    /* cleanup after ourselves */
+    ret = sr_delete_item(sess, "/test:l1[k='one']", SR_EDIT_STRICT);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    sr_session_stop(sess);
+    return NULL;
+}
+
+static void
+test_change_parallel(void **state)
+{
+    pthread_t tid[2];
+
+    pthread_create(&tid[0], NULL, apply_change_parallel_thread, *state);
+    pthread_create(&tid[1], NULL, subscribe_change_parallel_thread, *state);
+
+    pthread_join(tid[0], NULL);
+    pthread_join(tid[1], NULL);
+}
+
+/* TEST 12 */
+static int
+module_change_dispatch_cb(sr_session_ctx_t *session, const char *module_name, const char *xpath, sr_event_t event,
+        uint32_t request_id, void *private_data)
+{
+    struct state *st = (struct state *)private_data;
+
+    (void)session;
+    (void)xpath;
+    (void)request_id;
+
+    assert_string_equal(module_name, "test");
+    assert_true((event == SR_EV_CHANGE) || (event == SR_EV_DONE));
+
+    pthread_mutex_lock(&parallel_lock);
+    ++st->cb_called;
+    pthread_mutex_unlock(&parallel_lock);
+
+    return SR_ERR_OK;
+}
+
+static void
+test_change_dispatch(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_session_ctx_t *sess;
+    sr_subscription_ctx_t *subscr[3];
+    int count, ret, i;
+
+    ret = sr_dispatcher_start(2);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_dispatcher_start(2);
+    assert_int_equal(ret, SR_ERR_EXISTS);
+
+    ret = sr_session_start(st->conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* separate subscriptions, all handled by the dispatcher threads */
+    for (i = 0; i < 3; ++i) {
+        ret = sr_module_change_subscribe(sess, "test", NULL, module_change_dispatch_cb, st, i, 0, &subscr[i]);
+        assert_int_equal(ret, SR_ERR_OK);
+    }
+
+    /* dispatcher is still in use */
+    ret = sr_dispatcher_stop();
+    assert_int_equal(ret, SR_ERR_OPERATION_FAILED);
+
+    ret = sr_set_item_str(sess, "/test:l1[k='one']/v", "1", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* "change" and "done" */
+    count = 0;
+    while ((st->cb_called < 6) && (count < 1500)) {
+        usleep(10000);
+        ++count;
+    }
+    assert_int_equal(st->cb_called, 6);
+
+    for (i = 0; i < 3; ++i) {
+        sr_unsubscribe(subscr[i]);
+    }
+
+    ret = sr_dispatcher_stop();
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* cleanup after ourselves */
+    ret = sr_delete_item(sess, "/test:l1[k='one']", SR_EDIT_STRICT);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    sr_session_stop(sess);
+}
+
+/* TEST 13 */
+static void
+check_filtered_changes(sr_session_ctx_t *session, const char *iter_xpath, const char *prefix, int leaf_count)
+{
+    sr_change_iter_t *iter;
+    sr_change_oper_t op;
+    sr_val_t *old_val, *new_val;
+    int ret, count = 0;
+
+    ret = sr_get_changes_iter(session, iter_xpath, &iter);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    while ((ret = sr_get_change_next(session, iter, &op, &old_val, &new_val)) == SR_ERR_OK) {
+        assert_int_equal(op, SR_OP_CREATED);
+        assert_null(old_val);
+        assert_non_null(new_val);
+        if ((new_val->type != SR_CONTAINER_T) && (new_val->type != SR_LIST_T)) {
+            /* only changes selected by the subscription */
+            assert_int_equal(strncmp(new_val->xpath, prefix, strlen(prefix)), 0);
+            ++count;
+        }
+        sr_free_val(new_val);
+    }
+    assert_int_equal(ret, SR_ERR_NOT_FOUND);
+    assert_int_equal(count, leaf_count);
+
+    sr_free_change_iter(iter);
+}
+
+static int
+module_change_filtered_cb(sr_session_ctx_t *session, const char *module_name, const char *xpath, sr_event_t event,
+        uint32_t request_id, void *private_data)
+{
+    struct state *st = (struct state *)private_data;
+
+    (void)request_id;
+
+    assert_string_equal(module_name, "test");
+    assert_non_null(xpath);
+
+    if (event == SR_EV_CHANGE) {
+        /* indexed selection */
+        check_filtered_changes(session, "/test:*//.", xpath, 2);
+
+        /* generic XPath */
+        check_filtered_changes(session, "//test:v", xpath, 1);
+    }
+
+    ++st->cb_called;
+    return SR_ERR_OK;
+}
+
+static void
+test_change_filtered(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_session_ctx_t *sess;
+    sr_subscription_ctx_t *subscr;
+    int count, ret;
+
+    ret = sr_session_start(st->conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* both subscriptions get only their part of the same event diff */
+    ret = sr_module_change_subscribe(sess, "test", "/test:l1[k='one']", module_change_filtered_cb, st, 0, 0, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_module_change_subscribe(sess, "test", "/test:cont/l2", module_change_filtered_cb, st, 0,
+            SR_SUBSCR_CTX_REUSE, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_set_item_str(sess, "/test:l1[k='one']/v", "1", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_set_item_str(sess, "/test:l1[k='two']/v", "2", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_set_item_str(sess, "/test:cont/l2[k='a']/v", "3", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_set_item_str(sess, "/test:test-leaf", "5", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* "change" and "done" */
+    count = 0;
+    while ((st->cb_called < 4) && (count < 1500)) {
+        usleep(10000);
+        ++count;
+    }
+    assert_int_equal(st->cb_called, 4);
+
+    sr_unsubscribe(subscr);
+
+    /* cleanup after ourselves */
+    ret = sr_delete_item(sess, "/test:l1[k='one']", 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_delete_item(sess, "/test:l1[k='two']", 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_delete_item(sess, "/test:cont/l2[k='a']", 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_delete_item(sess, "/test:test-leaf", 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    sr_session_stop(sess);
+}
+
 /* MAIN */
 int
 main(void)
@@ -2974,6 +3331,9 @@ main(void)
         cmocka_unit_test_setup_teardown(test_change_unlocked, setup_f, teardown_f),
         cmocka_unit_test_setup_teardown(test_change_timeout, setup_f, teardown_f),
         cmocka_unit_test_setup_teardown(test_change_order, setup_f, teardown_f),
+        cmocka_unit_test_setup_teardown(test_change_parallel, setup_f, teardown_f),
+        cmocka_unit_test_setup_teardown(test_change_dispatch, setup_f, teardown_f),
+        cmocka_unit_test_setup_teardown(test_change_filtered, setup_f, teardown_f),
     };
 
     setenv("CMOCKA_TEST_ABORT", "1", 1);
@@ -1466,6 +1466,148 @@ test_replace(void **state)
     pthread_join(tid[1], NULL);
 }
 
+/* TEST 5 */
+static void
+test_replace_bulk(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_session_ctx_t *sess;
+    struct lyd_node *config, *node;
+    char *str1;
+    const char *str2;
+    int ret;
+
+    ret = sr_session_start(st->conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* prepare some ietf-interfaces config */
+    config = lyd_new_path(NULL, sr_get_context(st->conn), "/ietf-interfaces:interfaces/interface[name='eth1']/type",
+            "iana-if-type:ethernetCsmacd", 0, 0);
+    assert_non_null(config);
+    node = lyd_new_path(config, NULL, "/ietf-interfaces:interfaces/interface[name='eth2']/type", "iana-if-type:sonet", 0, 0);
+    assert_non_null(node);
+
+    /* replace-config with no subscribers so no diff is generated */
+    ret = sr_replace_config(sess, "ietf-interfaces", config, SR_DS_RUNNING, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* check current data tree */
+    ret = sr_get_data(sess, "/ietf-interfaces:interfaces", 0, 0, 0, &node);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = lyd_print_mem(&str1, node, LYD_XML, LYP_WITHSIBLINGS);
+    assert_int_equal(ret, 0);
+    lyd_free_withsiblings(node);
+
+    str2 =
+    "<interfaces xmlns=\"urn:ietf:params:xml:ns:yang:ietf-interfaces\">"
+        "<interface>"
+            "<name>eth1</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:ethernetCsmacd</type>"
+        "</interface>"
+        "<interface>"
+            "<name>eth2</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:sonet</type>"
+        "</interface>"
+    "</interfaces>";
+
+    assert_string_equal(str1, str2);
+    free(str1);
+
+    /* invalid data must still be refused */
+    config = lyd_new_path(NULL, sr_get_context(st->conn), "/ietf-interfaces:interfaces/interface[name='eth1']",
+            NULL, 0, 0);
+    assert_non_null(config);
+    ret = sr_replace_config(sess, "ietf-interfaces", config, SR_DS_RUNNING, 0);
+    assert_int_equal(ret, SR_ERR_VALIDATION_FAILED);
+
+    /* replace with empty config */
+    ret = sr_replace_config(sess, "ietf-interfaces", NULL, SR_DS_RUNNING, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_get_data(sess, "/ietf-interfaces:interfaces", 0, 0, 0, &node);
+    assert_int_equal(ret, SR_ERR_OK);
+    assert_null(node);
+
+    sr_session_stop(sess);
+}
+
+/* TEST 6 */
+static void
+test_copy_raw(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_session_ctx_t *sess;
+    struct lyd_node *config, *node;
+    char *str1;
+    const char *str2;
+    int ret;
+
+    ret = sr_session_start(st->conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* prepare some running ietf-interfaces config */
+    config = lyd_new_path(NULL, sr_get_context(st->conn), "/ietf-interfaces:interfaces/interface[name='eth1']/type",
+            "iana-if-type:ethernetCsmacd", 0, 0);
+    assert_non_null(config);
+    ret = sr_replace_config(sess, "ietf-interfaces", config, SR_DS_RUNNING, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* copy all the modules with no subscribers, data are copied directly */
+    ret = sr_copy_config(sess, NULL, SR_DS_RUNNING, SR_DS_STARTUP, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* check startup data tree */
+    ret = sr_session_switch_ds(sess, SR_DS_STARTUP);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_get_data(sess, "/ietf-interfaces:interfaces", 0, 0, 0, &node);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = lyd_print_mem(&str1, node, LYD_XML, LYP_WITHSIBLINGS);
+    assert_int_equal(ret, 0);
+    lyd_free_withsiblings(node);
+
+    str2 =
+    "<interfaces xmlns=\"urn:ietf:params:xml:ns:yang:ietf-interfaces\">"
+        "<interface>"
+            "<name>eth1</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:ethernetCsmacd</type>"
+        "</interface>"
+    "</interfaces>";
+
+    assert_string_equal(str1, str2);
+    free(str1);
+
+    /* clear running */
+    ret = sr_replace_config(sess, "ietf-interfaces", NULL, SR_DS_RUNNING, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* copy startup back into running */
+    ret = sr_copy_config(sess, NULL, SR_DS_STARTUP, SR_DS_RUNNING, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* check running data tree */
+    ret = sr_session_switch_ds(sess, SR_DS_RUNNING);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_get_data(sess, "/ietf-interfaces:interfaces", 0, 0, 0, &node);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = lyd_print_mem(&str1, node, LYD_XML, LYP_WITHSIBLINGS);
+    assert_int_equal(ret, 0);
+    lyd_free_withsiblings(node);
+
+    assert_string_equal(str1, str2);
+    free(str1);
+
+    /* cleanup */
+    ret = sr_replace_config(sess, "ietf-interfaces", NULL, SR_DS_RUNNING, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_copy_config(sess, "ietf-interfaces", SR_DS_RUNNING, SR_DS_STARTUP, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    sr_session_stop(sess);
+}
+
 /* MAIN */
 int
 main(void)
@@ -1475,6 +1617,8 @@ main(void)
         cmocka_unit_test_setup_teardown(test_simple, setup_f, teardown_f),
         cmocka_unit_test_setup_teardown(test_userord, setup_f, teardown_f),
         cmocka_unit_test_setup_teardown(test_replace, setup_f, teardown_f),
+        cmocka_unit_test_setup_teardown(test_replace_bulk, setup_f, teardown_f),
+        cmocka_unit_test_setup_teardown(test_copy_raw, setup_f, teardown_f),
     };
 
     setenv("CMOCKA_TEST_ABORT", "1", 1);
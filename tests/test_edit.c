@@ -457,6 +457,164 @@ test_move1(void **state)
     lyd_free_withsiblings(data);
 }
 
+static void
+test_edit_bulk(void **state)
+{
+    struct state *st = (struct state *)*state;
+    struct lyd_node *subtree;
+    sr_val_t *val;
+    char *str;
+    const char *str2;
+    int ret;
+    sr_edit_entry_t entries[] = {
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/type", "iana-if-type:ethernetCsmacd", 0, 0},
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/description", "desc64", 0, 0},
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/enabled", "false", 0, 0},
+        {"/ietf-interfaces:interfaces/interface[name='eth65']/type", "iana-if-type:ethernetCsmacd", 0, 0},
+        {"/ietf-interfaces:interfaces/interface[name='eth65']/description", "desc65", 0, 0},
+        /* same change is ignored */
+        {"/ietf-interfaces:interfaces/interface[name='eth65']/description", "desc65", 0, 0},
+    };
+    sr_edit_entry_t del_entries[] = {
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/description", NULL, 1, 0},
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/enabled", NULL, 1, SR_EDIT_STRICT},
+        {"/ietf-interfaces:interfaces/interface[name='eth65']", NULL, 1, 0},
+    };
+    sr_edit_entry_t upd_entries[] = {
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/description", NULL, 1, 0},
+        /* updates the operation of the parents created by the previous change */
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/enabled", "true", 0, 0},
+        {"/ietf-interfaces:interfaces/interface[name='eth64']/type", "iana-if-type:ethernetCsmacd", 0, 0},
+    };
+
+    ret = sr_edit_bulk(st->sess, entries, sizeof entries / sizeof *entries, NULL);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(st->sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_get_subtree(st->sess, "/ietf-interfaces:interfaces", 0, &subtree);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    lyd_print_mem(&str, subtree, LYD_XML, LYP_WITHSIBLINGS);
+    lyd_free(subtree);
+
+    str2 =
+    "<interfaces xmlns=\"urn:ietf:params:xml:ns:yang:ietf-interfaces\">"
+        "<interface>"
+            "<name>eth64</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:ethernetCsmacd</type>"
+            "<description>desc64</description>"
+            "<enabled>false</enabled>"
+        "</interface>"
+        "<interface>"
+            "<name>eth65</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:ethernetCsmacd</type>"
+            "<description>desc65</description>"
+        "</interface>"
+    "</interfaces>";
+
+    assert_string_equal(str, str2);
+    free(str);
+
+    /* bulk delete */
+    ret = sr_edit_bulk(st->sess, del_entries, sizeof del_entries / sizeof *del_entries, NULL);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(st->sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_get_subtree(st->sess, "/ietf-interfaces:interfaces", 0, &subtree);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    lyd_print_mem(&str, subtree, LYD_XML, LYP_WITHSIBLINGS);
+    lyd_free(subtree);
+
+    str2 =
+    "<interfaces xmlns=\"urn:ietf:params:xml:ns:yang:ietf-interfaces\">"
+        "<interface>"
+            "<name>eth64</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:ethernetCsmacd</type>"
+        "</interface>"
+    "</interfaces>";
+
+    assert_string_equal(str, str2);
+    free(str);
+
+    /* changes relative to the previous ones */
+    ret = sr_edit_bulk(st->sess, upd_entries, sizeof upd_entries / sizeof *upd_entries, NULL);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(st->sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_get_subtree(st->sess, "/ietf-interfaces:interfaces", 0, &subtree);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    lyd_print_mem(&str, subtree, LYD_XML, LYP_WITHSIBLINGS);
+    lyd_free(subtree);
+
+    str2 =
+    "<interfaces xmlns=\"urn:ietf:params:xml:ns:yang:ietf-interfaces\">"
+        "<interface>"
+            "<name>eth64</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:ethernetCsmacd</type>"
+            "<enabled>true</enabled>"
+        "</interface>"
+    "</interfaces>";
+
+    assert_string_equal(str, str2);
+    free(str);
+
+    /* conflicting changes, the previous session changes are kept */
+    ret = sr_set_item_str(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/enabled", "false", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    entries[1].opts = SR_EDIT_STRICT;
+    entries[2].del = 1;
+    entries[2].xpath = "/ietf-interfaces:interfaces/interface[name='eth64']/description";
+    ret = sr_edit_bulk(st->sess, entries, 3, NULL);
+    assert_int_equal(ret, SR_ERR_INVAL_ARG);
+    ret = sr_apply_changes(st->sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_get_item(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/enabled", 0, &val);
+    assert_int_equal(ret, SR_ERR_OK);
+    assert_int_equal(val->data.bool_val, 0);
+    sr_free_val(val);
+}
+
+static void
+test_noop(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_val_t *val;
+    int ret, i;
+
+    /* the same edit applied repeatedly */
+    for (i = 0; i < 3; ++i) {
+        ret = sr_set_item_str(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/type",
+                "iana-if-type:ethernetCsmacd", NULL, 0);
+        assert_int_equal(ret, SR_ERR_OK);
+        ret = sr_apply_changes(st->sess, 0);
+        assert_int_equal(ret, SR_ERR_OK);
+    }
+
+    ret = sr_get_item(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/enabled", 0, &val);
+    assert_int_equal(ret, SR_ERR_OK);
+    assert_int_equal(val->dflt, 1);
+    sr_free_val(val);
+
+    /* only the default flag changes, must not be considered a no-op */
+    for (i = 0; i < 2; ++i) {
+        ret = sr_set_item_str(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/enabled", "true", NULL, 0);
+        assert_int_equal(ret, SR_ERR_OK);
+        ret = sr_apply_changes(st->sess, 0);
+        assert_int_equal(ret, SR_ERR_OK);
+
+        ret = sr_get_item(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/enabled", 0, &val);
+        assert_int_equal(ret, SR_ERR_OK);
+        assert_int_equal(val->dflt, 0);
+        sr_free_val(val);
+    }
+}
+
 int
 main(void)
 {
@@ -467,6 +625,8 @@ main(void)
         cmocka_unit_test_teardown(test_create1, clear_interfaces),
         cmocka_unit_test_teardown(test_create2, clear_interfaces),
         cmocka_unit_test_teardown(test_move1, clear_test),
+        cmocka_unit_test_teardown(test_edit_bulk, clear_interfaces),
+        cmocka_unit_test_teardown(test_noop, clear_interfaces),
     };
 
     setenv("CMOCKA_TEST_ABORT", "1", 1);
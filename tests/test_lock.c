@@ -195,6 +195,98 @@ test_session_stop_unlock(void **state)
     sr_session_stop(sess2);
 }
 
+/* TEST 3 */
+static sr_conn_ctx_t *subtree_conn;
+
+static int
+subtree_diff_check_cb(sr_session_ctx_t *session, const struct lyd_node *diff)
+{
+    sr_session_ctx_t *sess;
+    int ret;
+
+    (void)session;
+    (void)diff;
+
+    ret = sr_session_start(subtree_conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* change another list instance while the first one is being changed */
+    ret = sr_set_item_str(sess, "/test:l1[k='b']/v", "2", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* try to change the same list instance */
+    ret = sr_set_item_str(sess, "/test:l1[k='a']/v", "3", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_LOCKED);
+    ret = sr_discard_changes(sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* try to change other module data */
+    ret = sr_set_item_str(sess, "/test:test-leaf", "1", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_LOCKED);
+
+    sr_session_stop(sess);
+    return SR_ERR_OK;
+}
+
+static void
+test_subtree_lock(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_session_ctx_t *sess;
+    struct lyd_node *data;
+    int ret;
+
+    /* not top-level configuration lists */
+    ret = sr_set_module_subtree_lock(st->conn, "test", "cont");
+    assert_int_equal(ret, SR_ERR_INVAL_ARG);
+    ret = sr_set_module_subtree_lock(st->conn, "test", "l2");
+    assert_int_equal(ret, SR_ERR_INVAL_ARG);
+
+    ret = sr_set_module_subtree_lock(st->conn, "test", "l1");
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_connect(0, &subtree_conn);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_session_start(st->conn, SR_DS_RUNNING, &sess);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* change a list instance, the other ones are changed meanwhile */
+    sr_set_diff_check_callback(st->conn, subtree_diff_check_cb);
+    ret = sr_set_item_str(sess, "/test:l1[k='a']/v", "1", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    sr_set_diff_check_callback(st->conn, NULL);
+
+    /* both changes were stored */
+    ret = sr_get_data(sess, "/test:l1", 0, 0, 0, &data);
+    assert_int_equal(ret, SR_ERR_OK);
+    assert_non_null(data);
+    assert_string_equal(data->schema->name, "l1");
+    assert_non_null(data->next);
+    assert_string_equal(data->next->schema->name, "l1");
+    assert_null(data->next->next);
+    lyd_free_withsiblings(data);
+
+    /* cleanup */
+    ret = sr_delete_item(sess, "/test:l1", 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_set_module_subtree_lock(st->conn, "test", NULL);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    sr_session_stop(sess);
+    sr_disconnect(subtree_conn);
+}
+
 /* MAIN */
 int
 main(void)
@@ -202,6 +294,7 @@ main(void)
     const struct CMUnitTest tests[] = {
         cmocka_unit_test(test_one_session),
         cmocka_unit_test(test_session_stop_unlock),
+        cmocka_unit_test(test_subtree_lock),
     };
 
     setenv("CMOCKA_TEST_ABORT", "1", 1);
@@ -1000,6 +1000,65 @@ test_notif_buffer(void **state)
     lyd_free_withsiblings(notif);
 }
 
+/* TEST 8 */
+static void
+notif_batch_cb(sr_session_ctx_t *session, const sr_ev_notif_type_t notif_type, const struct lyd_node *notif,
+        time_t timestamp, void *private_data)
+{
+    struct state *st = (struct state *)private_data;
+
+    (void)session;
+    (void)timestamp;
+
+    assert_int_equal(notif_type, SR_EV_NOTIF_REALTIME);
+    assert_string_equal(notif->schema->name, "notif4");
+
+    ++st->cb_called;
+}
+
+static void
+test_notif_batch(void **state)
+{
+    struct state *st = (struct state *)*state;
+    const struct ly_ctx *ly_ctx = sr_get_context(st->conn);
+    sr_subscription_ctx_t *subscr;
+    struct lyd_node *notifs[4];
+    int count, i, ret;
+
+    st->cb_called = 0;
+
+    ret = sr_event_notif_subscribe_tree(st->sess, "ops", NULL, 0, 0, notif_batch_cb, st, 0, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    for (i = 0; i < 3; ++i) {
+        notifs[i] = lyd_new_path(NULL, ly_ctx, "/ops:notif4", NULL, 0, 0);
+        assert_non_null(notifs[i]);
+    }
+    notifs[3] = lyd_new_path(NULL, ly_ctx, "/ops:cont/cont3/notif2/l13", "/ops-ref:l101", 0, 0);
+    assert_non_null(notifs[3]);
+
+    /* one invalid notification, nothing is sent */
+    ret = sr_event_notif_send_batch(st->sess, notifs, 4);
+    assert_int_not_equal(ret, SR_ERR_OK);
+
+    /* send only the valid ones */
+    ret = sr_event_notif_send_batch(st->sess, notifs, 3);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* all of them are delivered in a single event */
+    count = 0;
+    while ((st->cb_called < 3) && (count < 1500)) {
+        usleep(10000);
+        ++count;
+    }
+    assert_int_equal(st->cb_called, 3);
+
+    for (i = 0; i < 4; ++i) {
+        lyd_free_withsiblings(notifs[i]);
+    }
+    sr_unsubscribe(subscr);
+}
+
 /* MAIN */
 int
 main(void)
@@ -1012,6 +1071,7 @@ main(void)
         cmocka_unit_test_setup_teardown(test_no_replay, clear_ops_notif, clear_ops),
         cmocka_unit_test_teardown(test_notif_config_change, clear_ops),
         cmocka_unit_test(test_notif_buffer),
+        cmocka_unit_test(test_notif_batch),
     };
 
     setenv("CMOCKA_TEST_ABORT", "1", 1);
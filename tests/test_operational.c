@@ -2080,6 +2080,130 @@ test_default_when(void **state)
     free(str1);
 }
 
+/* TEST 19 */
+static void
+test_prepared(void **state)
+{
+    struct state *st = (struct state *)*state;
+    struct lyd_node *data;
+    struct ly_set *set;
+    sr_subscription_ctx_t *subscr;
+    sr_query_t *query;
+    char *str1;
+    const char *str2;
+    int ret;
+
+    /* prepare the query before there are any subscriptions */
+    ret = sr_session_switch_ds(st->sess, SR_DS_OPERATIONAL);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_prepare_query(st->sess, "/ietf-interfaces:*", &query);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* subscribe as state data provider */
+    ret = sr_oper_get_items_subscribe(st->sess, "ietf-interfaces", "/ietf-interfaces:interfaces-state", simple_oper_cb,
+            NULL, 0, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* the new subscription must be used, twice to use the cached information as well */
+    str2 =
+    "<interfaces-state xmlns=\"urn:ietf:params:xml:ns:yang:ietf-interfaces\">"
+        "<interface>"
+            "<name>eth5</name>"
+            "<type xmlns:ianaift=\"urn:ietf:params:xml:ns:yang:iana-if-type\">ianaift:ethernetCsmacd</type>"
+            "<oper-status>testing</oper-status>"
+            "<statistics>"
+                "<discontinuity-time>2000-01-01T00:00:00Z</discontinuity-time>"
+            "</statistics>"
+        "</interface>"
+    "</interfaces-state>";
+
+    ret = sr_get_data_prepared(st->sess, query, 0, 0, 0, &data);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = lyd_print_mem(&str1, data, LYD_XML, LYP_WITHSIBLINGS);
+    assert_int_equal(ret, 0);
+    lyd_free_withsiblings(data);
+    assert_string_equal(str1, str2);
+    free(str1);
+
+    ret = sr_get_data_prepared(st->sess, query, 0, 0, 0, &data);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = lyd_print_mem(&str1, data, LYD_XML, LYP_WITHSIBLINGS);
+    assert_int_equal(ret, 0);
+    lyd_free_withsiblings(data);
+    assert_string_equal(str1, str2);
+    free(str1);
+
+    /* no more provider */
+    sr_unsubscribe(subscr);
+
+    ret = sr_get_data_prepared(st->sess, query, 0, 0, 0, &data);
+    assert_int_equal(ret, SR_ERR_OK);
+    if (data) {
+        set = lyd_find_path(data, "/ietf-interfaces:interfaces-state/interface");
+        assert_non_null(set);
+        assert_int_equal(set->number, 0);
+        ly_set_free(set);
+        lyd_free_withsiblings(data);
+    }
+
+    /* the query is bound to its datastore */
+    ret = sr_session_switch_ds(st->sess, SR_DS_RUNNING);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_get_data_prepared(st->sess, query, 0, 0, 0, &data);
+    assert_int_equal(ret, SR_ERR_INVAL_ARG);
+
+    sr_query_free(query);
+}
+
+/* TEST 20 */
+static void
+test_get_items_arena(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_val_t *values, *arena_values;
+    size_t i, count, arena_count;
+    int ret;
+
+    ret = sr_session_switch_ds(st->sess, SR_DS_RUNNING);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_set_item_str(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/type",
+            "iana-if-type:ethernetCsmacd", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_set_item_str(st->sess, "/ietf-interfaces:interfaces/interface[name='eth64']/description", "desc64", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_set_item_str(st->sess, "/ietf-interfaces:interfaces/interface[name='eth65']/type",
+            "iana-if-type:ethernetCsmacd", NULL, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_apply_changes(st->sess, 0);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    ret = sr_get_items(st->sess, "/ietf-interfaces:interfaces//.", 0, &values, &count);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_get_items_arena(st->sess, "/ietf-interfaces:interfaces//.", 0, &arena_values, &arena_count);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* the values must be the same, only stored differently */
+    assert_int_equal(count, arena_count);
+    for (i = 0; i < count; ++i) {
+        assert_string_equal(values[i].xpath, arena_values[i].xpath);
+        assert_int_equal(values[i].type, arena_values[i].type);
+        assert_int_equal(values[i].dflt, arena_values[i].dflt);
+        if (values[i].type == SR_STRING_T) {
+            assert_string_equal(values[i].data.string_val, arena_values[i].data.string_val);
+        }
+    }
+
+    sr_free_values(values, count);
+    sr_free_values_arena(arena_values, arena_count);
+
+    /* no data */
+    ret = sr_get_items_arena(st->sess, "/ietf-interfaces:interfaces-state", 0, &arena_values, &arena_count);
+    assert_int_equal(ret, SR_ERR_OK);
+    assert_int_equal(arena_count, 0);
+    assert_null(arena_values);
+    sr_free_values_arena(arena_values, arena_count);
+}
+
 int
 main(void)
 {
@@ -2102,6 +2226,8 @@ main(void)
         cmocka_unit_test_teardown(test_stored_diff_merge_replace, clear_up),
         cmocka_unit_test_teardown(test_stored_diff_merge_userord, clear_up),
         cmocka_unit_test(test_default_when),
+        cmocka_unit_test_teardown(test_prepared, clear_up),
+        cmocka_unit_test_teardown(test_get_items_arena, clear_up),
     };
 
     setenv("CMOCKA_TEST_ABORT", "1", 1);
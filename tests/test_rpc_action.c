@@ -26,6 +26,7 @@
 #include <pthread.h>
 #include <stdlib.h>
 #include <setjmp.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -1165,6 +1166,160 @@ test_action_deps(void **state)
     sr_unsubscribe(subscr);
 }
 
+/* TEST 9 */
+static int
+oper_deps_rpc_cb(sr_session_ctx_t *session, const char *xpath, const struct lyd_node *input, sr_event_t event,
+        uint32_t request_id, struct lyd_node *output, void *private_data)
+{
+    struct state *st = (struct state *)private_data;
+    struct lyd_node *node;
+
+    (void)session;
+    (void)input;
+    (void)event;
+    (void)request_id;
+
+    assert_string_equal(xpath, "/ops:rpc2");
+
+    /* references ops-ref:l2 */
+    node = lyd_new_path(output, NULL, "cont/l3", "l2-val", 0, LYD_PATH_OPT_OUTPUT);
+    assert_non_null(node);
+
+    ++st->cb_called;
+    return SR_ERR_OK;
+}
+
+static int
+oper_deps_oper_cb(sr_session_ctx_t *session, const char *module_name, const char *xpath, const char *request_xpath,
+        uint32_t request_id, struct lyd_node **parent, void *private_data)
+{
+    int *called = (int *)private_data;
+
+    (void)session;
+    (void)request_xpath;
+    (void)request_id;
+
+    assert_string_equal(module_name, "ops-ref");
+
+    *parent = lyd_new_path(NULL, sr_get_context(sr_session_get_connection(session)), xpath, "l2-val", 0, 0);
+    assert_non_null(*parent);
+
+    ++(*called);
+    return SR_ERR_OK;
+}
+
+static void
+test_oper_deps(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_subscription_ctx_t *subscr;
+    struct lyd_node *input_op, *output_op;
+    int ret, l1_called = 0, l2_called = 0;
+
+    /* subscribe to the RPC and provide both leaves of the referenced module */
+    ret = sr_rpc_subscribe_tree(st->sess, "/ops:rpc2", oper_deps_rpc_cb, st, 0, 0, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_oper_get_items_subscribe(st->sess, "ops-ref", "/ops-ref:l1", oper_deps_oper_cb, &l1_called,
+            SR_SUBSCR_CTX_REUSE, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+    ret = sr_oper_get_items_subscribe(st->sess, "ops-ref", "/ops-ref:l2", oper_deps_oper_cb, &l2_called,
+            SR_SUBSCR_CTX_REUSE, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    input_op = lyd_new_path(NULL, sr_get_context(st->conn), "/ops:rpc2", NULL, 0, 0);
+    assert_non_null(input_op);
+
+    /* send RPC, only the referenced leaf should be retrieved for output validation */
+    st->cb_called = 0;
+    ret = sr_rpc_send_tree(st->sess, input_op, 0, &output_op);
+    assert_int_equal(ret, SR_ERR_OK);
+    assert_int_equal(st->cb_called, 1);
+    assert_int_equal(l1_called, 0);
+    assert_int_equal(l2_called, 1);
+
+    lyd_free_withsiblings(output_op);
+    lyd_free_withsiblings(input_op);
+    sr_unsubscribe(subscr);
+}
+
+/* TEST 10 */
+static int
+async_rpc_cb(sr_session_ctx_t *session, const char *xpath, const struct lyd_node *input, sr_event_t event,
+        uint32_t request_id, struct lyd_node *output, void *private_data)
+{
+    struct lyd_node *node;
+
+    (void)session;
+    (void)event;
+    (void)request_id;
+    (void)private_data;
+
+    assert_string_equal(xpath, "/ops:rpc3");
+
+    /* return the input value */
+    assert_string_equal(input->child->schema->name, "l4");
+    node = lyd_new_path(output, NULL, "l5", (void *)((struct lyd_node_leaf_list *)input->child)->value_str, 0,
+            LYD_PATH_OPT_OUTPUT);
+    assert_non_null(node);
+
+    return SR_ERR_OK;
+}
+
+static void
+async_reply_cb(sr_session_ctx_t *session, const sr_error_info_t *err_info, const struct lyd_node *output,
+        void *private_data)
+{
+    struct state *st = (struct state *)private_data;
+    static volatile int sum;
+
+    (void)session;
+
+    assert_null(err_info);
+    assert_non_null(output);
+    assert_string_equal(output->child->schema->name, "l5");
+
+    __sync_fetch_and_add(&sum, ((struct lyd_node_leaf_list *)output->child)->value.uint16);
+    if (__sync_add_and_fetch(&st->cb_called, 1) == 3) {
+        /* each reply was delivered exactly once */
+        assert_int_equal(sum, 6);
+        sum = 0;
+    }
+}
+
+static void
+test_async(void **state)
+{
+    struct state *st = (struct state *)*state;
+    sr_subscription_ctx_t *subscr;
+    struct lyd_node *input_op;
+    char val[2];
+    int ret, i;
+
+    ret = sr_rpc_subscribe_tree(st->sess, "/ops:rpc3", async_rpc_cb, NULL, 0, 0, &subscr);
+    assert_int_equal(ret, SR_ERR_OK);
+
+    /* send several invocations of the same RPC without waiting */
+    st->cb_called = 0;
+    for (i = 1; i <= 3; ++i) {
+        input_op = lyd_new_path(NULL, sr_get_context(st->conn), "/ops:rpc3", NULL, 0, 0);
+        assert_non_null(input_op);
+        sprintf(val, "%d", i);
+        assert_non_null(lyd_new_path(input_op, NULL, "l4", val, 0, 0));
+
+        ret = sr_rpc_send_async(st->sess, input_op, 0, async_reply_cb, st);
+        lyd_free_withsiblings(input_op);
+        assert_int_equal(ret, SR_ERR_OK);
+    }
+
+    /* wait for all the replies */
+    for (i = 0; (i < 100) && (st->cb_called < 3); ++i) {
+        usleep(20000);
+    }
+    assert_int_equal(st->cb_called, 3);
+
+    sr_unsubscribe(subscr);
+}
+
 /* MAIN */
 int
 main(void)
@@ -1178,6 +1333,8 @@ main(void)
         cmocka_unit_test(test_multi_fail),
         cmocka_unit_test(test_unlocked),
         cmocka_unit_test(test_action_deps),
+        cmocka_unit_test_teardown(test_oper_deps, clear_ops),
+        cmocka_unit_test(test_async),
     };
 
     setenv("CMOCKA_TEST_ABORT", "1", 1);